@@ -0,0 +1,102 @@
+#!/usr/bin/env node
+
+/**
+ * Input Trace Dumper for vizPow
+ *
+ * Usage:
+ *   curl -o input.trc http://192.168.4.1/trace/file
+ *   node scripts/dump-trace.js input.trc > trace.csv
+ *   node scripts/dump-trace.js input.trc --summary
+ *
+ * Prints every record of a trace recorded with /trace?rec=1 as CSV:
+ *   kind,t_us,a,b,c,d,e,f
+ *   imu,   t, ax, ay, az (g), gx, gy, gz (dps)
+ *   touch, t, type, x, y
+ *   frame, t, mode, effect, palette, hash
+ * --summary prints counts, duration and the sample/frame rates instead.
+ */
+
+const fs = require('fs');
+
+// Must match input_trace.h
+const TRACE_MAGIC = 0x52545A56;
+const TRACE_VERSION = 1;
+const HEADER_SIZE = 16;
+const ACCEL_LSB = 8192;
+const GYRO_LSB = 64;
+const TOUCH_TYPES = ['DOWN', 'UP', 'TAP', 'LONG_PRESS', 'DOUBLE_TAP',
+                     'SWIPE_UP', 'SWIPE_DOWN', 'SWIPE_LEFT', 'SWIPE_RIGHT'];
+
+function* records(buf) {
+  let o = HEADER_SIZE;
+  while (o + 5 <= buf.length) {
+    const type = buf.readUInt8(o);
+    const t = buf.readUInt32LE(o + 1);
+    o += 5;
+    if (type === 1 && o + 12 <= buf.length) {
+      const v = [];
+      for (let i = 0; i < 6; i++) v.push(buf.readInt16LE(o + i * 2));
+      o += 12;
+      yield { kind: 'imu', t, fields: [
+        ...v.slice(0, 3).map(x => (x / ACCEL_LSB).toFixed(4)),
+        ...v.slice(3).map(x => (x / GYRO_LSB).toFixed(2))] };
+    } else if (type === 2 && o + 5 <= buf.length) {
+      const kind = buf.readUInt8(o);
+      yield { kind: 'touch', t, fields: [
+        TOUCH_TYPES[kind] || kind, buf.readUInt16LE(o + 1), buf.readUInt16LE(o + 3)] };
+      o += 5;
+    } else if (type === 3 && o + 7 <= buf.length) {
+      yield { kind: 'frame', t, fields: [
+        buf.readUInt8(o), buf.readUInt8(o + 1), buf.readUInt8(o + 2),
+        buf.readUInt32LE(o + 3).toString(16).padStart(8, '0')] };
+      o += 7;
+    } else {
+      throw new Error(`Truncated or unknown record (type ${type}) at byte ${o - 5}`);
+    }
+  }
+}
+
+function main() {
+  const args = process.argv.slice(2);
+  if (args.length < 1) {
+    console.log('Usage: node scripts/dump-trace.js input.trc [--summary]');
+    process.exit(1);
+  }
+
+  try {
+    const buf = fs.readFileSync(args[0]);
+    if (buf.length < HEADER_SIZE || buf.readUInt32LE(0) !== TRACE_MAGIC) {
+      throw new Error('Not an input trace');
+    }
+    if (buf.readUInt8(4) !== TRACE_VERSION) {
+      throw new Error(`Unsupported trace version ${buf.readUInt8(4)}`);
+    }
+    const seed = buf.readUInt32LE(8);
+
+    if (args.includes('--summary')) {
+      const counts = { imu: 0, touch: 0, frame: 0 };
+      let last = 0;
+      for (const r of records(buf)) {
+        counts[r.kind]++;
+        last = r.t;
+      }
+      const secs = last / 1e6;
+      console.log(`seed ${seed}, ${secs.toFixed(2)}s`);
+      console.log(`${counts.imu} IMU samples (${(counts.imu / secs).toFixed(0)}/s), ` +
+                  `${counts.frame} frames (${(counts.frame / secs).toFixed(1)} fps), ` +
+                  `${counts.touch} touch events`);
+      return;
+    }
+
+    console.log(`# seed ${seed}`);
+    console.log('kind,t_us,a,b,c,d,e,f');
+    for (const r of records(buf)) {
+      console.log([r.kind, r.t, ...r.fields].join(','));
+    }
+  } catch (e) {
+    console.error(`Error: ${e.message}`);
+    process.exit(1);
+  }
+}
+
+main();
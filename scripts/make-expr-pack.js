@@ -0,0 +1,106 @@
+#!/usr/bin/env node
+
+/**
+ * Expression Pack Builder for vizBot
+ *
+ * Usage:
+ *   node scripts/make-expr-pack.js expressions.json pack.bxp
+ *
+ * expressions.json is an array of poses using the BotExpression field names
+ * from bot_faces.h, plus a name (max 16 chars). Enums can be given by name:
+ *
+ *   [{ "name": "Wink", "eyeWhiteW": 50, "eyeWhiteH": 45, "eyeSpacing": 44,
+ *      "pupilRadius": 13, "browOffsetY": -12, "browLength": 30,
+ *      "browThickness": 6, "browVisible": true, "mouthType": "SMIRK",
+ *      "mouthWidth": 18, "mouthOffsetY": 62, "mouthCurve": 6,
+ *      "eyeMode": "NORMAL", "transitionMs": 300 }]
+ *
+ * Missing fields default to the neutral pose. Upload the .bxp from the
+ * web UI (Expression Pack) or with:
+ *   curl -F "pack=@pack.bxp" http://192.168.4.1/bot/pack
+ *
+ * Pack expressions follow the built-ins: the first one is index 20.
+ */
+
+const fs = require('fs');
+
+// Must match bot_expr_pack.h
+const PACK_VERSION = 1;
+const RECORD_SIZE = 48;
+const NAME_LEN = 16;
+const PACK_MAX = 1000;
+
+// Enum orders must match BotMouthType / BotEyeMode in bot_faces.h
+const MOUTH_TYPES = ['NONE', 'LINE', 'SMILE', 'FROWN', 'OPEN_O', 'GRIN', 'WAVY', 'SMIRK'];
+const EYE_MODES = ['NORMAL', 'CARET', 'HEART', 'X', 'SPIRAL', 'STAR', 'CLOSED'];
+
+// EXPR_NEUTRAL
+const NEUTRAL = {
+  eyeWhiteW: 50, eyeWhiteH: 45, eyeSpacing: 44,
+  pupilRadius: 13, pupilOffsetX: 0, pupilOffsetY: 0,
+  browOffsetY: -12, browLength: 30, browThickness: 6,
+  browAngleL: 0, browAngleR: 0, browVisible: true,
+  mouthType: 'SMILE', mouthWidth: 18, mouthOffsetY: 62, mouthCurve: 6,
+  eyeMode: 'NORMAL', transitionMs: 300
+};
+
+function enumValue(value, names, field, name) {
+  if (typeof value === 'number') return value;
+  const idx = names.indexOf(String(value).toUpperCase().replace(/^(MOUTH|EYE)_/, ''));
+  if (idx < 0) throw new Error(`${name}: unknown ${field} "${value}" (${names.join(', ')})`);
+  return idx;
+}
+
+function writeRecord(buf, offset, expr) {
+  const e = Object.assign({}, NEUTRAL, expr);
+  const name = String(e.name || '');
+  if (name.length === 0) throw new Error('Every expression needs a name');
+  if (name.length > NAME_LEN) throw new Error(`${name}: name longer than ${NAME_LEN} chars`);
+
+  let o = offset;
+  for (const f of ['eyeWhiteW', 'eyeWhiteH', 'eyeSpacing',
+                   'pupilRadius', 'pupilOffsetX', 'pupilOffsetY',
+                   'browOffsetY', 'browLength', 'browThickness']) {
+    buf.writeInt16LE(e[f], o); o += 2;
+  }
+  buf.writeInt8(e.browAngleL, o++);
+  buf.writeInt8(e.browAngleR, o++);
+  buf.writeUInt8(e.browVisible ? 1 : 0, o++);
+  buf.writeUInt8(enumValue(e.mouthType, MOUTH_TYPES, 'mouthType', name), o++);
+  for (const f of ['mouthWidth', 'mouthOffsetY', 'mouthCurve']) {
+    buf.writeInt16LE(e[f], o); o += 2;
+  }
+  buf.writeUInt8(enumValue(e.eyeMode, EYE_MODES, 'eyeMode', name), o++);
+  buf.writeUInt8(0, o++);  // reserved
+  buf.writeUInt16LE(e.transitionMs, o); o += 2;
+  buf.write(name, o, NAME_LEN, 'ascii');  // Rest stays NUL
+}
+
+function main() {
+  const args = process.argv.slice(2);
+  if (args.length < 2) {
+    console.log('Usage: node scripts/make-expr-pack.js expressions.json pack.bxp');
+    process.exit(1);
+  }
+
+  try {
+    const list = JSON.parse(fs.readFileSync(args[0], 'utf8'));
+    if (!Array.isArray(list)) throw new Error('Expected a JSON array of expressions');
+    if (list.length > PACK_MAX) throw new Error(`At most ${PACK_MAX} expressions per pack`);
+
+    const buf = Buffer.alloc(8 + list.length * RECORD_SIZE);
+    buf.write('BXP1', 0, 'ascii');
+    buf.writeUInt8(PACK_VERSION, 4);
+    buf.writeUInt8(RECORD_SIZE, 5);
+    buf.writeUInt16LE(list.length, 6);
+    list.forEach((expr, i) => writeRecord(buf, 8 + i * RECORD_SIZE, expr));
+
+    fs.writeFileSync(args[1], buf);
+    console.log(`Wrote ${list.length} expressions (${buf.length} bytes) to ${args[1]}`);
+  } catch (e) {
+    console.error(`Error: ${e.message}`);
+    process.exit(1);
+  }
+}
+
+main();
@@ -0,0 +1,140 @@
+#ifndef BOT_HOST_H
+#define BOT_HOST_H
+
+// ============================================================================
+// Bot host — vizpow's loop for motion and bot mode without the hardware
+// ============================================================================
+// Builds on motion_host.h with the rest of what a loop pass does to the
+// modes the host can drive: handleGestures() on the gesture queue (shake-N
+// mode changes with their flash, the bot's reactions), switchMode() with
+// the bot's entry and exit, applyTraceFrame(), and the mode's frame. Bot
+// frames record into botDL and are pushed band by band to the shim panel
+// (the presenter flushes inline here), with botHashBands on so every frame
+// can be checked by botPanelHash(), and the panel can be checked against a
+// full rasterization of the list. Ambient and emoji frames are not run.
+// ============================================================================
+
+#include "motion_host.h"
+#include "display_lcd.h"
+#include "bot_mode.h"
+
+#define MODE_FLASH_MS 100
+
+uint8_t currentMode = MODE_MOTION;
+uint8_t effectIndex = 0;
+uint8_t paletteIndex = 0;
+bool menuVisible = false;
+unsigned long lastModeChange = 0;
+unsigned long modeFlashStart = 0;
+bool modeFlashOn = false;
+uint8_t effectShuffleBag[16];
+
+void hostBotBegin() {
+  hostMotionBegin();
+  initLCD();
+  botPack.begin(false);     // Built-in expressions and sayings only
+  botSayings.begin(false);
+  botHashBands = true;
+}
+
+// vizpow.ino resetEffectShuffle(): same random() draws, so the bot's
+// sayings and timings after a mode change match the device
+void hostResetEffectShuffle() {
+  uint8_t size = (currentMode == MODE_MOTION) ? NUM_MOTION_EFFECTS : NUM_AMBIENT_EFFECTS;
+  for (uint8_t i = 0; i < size; i++) effectShuffleBag[i] = i;
+  for (uint8_t i = size - 1; i > 0; i--) {
+    uint8_t j = random(i + 1);
+    uint8_t tmp = effectShuffleBag[i];
+    effectShuffleBag[i] = effectShuffleBag[j];
+    effectShuffleBag[j] = tmp;
+  }
+}
+
+// vizpow.ino switchMode()
+void hostSwitchMode(uint8_t nextMode) {
+  bool leavingBot = currentMode == MODE_BOT && nextMode != MODE_BOT;
+  bool enteringBot = nextMode == MODE_BOT && currentMode != MODE_BOT;
+  if (leavingBot) exitBotMode();
+  currentMode = nextMode;
+  effectIndex = 0;
+  hostResetEffectShuffle();
+  FastLED.clear();
+  if (enteringBot) enterBotMode();
+}
+
+void hostStartModeFlash() {
+  for (int i = 0; i < NUM_LEDS; i++) leds[i] = CRGB(50, 50, 50);
+  modeFlashStart = millis();
+  modeFlashOn = true;
+}
+
+bool hostModeFlashActive() {
+  if (!modeFlashOn) return false;
+  if (millis() - modeFlashStart < MODE_FLASH_MS) return true;
+  modeFlashOn = false;
+  FastLED.clear();
+  return false;
+}
+
+// vizpow.ino handleGestures(); each event is also handed to `seen` (may be
+// null) so the replayer can list them
+void hostHandleGestures(void (*seen)(const GestureEvent &)) {
+  GestureEvent ev;
+  while (imuGestures.pop(ev)) {
+    if (seen) seen(ev);
+    switch (ev.type) {
+      case GEST_SHAKE_N:
+        if (millis() - lastModeChange < SHAKE_COOLDOWN_MS) break;
+        hostSwitchMode((currentMode + 1) % NUM_MODES);
+        lastModeChange = millis();
+        hostStartModeFlash();
+        break;
+      default:
+        if (currentMode == MODE_BOT) botHandleGesture(ev);
+        break;
+    }
+  }
+}
+
+// vizpow.ino applyTraceFrame(), from the recorded frame or the recorder's script
+void hostApplyFrame(uint8_t mode, uint8_t effect, uint8_t palette) {
+  if (mode != currentMode && mode < NUM_MODES) hostSwitchMode(mode);
+  effectIndex = effect;
+  if (palette != paletteIndex && palette < NUM_PALETTES) {
+    paletteIndex = palette;
+    currentPalette = palettes[paletteIndex];
+  }
+}
+
+// The mode's frame as the loop runs it; false for modes the host doesn't drive
+bool hostModeFrame() {
+  if (hostModeFlashActive()) return true;
+  switch (currentMode) {
+    case MODE_MOTION:
+      if (effectIndex >= NUM_MOTION_EFFECTS) return false;
+      hostMotionFrame(effectIndex);
+      return true;
+    case MODE_BOT:
+      if (botMode.initialized && accelPeak > 1.3f) botMode.registerInteraction();
+      runBotMode();
+      return true;
+    default:
+      return false;
+  }
+}
+
+// The shim panel holds exactly what a full rasterization of botDL gives,
+// i.e. the bands skipped as unchanged really were
+bool hostPanelMatchesList() {
+  static uint16_t full[LCD_WIDTH * LCD_HEIGHT];
+  botDL.rasterize(full, 0, LCD_HEIGHT);
+  return memcmp(full, gfx->pixels(), sizeof(full)) == 0;
+}
+
+// vizpow.ino traceFrameHash(): the panel in bot mode, leds[] otherwise
+uint32_t hostFrameHash() {
+  if (currentMode == MODE_BOT) return botPanelHash();
+  return hostLedHash();
+}
+
+#endif // BOT_HOST_H
@@ -0,0 +1,31 @@
+# Run both bot_mouth_masks builds and fail on the first frame that differs
+
+execute_process(COMMAND ${NEW} OUTPUT_VARIABLE newOut RESULT_VARIABLE newRc)
+execute_process(COMMAND ${REFERENCE} OUTPUT_VARIABLE refOut RESULT_VARIABLE refRc)
+if(NOT newRc EQUAL 0 OR NOT refRc EQUAL 0)
+  message(FATAL_ERROR "mask run failed (new ${newRc}, reference ${refRc})\n${newOut}${refOut}")
+endif()
+
+string(REPLACE "\n" ";" newLines "${newOut}")
+string(REPLACE "\n" ";" refLines "${refOut}")
+list(LENGTH newLines count)
+list(LENGTH refLines refCount)
+if(NOT count EQUAL refCount)
+  message(FATAL_ERROR "case count differs: new ${count}, reference ${refCount}")
+endif()
+
+set(mismatches 0)
+math(EXPR last "${count} - 1")
+foreach(i RANGE ${last})
+  list(GET newLines ${i} a)
+  list(GET refLines ${i} b)
+  if(NOT a STREQUAL b)
+    message("mismatch: new '${a}' reference '${b}'")
+    math(EXPR mismatches "${mismatches} + 1")
+  endif()
+endforeach()
+
+if(mismatches GREATER 0)
+  message(FATAL_ERROR "${mismatches} of ${count} masks differ")
+endif()
+message("${count} masks identical")
@@ -0,0 +1,144 @@
+// ============================================================================
+// Bot mouth masks — DL_ARC / DL_CURVE against the per-column fillCircle sweep
+// ============================================================================
+// Built twice from this file. The plain build renders faces with the real
+// display list. With BOT_REFERENCE_SWEEP, fillArc and fillCurve are swapped
+// for the sweep they replaced: the old float formulas for the curve rows,
+// every stroke circle first, then every fill circle. Each build prints one
+// "case hash" line per full rasterized frame, and bot_mouth_masks.cmake
+// checks that the two outputs match line for line.
+//
+// Cases: every eye mode x mouth type x brow angle, with and without the
+// ambient stroke, then a width/curve sweep of each arc and curve mouth.
+// ============================================================================
+
+#include <Arduino.h>
+#include "config.h"
+#include "bot_display_list.h"
+
+#ifdef BOT_REFERENCE_SWEEP
+
+struct RefDL : BotDisplayList {
+  // Old smile/frown/grin: y = curve * t^2, t = x / w, truncated. Old smirk:
+  // y = curve * ((t + 1) / 2)^2 with the vertex moved to the left corner.
+  void fillArc(int16_t vx2, int16_t vy, int16_t k16, int16_t /*d2*/, int16_t xa, int16_t xb,
+               uint8_t r, uint16_t color, uint8_t stroke = 0, uint16_t strokeColor = 0) {
+    int16_t cx = (xa + xb) / 2, w = (xb - xa) / 2;
+    int16_t curve = k16 / 16;
+    bool smirk = (vx2 != xa + xb);
+    int16_t ys[2 * 60 + 1];
+    for (int16_t x = -w; x <= w; x++) {
+      float t = (float)x / w;
+      int16_t y;
+      if (smirk) {
+        float normalized = (t + 1.0f) / 2.0f;
+        y = (int16_t)(curve * normalized * normalized);
+      } else if (curve < 0) {
+        y = -(int16_t)(-curve * t * t);
+      } else {
+        y = (int16_t)(curve * t * t);
+      }
+      ys[x + w] = vy + y;
+    }
+    if (stroke) {
+      for (int16_t x = -w; x <= w; x++) BotDisplayList::fillCircle(cx + x, ys[x + w], r + stroke, strokeColor);
+    }
+    for (int16_t x = -w; x <= w; x++) BotDisplayList::fillCircle(cx + x, ys[x + w], r, color);
+  }
+
+  void fillCurve(int16_t x0, int16_t y, const int8_t *dy, uint8_t n, uint8_t r,
+                 uint16_t color, uint8_t stroke = 0, uint16_t strokeColor = 0) {
+    if (stroke) {
+      for (uint8_t i = 0; i < n; i++) BotDisplayList::fillCircle(x0 + i, y + dy[i], r + stroke, strokeColor);
+    }
+    for (uint8_t i = 0; i < n; i++) BotDisplayList::fillCircle(x0 + i, y + dy[i], r, color);
+  }
+};
+
+RefDL refDL;
+#define botDL refDL
+
+#endif // BOT_REFERENCE_SWEEP
+
+#include "bot_sprites.h"
+#include "bot_eyes.h"
+
+float accelX = 0, accelY = 0, accelZ = 1.0f;
+uint8_t botBackgroundStyle = 0;
+
+void botReadExpression(uint16_t index, BotExpression &out) {
+  memcpy_P(&out, &botExpressions[index % BOT_NUM_EXPRESSIONS], sizeof(BotExpression));
+}
+
+static uint16_t frame[LCD_WIDTH * LCD_HEIGHT];
+static uint16_t failures = 0;
+
+// Render one face into a full frame and print its hash
+static void renderCase(const char *name, BotFaceState &face) {
+  prevFrame.invalidate();
+  botSprites.beginFrame();
+  botDL.clear();
+  botDL.fillScreen(0x0841);
+  renderBotFace(face, 0x0841);
+  if (botDL.dropped) {
+    printf("%s dropped %u ops\n", name, botDL.dropped);
+    botDL.dropped = 0;
+    failures++;
+  }
+  for (int16_t y = 0; y < LCD_HEIGHT; y += BOT_BAND_ROWS) {
+    botDL.rasterize(&frame[(uint32_t)y * LCD_WIDTH], y, BOT_BAND_ROWS);
+  }
+  uint32_t h = 2166136261UL;
+  const uint8_t *bytes = (const uint8_t *)frame;
+  for (uint32_t i = 0; i < sizeof(frame); i++) h = (h ^ bytes[i]) * 16777619UL;
+  printf("%s %08x\n", name, (unsigned)h);
+}
+
+int main() {
+  static const int8_t browAngles[] = { -30, -15, 0, 15, 30 };
+  char name[64];
+  BotFaceState face = {};
+
+  // Every eye mode x mouth type x brow angle, stroke off and on
+  for (uint8_t stroke = 0; stroke < 2; stroke++) {
+    botBackgroundStyle = stroke ? 4 : 0;
+    for (uint8_t eye = EYE_NORMAL; eye <= EYE_CLOSED; eye++) {
+      for (uint8_t mouth = MOUTH_NONE; mouth <= MOUTH_SMIRK; mouth++) {
+        for (int8_t angle : browAngles) {
+          BotExpression e;
+          botReadExpression(EXPR_NEUTRAL, e);
+          face.apply(e);
+          face.eyeMode = (BotEyeMode)eye;
+          face.mouthType = (BotMouthType)mouth;
+          face.browAngleL = angle;
+          face.browAngleR = -angle;
+          face.browVisible = true;
+          snprintf(name, sizeof(name), "face/s%u/e%u/m%u/b%d", stroke, eye, mouth, angle);
+          renderCase(name, face);
+        }
+      }
+    }
+  }
+
+  // Arc and curve mouths across widths and curves
+  static const BotMouthType sweep[] = { MOUTH_SMILE, MOUTH_FROWN, MOUTH_GRIN, MOUTH_WAVY, MOUTH_SMIRK };
+  for (uint8_t stroke = 0; stroke < 2; stroke++) {
+    botBackgroundStyle = stroke ? 4 : 0;
+    for (BotMouthType mouth : sweep) {
+      for (int16_t w = 10; w <= 28; w += 3) {
+        for (int16_t c = 4; c <= 14; c += 2) {
+          BotExpression e;
+          botReadExpression(EXPR_NEUTRAL, e);
+          face.apply(e);
+          face.mouthType = mouth;
+          face.mouthWidth = w;
+          face.mouthCurve = c;
+          snprintf(name, sizeof(name), "mouth/s%u/m%u/w%d/c%d", stroke, mouth, w, c);
+          renderCase(name, face);
+        }
+      }
+    }
+  }
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,131 @@
+// ============================================================================
+// IMU FIFO ring — lagging consumers against 32-sample drains
+// ============================================================================
+// Samples go in through ImuFifo::service() from the driver shim, each one
+// tagged with its index in every field, so a sample read back can be checked
+// for its position and for a torn copy.
+//  - A consumer left behind by full-FIFO drains resumes IMU_RING_SAFE behind
+//    head, outside the slots the next drain writes, and counts the rest as
+//    skipped.
+//  - Drains of 32-64 samples land in the middle of a read() (through the
+//    IMU_FIFO_READ_HOOK seam), as the bus task's can while the render core
+//    copies a slot: a lapped copy is dropped, never returned.
+// ============================================================================
+
+#include <Arduino.h>
+
+// Drains queued here land in the next read() between its head load and its
+// copy, as if the bus task had raced it
+static uint16_t hookSamples = 0;
+static void readHook();
+#define IMU_FIFO_READ_HOOK() readHook()
+
+#include "config.h"
+#include "imu_fifo.h"
+
+static SensorQMI8658 imu;
+static uint16_t failures = 0;
+
+static void check(bool ok, const char *name) {
+  printf("%s %s\n", ok ? "ok  " : "FAIL", name);
+  if (!ok) failures++;
+}
+
+// One drain of `n` samples with indices from imuFifo.head
+static void drain(uint16_t n) {
+  for (uint16_t i = 0; i < n; i++) {
+    float v = (float)(imuFifo.head + i);
+    imu.hostAcc[i] = { v, v, v };
+    imu.hostGyr[i] = { v, v, v };
+  }
+  imu.hostCount = n;
+  hostClockUs += (uint64_t)n * imuFifo.periodUs;
+  imuFifoPending = true;
+  imuFifo.service(imu);
+}
+
+// The sample holds index `want` in every field
+static bool intact(const ImuSample &s, uint32_t want) {
+  float v = (float)want;
+  return s.ax == v && s.ay == v && s.az == v && s.gx == v && s.gy == v && s.gz == v;
+}
+
+static void readHook() {
+  while (hookSamples > 0) {
+    uint16_t n = hookSamples < IMU_FIFO_DEPTH ? hookSamples : IMU_FIFO_DEPTH;
+    hookSamples -= n;
+    drain(n);
+  }
+}
+
+static void reset() {
+  imuFifo = {};
+  imuFifo.begin(imu, -1, true);
+}
+
+// A consumer two full drains behind resumes at head - IMU_RING_SAFE
+static void lagAfterFullDrains() {
+  reset();
+  uint32_t cursor = 0;
+  drain(IMU_FIFO_DEPTH);
+  drain(IMU_FIFO_DEPTH);
+  uint32_t head = imuFifo.head;
+  ImuSample s;
+  bool ok = imuFifo.read(cursor, s) && intact(s, head - IMU_RING_SAFE) &&
+            imuFifo.skipped == head - IMU_RING_SAFE;
+  uint32_t want = head - IMU_RING_SAFE + 1;
+  while (ok && imuFifo.read(cursor, s)) ok = intact(s, want++);
+  check(ok && want == head && cursor == head, "two full drains: resume IMU_RING_SAFE behind");
+}
+
+// For every lag up to a lap and a half, whatever read() returns first is
+// outside the slots one more 32-sample drain would overwrite
+static void lagClearOfNextDrain() {
+  bool ok = true;
+  for (uint32_t lag = 1; lag <= IMU_RING_SIZE + IMU_RING_SIZE / 2 && ok; lag++) {
+    reset();
+    drain(IMU_FIFO_DEPTH);  // Reader starts here
+    uint32_t cursor = imuFifo.head;
+    for (uint32_t left = lag; left > 0;) {
+      uint16_t n = left < IMU_FIFO_DEPTH ? left : IMU_FIFO_DEPTH;
+      drain(n);
+      left -= n;
+    }
+    uint32_t head = imuFifo.head;
+    ImuSample s;
+    ok = imuFifo.read(cursor, s);
+    uint32_t index = cursor - 1;
+    ok = ok && intact(s, index) && index + IMU_RING_SIZE >= head + IMU_FIFO_DEPTH &&
+         imuFifo.skipped == (lag > IMU_RING_SAFE ? lag - IMU_RING_SAFE : 0);
+    if (!ok) printf("  lag %u: read index %u with head %u\n", lag, index, head);
+  }
+  check(ok, "any lag: first read clear of the next drain");
+}
+
+// Drains that land between read()'s head load and its copy, as the bus task
+// can while the render core reads: the copy must be dropped if its slot was
+// lapped, and the sample returned must still be whole and in position
+static void drainsDuringRead() {
+  bool ok = true;
+  for (uint32_t lag = 1; lag <= IMU_RING_SAFE && ok; lag++) {
+    for (uint16_t burst = IMU_FIFO_DEPTH; burst <= 2 * IMU_FIFO_DEPTH && ok; burst += 8) {
+      reset();
+      drain(IMU_FIFO_DEPTH);
+      uint32_t cursor = imuFifo.head;
+      drain(lag);
+      hookSamples = burst;
+      ImuSample s;
+      ok = imuFifo.read(cursor, s) && intact(s, cursor - 1);
+      if (!ok) printf("  lag %u, %u samples mid-read: read index %u, ax %.0f\n", lag, burst,
+                      cursor - 1, s.ax);
+    }
+  }
+  check(ok, "drains mid-read: lapped copies are dropped");
+}
+
+int main() {
+  lagAfterFullDrains();
+  lagClearOfNextDrain();
+  drainsDuringRead();
+  return failures ? 1 : 0;
+}
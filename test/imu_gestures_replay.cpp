@@ -0,0 +1,193 @@
+// ============================================================================
+// IMU gestures — synthetic 250Hz traces through ImuGestures::process()
+// ============================================================================
+// Each trace starts flat and at rest (accel 0, 0, 1g), steps into a gesture
+// at a known sample, and checks which events come out and at which sample.
+// The expected indices follow from the filter constants in imu_gestures.h:
+//  - |accel| smoothing (alpha 1/3 at 4ms) needs two 3g samples to pass
+//    SHAKE_THRESHOLD, then the stroke has to last GEST_SHAKE_MIN_US.
+//  - the gravity estimate (alpha 4/104) takes 54 samples to cross
+//    GEST_FLIP_Z after a flip and 39 to cross GEST_TILT_ON at 45 degrees;
+//    the hold times run from there.
+// ============================================================================
+
+#include <Arduino.h>
+#include "config.h"
+#include "imu_gestures.h"
+
+#define SAMPLE_US   4000        // 250Hz
+#define TRACE_T0    1000000     // First sample time, unless a case moves it
+
+struct Expected {
+  uint8_t type;
+  uint16_t startIndex;          // Sample the gesture began
+  uint16_t index;               // Sample it was recognized
+};
+
+// One accel value per sample; a step function of segments
+struct Segment {
+  uint16_t from;                // First sample index
+  float ax, ay, az;
+};
+
+static const char *gestureName(uint8_t type) {
+  static const char *names[] = { "SHAKE", "SHAKE_N", "TAP", "DOUBLE_TAP", "FACE_DOWN",
+                                 "FACE_UP", "TILT_RIGHT", "TILT_LEFT", "TILT_FORWARD",
+                                 "TILT_BACK" };
+  return type < sizeof(names) / sizeof(names[0]) ? names[type] : "?";
+}
+
+static uint16_t failures = 0;
+static uint32_t traceT0 = TRACE_T0;
+
+static uint32_t sampleUs(uint16_t i) {
+  return traceT0 + (uint32_t)i * SAMPLE_US;
+}
+
+// Replay `n` samples built from `segs` and compare the events
+static void replay(const char *name, const Segment *segs, uint8_t nSegs, uint16_t n,
+                   const Expected *want, uint8_t nWant) {
+  imuGestures = {};
+  uint8_t got = 0;
+  bool ok = true;
+  uint8_t seg = 0;
+  for (uint16_t i = 0; i < n; i++) {
+    while (seg + 1 < nSegs && segs[seg + 1].from <= i) seg++;
+    ImuSample s = {};
+    s.us = sampleUs(i);
+    s.ax = segs[seg].ax; s.ay = segs[seg].ay; s.az = segs[seg].az;
+    imuGestures.process(s);
+
+    GestureEvent ev;
+    while (imuGestures.pop(ev)) {
+      // Events come out on the sample that completes them
+      bool match = got < nWant && ev.type == want[got].type && i == want[got].index &&
+                   ev.us == s.us && ev.startUs == sampleUs(want[got].startIndex);
+      if (!match) {
+        printf("  %s: unexpected %s at sample %u (started %d)\n", name, gestureName(ev.type),
+               i, (int)((int32_t)(ev.startUs - traceT0) / SAMPLE_US));
+        ok = false;
+      }
+      got++;
+    }
+  }
+  if (got < nWant) {
+    printf("  %s: %u of %u events fired, missing %s at sample %u\n", name, got, nWant,
+           gestureName(want[got].type), want[got].index);
+    ok = false;
+  }
+  printf("%s %s\n", ok ? "ok  " : "FAIL", name);
+  if (!ok) failures++;
+}
+
+int main() {
+  // Three 60ms strokes at 3g, 200ms apart: SHAKE two samples in plus
+  // GEST_SHAKE_MIN_US (9 samples), SHAKE_N on the third. The spikes that
+  // come with the strokes must not be reported as taps.
+  {
+    static const Segment segs[] = {
+      { 0, 0, 0, 1 }, { 100, 0, 0, 3 }, { 115, 0, 0, 1 }, { 150, 0, 0, 3 },
+      { 165, 0, 0, 1 }, { 200, 0, 0, 3 }, { 215, 0, 0, 1 } };
+    static const Expected want[] = {
+      { GEST_SHAKE, 101, 110 }, { GEST_SHAKE, 151, 160 },
+      { GEST_SHAKE, 201, 210 }, { GEST_SHAKE_N, 101, 210 } };
+    replay("shake", segs, 7, 500, want, 4);
+  }
+
+  // Two strokes are a SHAKE each but not a SHAKE_N
+  {
+    static const Segment segs[] = {
+      { 0, 0, 0, 1 }, { 100, 0, 0, 3 }, { 115, 0, 0, 1 }, { 150, 0, 0, 3 },
+      { 165, 0, 0, 1 } };
+    static const Expected want[] = { { GEST_SHAKE, 101, 110 }, { GEST_SHAKE, 151, 160 } };
+    replay("shake-two-strokes", segs, 5, 500, want, 2);
+  }
+
+  // A one-sample 1.5g knock. The spike ends on the next sample; TAP is
+  // reported once GEST_DOUBLE_TAP_US has passed after that (76 samples).
+  {
+    static const Segment segs[] = { { 0, 0, 0, 1 }, { 100, 1.5f, 0, 1 }, { 101, 0, 0, 1 } };
+    static const Expected want[] = { { GEST_TAP, 100, 177 } };
+    replay("tap", segs, 3, 400, want, 1);
+  }
+
+  // Two knocks 200ms apart: DOUBLE_TAP when the second spike ends, no TAP
+  {
+    static const Segment segs[] = {
+      { 0, 0, 0, 1 }, { 100, 1.5f, 0, 1 }, { 101, 0, 0, 1 }, { 150, 0, 1.5f, 1 },
+      { 151, 0, 0, 1 } };
+    static const Expected want[] = { { GEST_DOUBLE_TAP, 100, 151 } };
+    replay("double-tap", segs, 5, 400, want, 1);
+  }
+
+  // Knocks 400ms apart are two single taps
+  {
+    static const Segment segs[] = {
+      { 0, 0, 0, 1 }, { 100, 1.5f, 0, 1 }, { 101, 0, 0, 1 }, { 200, 1.5f, 0, 1 },
+      { 201, 0, 0, 1 } };
+    static const Expected want[] = { { GEST_TAP, 100, 177 }, { GEST_TAP, 200, 277 } };
+    replay("tap-tap", segs, 5, 400, want, 2);
+  }
+
+  // Face down at sample 100 and back up at 400: gravity z passes -0.75g at
+  // 153 and -0.375g at 409, each held GEST_FLIP_HOLD_US (100 samples)
+  {
+    static const Segment segs[] = { { 0, 0, 0, 1 }, { 100, 0, 0, -1 }, { 400, 0, 0, 1 } };
+    static const Expected want[] = { { GEST_FACE_DOWN, 153, 253 }, { GEST_FACE_UP, 409, 509 } };
+    replay("flip", segs, 3, 700, want, 2);
+  }
+
+  // Face down for less than the hold time fires nothing
+  {
+    static const Segment segs[] = { { 0, 0, 0, 1 }, { 100, 0, 0, -1 }, { 200, 0, 0, 1 } };
+    replay("flip-short", segs, 3, 600, nullptr, 0);
+  }
+
+  // 45 degree tilts: gravity crosses GEST_TILT_ON at sample 138, then
+  // GEST_TILT_HOLD_US (150 samples). One event per held tilt.
+  {
+    static const float h = 0.70710678f;
+    static const Segment right[] = { { 0, 0, 0, 1 }, { 100, h, 0, h } };
+    static const Expected wantRight[] = { { GEST_TILT_RIGHT, 138, 288 } };
+    replay("tilt-right", right, 2, 800, wantRight, 1);
+
+    static const Segment back[] = { { 0, 0, 0, 1 }, { 100, 0, -h, h } };
+    static const Expected wantBack[] = { { GEST_TILT_BACK, 138, 288 } };
+    replay("tilt-back", back, 2, 800, wantBack, 1);
+  }
+
+  // A tilt let go before the hold time fires nothing
+  {
+    static const float h = 0.70710678f;
+    static const Segment segs[] = { { 0, 0, 0, 1 }, { 100, -h, 0, h }, { 250, 0, 0, 1 } };
+    replay("tilt-short", segs, 3, 600, nullptr, 0);
+  }
+
+  // micros() wraps every 71 minutes: a stroke or flip that starts on
+  // timestamp 0 counts like any other
+  {
+    static const Segment segs[] = {
+      { 0, 0, 0, 1 }, { 100, 0, 0, 3 }, { 115, 0, 0, 1 }, { 150, 0, 0, 3 },
+      { 165, 0, 0, 1 }, { 200, 0, 0, 3 }, { 215, 0, 0, 1 } };
+    static const Expected want[] = {
+      { GEST_SHAKE, 101, 110 }, { GEST_SHAKE, 151, 160 },
+      { GEST_SHAKE, 201, 210 }, { GEST_SHAKE_N, 101, 210 } };
+    traceT0 = 0u - 101 * SAMPLE_US;
+    replay("shake-at-wrap", segs, 7, 500, want, 4);
+  }
+  {
+    static const Segment segs[] = { { 0, 0, 0, 1 }, { 100, 0, 0, -1 }, { 400, 0, 0, 1 } };
+    static const Expected want[] = { { GEST_FACE_DOWN, 153, 253 }, { GEST_FACE_UP, 409, 509 } };
+    traceT0 = 0u - 153 * SAMPLE_US;
+    replay("flip-at-wrap", segs, 3, 700, want, 2);
+    traceT0 = TRACE_T0;
+  }
+
+  // At rest nothing fires
+  {
+    static const Segment segs[] = { { 0, 0, 0, 1 } };
+    replay("rest", segs, 1, 2000, nullptr, 0);
+  }
+
+  return failures ? 1 : 0;
+}
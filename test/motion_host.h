@@ -0,0 +1,76 @@
+#ifndef MOTION_HOST_H
+#define MOTION_HOST_H
+
+// ============================================================================
+// Motion host — vizpow's input and motion-effect path without the hardware
+// ============================================================================
+// Shared by the host trace replayer and the latency step test. It holds the
+// globals the effects expect from vizpow.ino and mirrors the parts of the
+// loop that matter for motion mode: readIMU() feeding gestures and the
+// orientation filter through inputTrace's sample seam, and a frame that
+// brackets runMotionEffect() with the latency probe. Synthetic samples go
+// in through imuFifo's ring, as if the bus task had drained them.
+// ============================================================================
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "config.h"
+#include "palettes.h"
+#include "imu_fifo.h"
+#include "imu_orientation.h"
+#include "imu_gestures.h"
+#include "latency_probe.h"
+#include "input_trace.h"
+#include "effects_motion.h"
+
+CRGB leds[NUM_LEDS];
+CRGBPalette16 currentPalette;
+float accelX = 0, accelY = 0, accelZ = 0;
+float accelPeak = 0;
+uint32_t imuCursor = 0;
+
+void hostMotionBegin() {
+  FastLED.attach(leds, NUM_LEDS);
+  FastLED.clear();
+  currentPalette = palettes[0];
+  imuFifo.periodUs = IMU_FIFO_PERIOD_6DOF_US;
+}
+
+// Append one sample to imuFifo as a drain would
+void hostPushSample(const ImuSample &s) {
+  imuFifo.ring[imuFifo.head % IMU_RING_SIZE] = s;
+  __atomic_store_n(&imuFifo.head, imuFifo.head + 1, __ATOMIC_RELEASE);
+}
+
+// vizpow.ino readIMU() with the gyro on; returns the samples read
+uint16_t hostReadIMU() {
+  ImuSample s;
+  uint16_t n = 0;
+  float peak = 0;
+  while (inputTrace.nextSample(imuFifo, imuCursor, s)) {
+    imuGestures.process(s);
+    accelX = s.ax; accelY = s.ay; accelZ = s.az;
+    imuOrient.feed(s, true);
+    peak = max(peak, sqrtf(s.ax * s.ax + s.ay * s.ay + s.az * s.az));
+    n++;
+  }
+  if (n) {
+    accelPeak = peak;
+    if (!inputTrace.playing) latencyProbe.input(s.us);
+  }
+  return n;
+}
+
+// One motion frame as the loop runs it (showDisplay() is instant here)
+void hostMotionFrame(uint8_t effect) {
+  latencyProbe.beginFrame();
+  runMotionEffect(effect);
+  latencyProbe.evaluated();
+  latencyProbe.shown(effect);
+}
+
+uint32_t hostLedHash() {
+  return traceHash((const uint8_t *)leds, sizeof(leds));
+}
+
+#endif // MOTION_HOST_H
@@ -0,0 +1,147 @@
+// ============================================================================
+// Motion latency steps — frames from an input step to a change on the LEDs
+// ============================================================================
+// Each motion effect runs at 50fps on 224Hz samples from rest (flat, still),
+// then gets the input step it reacts to: a 30 degree tilt toward +Y, a
+// 200dps spin about Z, or a 2.5g jolt. The same run without the step is the
+// baseline, since most effects animate on their own; the response is the
+// first frame whose leds[] differ from it. Frame 0 is the first frame whose
+// readIMU() can see the step, so a count of 0 means the LEDs answer on it.
+//
+// Each run happens in a forked child so the effects' static state starts
+// fresh. The latency probe brackets every frame, and its motion-to-photon
+// figure for the response frame is printed next to the frame count.
+// ============================================================================
+
+#include <unistd.h>
+#include <sys/wait.h>
+#include <Arduino.h>
+#include "motion_host.h"
+
+#define STEP_FRAME_US       20000   // 50fps (speed 20)
+#define STEP_SETTLE_FRAMES  50      // Rest before the step
+#define STEP_RUN_FRAMES     40      // Frames compared after it
+#define STEP_MAX_FRAMES     2       // Slowest acceptable response
+
+enum StepKind : uint8_t { STEP_TILT, STEP_SPIN, STEP_JOLT };
+
+struct StepCase {
+  uint8_t effect;
+  StepKind kind;
+};
+
+static const StepCase cases[NUM_MOTION_EFFECTS] = {
+  { 0, STEP_TILT },   // tiltBall
+  { 1, STEP_SPIN },   // motionPlasma
+  { 2, STEP_JOLT },   // shakeSparkle
+  { 3, STEP_TILT },   // tiltWave
+  { 4, STEP_TILT },   // tiltRipple
+  { 5, STEP_SPIN },   // gyroSwirl
+  { 6, STEP_JOLT },   // shakeExplode
+};
+
+static const char *stepNames[] = { "tilt 30deg", "spin 200dps", "jolt 2.5g" };
+
+struct RunResult {
+  uint32_t hash[STEP_RUN_FRAMES];
+  uint32_t m2pUs[STEP_RUN_FRAMES];   // Probe's motion-to-photon latency per frame
+};
+
+// The step lands half a frame before the first frame that reads it
+static const uint32_t stepUs = STEP_SETTLE_FRAMES * STEP_FRAME_US - STEP_FRAME_US / 2;
+
+static void sampleAt(uint32_t t, bool stepped, StepKind kind, ImuSample &s) {
+  s = {};
+  s.us = t;
+  s.az = 1.0f;
+  if (!stepped || t < stepUs) return;
+  switch (kind) {
+    case STEP_TILT:
+      s.ay = 0.5f;          // sin 30, about X (flat reads as a lean along +X)
+      s.az = 0.8660254f;    // cos 30
+      break;
+    case STEP_SPIN:
+      s.gz = 200.0f;
+      break;
+    case STEP_JOLT:
+      s.ax = 2.3f;          // |a| = 2.5g with gravity
+      break;
+  }
+}
+
+// Run one effect (with or without the step) and keep the frames after it
+static void run(const StepCase &c, bool stepped, RunResult &out) {
+  hostMotionBegin();
+  uint32_t nextSampleUs = 0;
+  for (uint16_t f = 0; f < STEP_SETTLE_FRAMES + STEP_RUN_FRAMES; f++) {
+    hostClockUs = (uint64_t)f * STEP_FRAME_US;
+    while (nextSampleUs <= hostClockUs) {
+      ImuSample s;
+      sampleAt(nextSampleUs, stepped, c.kind, s);
+      hostPushSample(s);
+      nextSampleUs += imuFifo.periodUs;
+    }
+    hostReadIMU();
+    hostMotionFrame(c.effect);
+    if (f < STEP_SETTLE_FRAMES) continue;
+    uint16_t i = f - STEP_SETTLE_FRAMES;
+    out.hash[i] = hostLedHash();
+    out.m2pUs[i] = micros() - latencyProbe.sampleUs;  // What shown() just binned
+  }
+}
+
+// run() in a child process, so effect statics start from scratch
+static bool runForked(const StepCase &c, bool stepped, RunResult &out) {
+  int fd[2];
+  if (pipe(fd) != 0) return false;
+  pid_t pid = fork();
+  if (pid < 0) return false;
+  if (pid == 0) {
+    close(fd[0]);
+    RunResult r = {};
+    run(c, stepped, r);
+    ssize_t n = write(fd[1], &r, sizeof(r));
+    _exit(n == (ssize_t)sizeof(r) ? 0 : 1);
+  }
+  close(fd[1]);
+  size_t got = 0;
+  uint8_t *dst = (uint8_t *)&out;
+  while (got < sizeof(out)) {
+    ssize_t n = read(fd[0], dst + got, sizeof(out) - got);
+    if (n <= 0) break;
+    got += n;
+  }
+  close(fd[0]);
+  int status = 0;
+  waitpid(pid, &status, 0);
+  return got == sizeof(out) && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+int main() {
+  uint16_t failures = 0;
+  for (const StepCase &c : cases) {
+    RunResult base, step;
+    if (!runForked(c, false, base) || !runForked(c, true, step)) {
+      printf("FAIL fx %u: run failed\n", c.effect);
+      failures++;
+      continue;
+    }
+    int16_t response = -1;
+    for (uint16_t i = 0; i < STEP_RUN_FRAMES; i++) {
+      if (step.hash[i] != base.hash[i]) {
+        response = i;
+        break;
+      }
+    }
+    bool ok = response >= 0 && response <= STEP_MAX_FRAMES;
+    if (response >= 0) {
+      printf("%s fx %u %-12s responds after %d frame(s), m2p %.1fms\n", ok ? "ok  " : "FAIL",
+             c.effect, stepNames[c.kind], response, step.m2pUs[response] / 1000.0);
+    } else {
+      printf("FAIL fx %u %-12s no response in %u frames\n", c.effect, stepNames[c.kind],
+             STEP_RUN_FRAMES);
+    }
+    if (!ok) failures++;
+  }
+  return failures ? 1 : 0;
+}
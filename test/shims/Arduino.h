@@ -0,0 +1,75 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// ============================================================================
+// Host shim for the Arduino core — just enough for the sketch headers
+// ============================================================================
+// Time comes from hostClockUs, which tests advance by hand, so runs are
+// deterministic. Serial output is dropped.
+// ============================================================================
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <ctype.h>
+#include <time.h>
+#include <algorithm>
+#include "freertos/FreeRTOS.h"
+
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define PI      3.1415926535897932384626433832795
+#define TWO_PI  6.283185307179586476925286766559
+#define HALF_PI 1.5707963267948966192313216916398
+
+#define LOW     0x0
+#define HIGH    0x1
+#define INPUT   0x01
+#define OUTPUT  0x03
+#define INPUT_PULLUP 0x05
+#define RISING  0x01
+#define FALLING 0x02
+#define digitalPinToInterrupt(p) (p)
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define pgm_read_byte(p)  (*(const uint8_t *)(p))
+#define pgm_read_word(p)  (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define memcpy_P memcpy
+#define strncpy_P strncpy
+
+extern uint64_t hostClockUs;
+
+inline unsigned long micros() { return (unsigned long)(uint32_t)hostClockUs; }
+inline unsigned long millis() { return (unsigned long)(uint32_t)(hostClockUs / 1000); }
+inline void delayMicroseconds(uint32_t us) { hostClockUs += us; }
+inline void delay(uint32_t ms) { hostClockUs += (uint64_t)ms * 1000; }
+
+inline void pinMode(int, int) {}
+inline int digitalRead(int) { return 0; }
+inline void digitalWrite(int, int) {}
+inline void analogWrite(int, int) {}
+inline void attachInterrupt(int, void (*)(), int) {}
+
+inline long random(long lo, long hi) { return hi > lo ? lo + rand() % (hi - lo) : lo; }
+inline long random(long hi) { return random(0, hi); }
+inline void randomSeed(unsigned long seed) { if (seed) srand(seed); }
+inline uint32_t esp_random() { return 0x2545F491; }  // Fixed, so host runs repeat
+inline bool getLocalTime(struct tm *, uint32_t = 5000) { return false; }  // No NTP on the host
+
+struct HostSerial {
+  template <typename... T> size_t print(T...) { return 0; }
+  template <typename... T> size_t println(T...) { return 0; }
+  size_t printf(const char *, ...) { return 0; }
+};
+extern HostSerial Serial;
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,74 @@
+#ifndef HOST_ARDUINO_GFX_LIBRARY_H
+#define HOST_ARDUINO_GFX_LIBRARY_H
+
+// ============================================================================
+// Host shim for Arduino_GFX — the panel as a framebuffer
+// ============================================================================
+// The bot renderer records into its own display list and pushes finished
+// bands with draw16bitRGBBitmap(), so that and the fills used for clears
+// and the 8x8 grid write real pixels. Calls only hi-res ambient makes
+// (ellipses, text) are accepted and dropped. Arduino_ST7789 is a panel of
+// the size initLCD() asks for.
+// ============================================================================
+
+#include <Arduino.h>
+
+class Arduino_GFX {
+ public:
+  Arduino_GFX(int16_t w, int16_t h) : w_(w), h_(h), px_(new uint16_t[w * h]()) {}
+  Arduino_GFX(const Arduino_GFX &) = delete;
+  Arduino_GFX &operator=(const Arduino_GFX &) = delete;
+  virtual ~Arduino_GFX() { delete[] px_; }
+
+  bool begin() { return true; }
+  int16_t width() const { return w_; }
+  int16_t height() const { return h_; }
+  const uint16_t *pixels() const { return px_; }
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    int16_t x0 = max(x, (int16_t)0), x1 = min((int16_t)(x + w), w_);
+    int16_t y0 = max(y, (int16_t)0), y1 = min((int16_t)(y + h), h_);
+    for (int16_t r = y0; r < y1; r++) {
+      for (int16_t c = x0; c < x1; c++) px_[r * w_ + c] = color;
+    }
+  }
+  void fillScreen(uint16_t color) { fillRect(0, 0, w_, h_, color); }
+  void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) {
+    for (int16_t r = 0; r < h; r++) {
+      for (int16_t c = 0; c < w; c++) {
+        int16_t px = x + c, py = y + r;
+        if (px >= 0 && px < w_ && py >= 0 && py < h_) px_[py * w_ + px] = bitmap[r * w + c];
+      }
+    }
+  }
+  void fillEllipse(int16_t, int16_t, int16_t, int16_t, uint16_t) {}
+  void setCursor(int16_t, int16_t) {}
+  template <typename T> size_t print(T) { return 0; }
+
+ protected:
+  int16_t w_, h_;
+  uint16_t *px_;
+};
+
+class Arduino_Canvas : public Arduino_GFX {
+ public:
+  Arduino_Canvas(int16_t w, int16_t h, Arduino_GFX *) : Arduino_GFX(w, h) {}
+  uint16_t *getFramebuffer() { return px_; }
+};
+
+#define GFX_NOT_DEFINED -1
+
+class Arduino_DataBus {};
+
+class Arduino_ESP32SPI : public Arduino_DataBus {
+ public:
+  Arduino_ESP32SPI(int8_t, int8_t, int8_t, int8_t, int8_t) {}
+};
+
+class Arduino_ST7789 : public Arduino_GFX {
+ public:
+  Arduino_ST7789(Arduino_DataBus *, int8_t, uint8_t, bool, int16_t w, int16_t h, uint8_t, uint8_t)
+      : Arduino_GFX(w, h) {}
+};
+
+#endif // HOST_ARDUINO_GFX_LIBRARY_H
@@ -0,0 +1,194 @@
+// FastLED shim implementations (see FastLED.h)
+
+#include <FastLED.h>
+
+uint16_t rand16seed = 1337;
+CFastLED FastLED = {};
+
+uint8_t sin8(uint8_t theta) {
+  static const uint8_t b_m16_interleave[] = { 0, 49, 49, 41, 90, 27, 117, 10 };
+  uint8_t offset = theta;
+  if (theta & 0x40) offset = (uint8_t)255 - offset;
+  offset &= 0x3F;
+  uint8_t secoffset = offset & 0x0F;
+  if (theta & 0x40) ++secoffset;
+  uint8_t s2 = (offset >> 4) * 2;
+  uint8_t b = b_m16_interleave[s2];
+  uint8_t m16 = b_m16_interleave[s2 + 1];
+  uint8_t mx = (m16 * secoffset) >> 4;
+  int8_t y = mx + b;
+  if (theta & 0x80) y = -y;
+  y += 128;
+  return (uint8_t)y;
+}
+
+int16_t sin16(uint16_t theta) {
+  static const uint16_t base[] = { 0, 6393, 12539, 18204, 23170, 27245, 30273, 32137 };
+  static const uint8_t slope[] = { 49, 48, 44, 38, 31, 23, 14, 4 };
+  uint16_t offset = (theta & 0x3FFF) >> 3;
+  if (theta & 0x4000) offset = 2047 - offset;
+  uint8_t section = offset / 256;
+  uint8_t secoffset8 = (uint8_t)offset / 2;
+  uint16_t mx = slope[section] * secoffset8;
+  int16_t y = mx + base[section];
+  if (theta & 0x8000) y = -y;
+  return y;
+}
+
+// Stand-in for FastLED's 3D Perlin noise: a hashed lattice value per
+// integer cell, smoothstep-blended across the 8.8 fixed-point coordinates
+static uint8_t noiseLattice(uint8_t x, uint8_t y, uint8_t z) {
+  uint32_t h = x * 73856093u ^ y * 19349663u ^ z * 83492791u;
+  h ^= h >> 13;
+  h *= 0x5bd1e995u;
+  return (uint8_t)(h >> 24);
+}
+
+static float noiseEase(uint8_t f) {
+  float t = f / 256.0f;
+  return t * t * (3 - 2 * t);
+}
+
+uint8_t inoise8(uint16_t x, uint16_t y, uint16_t z) {
+  uint8_t X = x >> 8, Y = y >> 8, Z = z >> 8;
+  float u = noiseEase(x), v = noiseEase(y), w = noiseEase(z);
+  float c[2];
+  for (uint8_t dz = 0; dz < 2; dz++) {
+    float a = noiseLattice(X, Y, Z + dz) + u * (noiseLattice(X + 1, Y, Z + dz) - noiseLattice(X, Y, Z + dz));
+    float b = noiseLattice(X, Y + 1, Z + dz) +
+              u * (noiseLattice(X + 1, Y + 1, Z + dz) - noiseLattice(X, Y + 1, Z + dz));
+    c[dz] = a + v * (b - a);
+  }
+  return (uint8_t)(c[0] + w * (c[1] - c[0]));
+}
+
+void nscale8(CRGB *leds, uint16_t num, uint8_t scale) {
+  for (uint16_t i = 0; i < num; i++) leds[i].nscale8(scale);
+}
+
+// ---- Palettes (colors from FastLED's colorpalettes.cpp) ----
+
+const TProgmemRGBPalette16 CloudColors_p = {
+  0x0000FF, 0x00008B, 0x00008B, 0x00008B, 0x00008B, 0x00008B, 0x00008B, 0x00008B,
+  0x0000FF, 0x00008B, 0x87CEEB, 0x87CEEB, 0xADD8E6, 0xFFFFFF, 0xADD8E6, 0x87CEEB
+};
+
+const TProgmemRGBPalette16 LavaColors_p = {
+  0x000000, 0x800000, 0x000000, 0x800000, 0x8B0000, 0x8B0000, 0x800000, 0x8B0000,
+  0x8B0000, 0x8B0000, 0xFF0000, 0xFFA500, 0xFFFFFF, 0xFFA500, 0xFF0000, 0x8B0000
+};
+
+const TProgmemRGBPalette16 OceanColors_p = {
+  0x191970, 0x00008B, 0x191970, 0x000080, 0x00008B, 0x0000CD, 0x2E8B57, 0x008080,
+  0x5F9EA0, 0x0000FF, 0x008B8B, 0x6495ED, 0x7FFFD4, 0x2E8B57, 0x00FFFF, 0x87CEFA
+};
+
+const TProgmemRGBPalette16 ForestColors_p = {
+  0x006400, 0x006400, 0x556B2F, 0x006400, 0x008000, 0x228B22, 0x6B8E23, 0x008000,
+  0x2E8B57, 0x66CDAA, 0x32CD32, 0x9ACD32, 0x90EE90, 0x7CFC00, 0x66CDAA, 0x228B22
+};
+
+const TProgmemRGBPalette16 RainbowColors_p = {
+  0xFF0000, 0xD52A00, 0xAB5500, 0xAB7F00, 0xABAB00, 0x56D500, 0x00FF00, 0x00D52A,
+  0x00AB55, 0x0056AA, 0x0000FF, 0x2A00D5, 0x5500AB, 0x7F0081, 0xAB0055, 0xD5002B
+};
+
+const TProgmemRGBPalette16 PartyColors_p = {
+  0x5500AB, 0x84007C, 0xB5004B, 0xE5001B, 0xE81700, 0xB84700, 0xAB7700, 0xABAB00,
+  0xAB5500, 0xDD2200, 0xF2000E, 0xC2003E, 0x8F0071, 0x5F00A1, 0x2F00D0, 0x0007F9
+};
+
+const TProgmemRGBPalette16 HeatColors_p = {
+  0x000000, 0x330000, 0x660000, 0x990000, 0xCC0000, 0xFF0000, 0xFF3300, 0xFF6600,
+  0xFF9900, 0xFFCC00, 0xFFFF00, 0xFFFF33, 0xFFFF66, 0xFFFF99, 0xFFFFCC, 0xFFFFFF
+};
+
+CRGBPalette16::CRGBPalette16(const TProgmemRGBPalette16 &rhs) {
+  for (uint8_t i = 0; i < 16; i++) entries[i] = CRGB(rhs[i]);
+}
+
+// fill_gradient_RGB: 8.7 fixed-point steps from start to end, inclusive
+static void fillGradientRGB(CRGB *leds, uint16_t startpos, CRGB startcolor,
+                            uint16_t endpos, CRGB endcolor) {
+  if (endpos < startpos) {
+    std::swap(startpos, endpos);
+    std::swap(startcolor, endcolor);
+  }
+  int16_t rdistance87 = (endcolor.r - startcolor.r) << 7;
+  int16_t gdistance87 = (endcolor.g - startcolor.g) << 7;
+  int16_t bdistance87 = (endcolor.b - startcolor.b) << 7;
+  uint16_t pixeldistance = endpos - startpos;
+  int16_t divisor = pixeldistance ? pixeldistance : 1;
+  int16_t rdelta87 = (rdistance87 / divisor) * 2;
+  int16_t gdelta87 = (gdistance87 / divisor) * 2;
+  int16_t bdelta87 = (bdistance87 / divisor) * 2;
+  uint16_t r88 = startcolor.r << 8;
+  uint16_t g88 = startcolor.g << 8;
+  uint16_t b88 = startcolor.b << 8;
+  for (uint16_t i = startpos; i <= endpos; ++i) {
+    leds[i] = CRGB(r88 >> 8, g88 >> 8, b88 >> 8);
+    r88 += rdelta87;
+    g88 += gdelta87;
+    b88 += bdelta87;
+  }
+}
+
+// Gradient palette bytes (index, r, g, b ... ending at index 255) spread
+// over 16 entries
+CRGBPalette16::CRGBPalette16(TProgmemRGBGradientPalette_bytes gradient) : entries() {
+  const uint8_t *p = gradient;
+  uint16_t count = 0;
+  do {
+    count++;
+  } while (p[(count - 1) * 4] != 255);
+
+  int8_t lastSlotUsed = -1;
+  CRGB rgbstart(p[1], p[2], p[3]);
+  int indexstart = 0;
+  while (indexstart < 255) {
+    p += 4;
+    int indexend = p[0];
+    CRGB rgbend(p[1], p[2], p[3]);
+    uint8_t istart8 = indexstart / 16;
+    uint8_t iend8 = indexend / 16;
+    if (count < 16) {
+      if (istart8 <= lastSlotUsed && lastSlotUsed < 15) {
+        istart8 = lastSlotUsed + 1;
+        if (iend8 < istart8) iend8 = istart8;
+      }
+      lastSlotUsed = iend8;
+    }
+    fillGradientRGB(entries, istart8, rgbstart, iend8, rgbend);
+    indexstart = indexend;
+    rgbstart = rgbend;
+  }
+}
+
+CRGB ColorFromPalette(const CRGBPalette16 &pal, uint8_t index, uint8_t brightness,
+                      TBlendType blendType) {
+  uint8_t hi4 = index >> 4;
+  uint8_t lo4 = index & 0x0F;
+  const CRGB *entry = &pal.entries[hi4];
+  uint8_t red1 = entry->r, green1 = entry->g, blue1 = entry->b;
+
+  if (lo4 && blendType != NOBLEND) {
+    entry = (hi4 == 15) ? &pal.entries[0] : entry + 1;
+    uint8_t f2 = lo4 << 4;
+    uint8_t f1 = 255 - f2;
+    red1 = scale8(red1, f1) + scale8(entry->r, f2);
+    green1 = scale8(green1, f1) + scale8(entry->g, f2);
+    blue1 = scale8(blue1, f1) + scale8(entry->b, f2);
+  }
+
+  if (brightness != 255) {
+    if (brightness) {
+      ++brightness;  // Adjust for rounding
+      if (red1) red1 = scale8(red1, brightness);
+      if (green1) green1 = scale8(green1, brightness);
+      if (blue1) blue1 = scale8(blue1, brightness);
+    } else {
+      red1 = green1 = blue1 = 0;
+    }
+  }
+  return CRGB(red1, green1, blue1);
+}
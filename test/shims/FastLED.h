@@ -0,0 +1,169 @@
+#ifndef HOST_FASTLED_H
+#define HOST_FASTLED_H
+
+// ============================================================================
+// Host shim for FastLED — the parts the motion effects and palettes use
+// ============================================================================
+// The math follows FastLED's portable C paths (sin8_C, sin16_C, the
+// random16 LCG, scale8 with FASTLED_SCALE8_FIXED, ColorFromPalette's
+// linear blend, gradient palette expansion), so leds[] hashes computed on
+// the host can be compared with hashes recorded on the device.
+// show() does nothing; clear() zeroes the array handed to attach().
+//
+// inoise8() is a stand-in (smoothed hash noise, not FastLED's Perlin
+// tables): it only exists so the ambient effects behind the bot background
+// compile, and host traces don't drive ambient frames.
+// ============================================================================
+
+#include <Arduino.h>
+
+struct CRGB {
+  uint8_t r, g, b;
+
+  CRGB() = default;
+  constexpr CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+  constexpr CRGB(uint32_t code) : r(code >> 16), g(code >> 8), b(code) {}
+
+  bool operator==(const CRGB &o) const { return r == o.r && g == o.g && b == o.b; }
+  bool operator!=(const CRGB &o) const { return !(*this == o); }
+
+  CRGB &operator+=(const CRGB &o);
+  CRGB &nscale8(uint8_t scale);
+
+  enum HTMLColorCode : uint32_t {
+    Black = 0x000000,
+    Blue  = 0x0000FF,
+    Red   = 0xFF0000,
+    White = 0xFFFFFF
+  };
+};
+
+// ---- 8/16-bit math ----
+
+inline uint8_t qadd8(uint8_t i, uint8_t j) {
+  unsigned t = i + j;
+  return t > 255 ? 255 : (uint8_t)t;
+}
+
+inline uint8_t qsub8(uint8_t i, uint8_t j) {
+  return i > j ? (uint8_t)(i - j) : 0;
+}
+
+inline CRGB &CRGB::operator+=(const CRGB &o) {
+  r = qadd8(r, o.r);
+  g = qadd8(g, o.g);
+  b = qadd8(b, o.b);
+  return *this;
+}
+
+inline uint8_t scale8(uint8_t i, uint8_t scale) {
+  return (uint8_t)(((uint16_t)i * (1 + (uint16_t)scale)) >> 8);
+}
+
+inline uint16_t scale16(uint16_t i, uint16_t scale) {
+  return (uint16_t)(((uint32_t)i * (1 + (uint32_t)scale)) >> 16);
+}
+
+inline CRGB &CRGB::nscale8(uint8_t scale) {
+  r = scale8(r, scale);
+  g = scale8(g, scale);
+  b = scale8(b, scale);
+  return *this;
+}
+
+uint8_t sin8(uint8_t theta);
+inline uint8_t cos8(uint8_t theta) { return sin8(theta + 64); }
+int16_t sin16(uint16_t theta);
+inline int16_t cos16(uint16_t theta) { return sin16(theta + 16384); }
+
+uint8_t inoise8(uint16_t x, uint16_t y, uint16_t z);
+
+// ---- Timing ----
+
+struct CEveryNMillis {
+  uint32_t period, prev;
+
+  explicit CEveryNMillis(uint32_t ms) : period(ms), prev(millis()) {}
+  bool ready() {
+    uint32_t now = millis();
+    if (now - prev < period) return false;
+    prev = now;
+    return true;
+  }
+};
+
+#define FASTLED_CAT2(a, b) a##b
+#define FASTLED_CAT(a, b) FASTLED_CAT2(a, b)
+#define EVERY_N_MILLISECONDS(n) \
+  static CEveryNMillis FASTLED_CAT(everyN, __LINE__)(n); \
+  if (FASTLED_CAT(everyN, __LINE__).ready())
+
+// ---- Random (FastLED's 16-bit LCG) ----
+
+extern uint16_t rand16seed;
+
+inline uint8_t random8() {
+  rand16seed = (rand16seed * 2053) + 13849;
+  return (uint8_t)(((uint8_t)(rand16seed & 0xFF)) + ((uint8_t)(rand16seed >> 8)));
+}
+inline uint8_t random8(uint8_t lim) { return (uint8_t)((random8() * lim) >> 8); }
+inline uint8_t random8(uint8_t min, uint8_t lim) { return random8(lim - min) + min; }
+inline uint16_t random16() {
+  rand16seed = (rand16seed * 2053) + 13849;
+  return rand16seed;
+}
+inline uint16_t random16(uint16_t lim) { return (uint16_t)(((uint32_t)random16() * lim) >> 16); }
+inline void random16_set_seed(uint16_t seed) { rand16seed = seed; }
+inline uint16_t random16_get_seed() { return rand16seed; }
+
+// ---- Palettes ----
+
+typedef const uint32_t TProgmemRGBPalette16[16];
+typedef uint8_t TProgmemRGBGradientPalette_byte;
+typedef const TProgmemRGBGradientPalette_byte *TProgmemRGBGradientPalette_bytes;
+
+#define DEFINE_GRADIENT_PALETTE(X) \
+  extern const TProgmemRGBGradientPalette_byte X[] PROGMEM; \
+  const TProgmemRGBGradientPalette_byte X[] PROGMEM =
+
+enum TBlendType { NOBLEND = 0, LINEARBLEND = 1 };
+
+struct CRGBPalette16 {
+  CRGB entries[16];
+
+  CRGBPalette16() : entries() {}
+  CRGBPalette16(const TProgmemRGBPalette16 &rhs);
+  CRGBPalette16(TProgmemRGBGradientPalette_bytes gradient);
+
+  const CRGB &operator[](uint8_t i) const { return entries[i]; }
+};
+
+extern const TProgmemRGBPalette16 CloudColors_p, LavaColors_p, OceanColors_p, ForestColors_p,
+                                  RainbowColors_p, PartyColors_p, HeatColors_p;
+
+CRGB ColorFromPalette(const CRGBPalette16 &pal, uint8_t index, uint8_t brightness = 255,
+                      TBlendType blendType = LINEARBLEND);
+
+// ---- Buffers ----
+
+void nscale8(CRGB *leds, uint16_t num, uint8_t scale);
+inline void fadeToBlackBy(CRGB *leds, uint16_t num, uint8_t fade) { nscale8(leds, num, 255 - fade); }
+
+struct CFastLED {
+  CRGB *leds;
+  uint16_t count;
+
+  // Host only: the array clear() works on (addLeds on the device)
+  void attach(CRGB *data, uint16_t n) {
+    leds = data;
+    count = n;
+  }
+  void clear(bool = false) {
+    if (leds) memset(leds, 0, count * sizeof(CRGB));
+  }
+  void show() {}
+  void setBrightness(uint8_t) {}
+};
+extern CFastLED FastLED;
+
+#endif // HOST_FASTLED_H
@@ -0,0 +1,58 @@
+#ifndef HOST_LITTLEFS_H
+#define HOST_LITTLEFS_H
+
+// Host shim: LittleFS paths map to files under hostFsRoot ("." unless a
+// test points it elsewhere), so "/input.trc" is ./input.trc.
+
+#include <Arduino.h>
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+
+extern const char *hostFsRoot;
+
+class File {
+ public:
+  File(FILE *f = nullptr) : f_(f) {}
+  explicit operator bool() const { return f_ != nullptr; }
+  size_t read(uint8_t *buf, size_t len) { return f_ ? fread(buf, 1, len, f_) : 0; }
+  size_t write(const uint8_t *buf, size_t len) { return f_ ? fwrite(buf, 1, len, f_) : 0; }
+  bool seek(uint32_t pos) { return f_ && fseek(f_, pos, SEEK_SET) == 0; }
+  size_t size() {
+    if (!f_) return 0;
+    long at = ftell(f_);
+    fseek(f_, 0, SEEK_END);
+    long end = ftell(f_);
+    fseek(f_, at, SEEK_SET);
+    return end;
+  }
+  void close() {
+    if (f_) fclose(f_);
+    f_ = nullptr;
+  }
+
+ private:
+  FILE *f_;
+};
+
+struct HostLittleFS {
+  File open(const char *path, const char *mode) {
+    char full[512];
+    snprintf(full, sizeof(full), "%s%s", hostFsRoot, path);
+    return File(fopen(full, mode[0] == 'w' ? "wb" : "rb"));
+  }
+  bool remove(const char *path) {
+    char full[512];
+    snprintf(full, sizeof(full), "%s%s", hostFsRoot, path);
+    return ::remove(full) == 0;
+  }
+  bool rename(const char *from, const char *to) {
+    char a[512], b[512];
+    snprintf(a, sizeof(a), "%s%s", hostFsRoot, from);
+    snprintf(b, sizeof(b), "%s%s", hostFsRoot, to);
+    return ::rename(a, b) == 0;
+  }
+};
+extern HostLittleFS LittleFS;
+
+#endif // HOST_LITTLEFS_H
@@ -0,0 +1,39 @@
+#ifndef HOST_SENSOR_QMI8658_HPP
+#define HOST_SENSOR_QMI8658_HPP
+
+// Host shim: the QMI8658 driver surface used by imu_fifo.h. Most host
+// tests feed ImuSample values directly and the FIFO reads empty; a test
+// that exercises ImuFifo::service() fills hostAcc/hostGyr/hostCount, which
+// the next readFromFifo() hands out once.
+
+#include <Arduino.h>
+
+struct IMUdata {
+  float x, y, z;
+};
+
+class SensorQMI8658 {
+ public:
+  enum FIFO_Mode { FIFO_MODE_BYPASS, FIFO_MODE_FIFO, FIFO_MODE_STREAM };
+  enum FIFO_Samples { FIFO_SAMPLES_16, FIFO_SAMPLES_32, FIFO_SAMPLES_64, FIFO_SAMPLES_128 };
+  enum IntPin { INTERRUPT_PIN_1, INTERRUPT_PIN_2, INTERRUPT_PIN_DISABLE };
+
+  bool configFIFO(FIFO_Mode, FIFO_Samples, IntPin, uint8_t) { return true; }
+  bool enableINT(IntPin, bool = true) { return true; }
+  uint16_t readFromFifo(IMUdata *acc, uint16_t accLen, IMUdata *gyr, uint16_t gyrLen) {
+    uint16_t n = hostCount;
+    if (n > accLen) n = accLen;
+    if (n > gyrLen) n = gyrLen;
+    for (uint16_t i = 0; i < n; i++) {
+      acc[i] = hostAcc[i];
+      gyr[i] = hostGyr[i];
+    }
+    hostCount = 0;
+    return n;
+  }
+
+  IMUdata hostAcc[32], hostGyr[32];
+  uint16_t hostCount = 0;
+};
+
+#endif // HOST_SENSOR_QMI8658_HPP
@@ -0,0 +1,19 @@
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+// Host shim: an I2C bus with nothing on it (every transaction NAKs)
+
+#include <Arduino.h>
+
+struct TwoWire {
+  bool begin(int = -1, int = -1) { return true; }
+  void setClock(uint32_t) {}
+  void beginTransmission(uint8_t) {}
+  size_t write(uint8_t) { return 1; }
+  uint8_t endTransmission(bool = true) { return 2; }
+  uint8_t requestFrom(uint8_t, uint8_t) { return 0; }
+  int read() { return -1; }
+};
+extern TwoWire Wire;
+
+#endif // HOST_WIRE_H
@@ -0,0 +1,10 @@
+#ifndef HOST_ESP_TIMER_H
+#define HOST_ESP_TIMER_H
+
+// Host shim: esp_timer runs on hostClockUs like micros(), without the wrap
+
+#include <Arduino.h>
+
+inline int64_t esp_timer_get_time() { return (int64_t)hostClockUs; }
+
+#endif // HOST_ESP_TIMER_H
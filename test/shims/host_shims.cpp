@@ -0,0 +1,11 @@
+// Definitions behind the host shims (shared by every host test)
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <LittleFS.h>
+
+uint64_t hostClockUs = 0;
+HostSerial Serial;
+TwoWire Wire;
+const char *hostFsRoot = ".";
+HostLittleFS LittleFS;
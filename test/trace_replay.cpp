@@ -0,0 +1,183 @@
+// ============================================================================
+// Trace replay — play an input trace (/input.trc) through the host build
+// ============================================================================
+//   trace_replay [--root DIR] [--quiet]     replay DIR/input.trc (DIR = .)
+//   trace_replay --record DIR               record a synthetic trace there
+//
+// Replay loads the trace through inputTrace, as the device does, and runs
+// it frame by frame with the clock at the recorded frame time: the frame's
+// IMU samples go through the gesture recognizer and orientation filter,
+// handleGestures() acts on the queue (mode changes, bot reactions), its
+// touches are drained, then the recorded mode, effect and palette run.
+// Motion frames are checked by their leds[] hash; bot frames run
+// updateBotMode()/renderBotMode() into the shim panel and are checked by
+// the hash of the bands pushed to it (botPanelHash()); the panel must also
+// equal a full rasterization of the frame's list, which checks the bands
+// skipped as unchanged. Each frame prints its hash, whether it matches the
+// recorded one, and the host time the frame took. Ambient and emoji frames
+// are listed and not compared.
+//
+// --record writes a trace from synthetic input through the same loop pass:
+// motion effects under tilts, shakes and a spin, then bot mode with shakes,
+// a face-down nap and the greeting's typewriter reveal. The replay of it
+// must match on every frame.
+// ============================================================================
+
+#include <chrono>
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "bot_host.h"
+
+#define RECORD_FRAMES        900
+#define RECORD_MOTION_FRAMES 480     // Then bot mode for the rest
+#define RECORD_FRAME_US      20000   // 50fps
+#define RECORD_EFFECT_FRAMES 80      // Frames per effect before the next one
+
+static const char *gestureNames[] = { "shake", "shake-n", "tap", "double-tap", "face-down",
+                                      "face-up", "tilt-right", "tilt-left", "tilt-forward",
+                                      "tilt-back" };
+
+// Synthetic input for --record at sample time t (us since the start):
+// slow tilt circles, a short shake every 2s (single shakes, not the
+// SHAKE_COUNT that changes mode), a spin about Z with the gyro, and in bot
+// mode 1.5s face down from 13.5s
+static void syntheticSample(uint32_t t, ImuSample &s) {
+  float sec = t / 1000000.0f;
+  float lean = 0.5f * sinf(sec * 0.7f);
+  s.ax = lean * cosf(sec * 1.3f);
+  s.ay = lean * sinf(sec * 1.3f);
+  s.az = sqrtf(1.0f - lean * lean);
+  if (fmodf(sec, 2.0f) > 1.85f) {
+    float k = 2.5f * sinf(sec * 2.0f * (float)PI * 6.0f);
+    s.ax += k;
+    s.az += k * 0.5f;
+  }
+  if (sec > 13.5f && sec < 15.0f) s.az = -s.az;
+  s.gx = 40.0f * cosf(sec * 1.3f);
+  s.gy = 40.0f * sinf(sec * 1.3f);
+  s.gz = 180.0f * sinf(sec * 0.4f);
+}
+
+static uint16_t gestureCount;
+static char fired[96];
+
+static void listGesture(const GestureEvent &ev) {
+  if (gestureCount++ == 0) strcat(fired, " gestures:");
+  if (strlen(fired) < sizeof(fired) - 16 && ev.type < sizeof(gestureNames) / sizeof(gestureNames[0])) {
+    strcat(fired, " ");
+    strcat(fired, gestureNames[ev.type]);
+  }
+}
+
+// The rest of a loop pass once the frame's samples are read and the clock
+// is at the frame time. Effect changes within a mode clear leds[] as the
+// auto-cycle does. Returns whether the host drove the frame.
+static bool runFrame(uint8_t mode, uint8_t effect, uint8_t palette) {
+  gestureCount = 0;
+  fired[0] = '\0';
+  hostHandleGestures(listGesture);
+  if (mode == currentMode && effect != effectIndex) FastLED.clear();
+  hostApplyFrame(mode, effect, palette);
+  return hostModeFrame();
+}
+
+static int record(const char *dir) {
+  hostFsRoot = dir;
+  hostBotBegin();
+  inputTrace.begin(true);
+  if (!inputTrace.startRecording()) {
+    fprintf(stderr, "can't write %s%s\n", dir, TRACE_PATH);
+    return 2;
+  }
+  uint32_t nextSampleUs = 0;
+  for (uint32_t f = 0; f < RECORD_FRAMES; f++) {
+    hostClockUs = (uint64_t)f * RECORD_FRAME_US;
+    while (nextSampleUs <= hostClockUs) {
+      ImuSample s;
+      s.us = nextSampleUs;
+      syntheticSample(nextSampleUs, s);
+      hostPushSample(s);
+      nextSampleUs += imuFifo.periodUs;
+    }
+    hostReadIMU();
+
+    if (f < RECORD_MOTION_FRAMES) {
+      uint8_t effect = (f / RECORD_EFFECT_FRAMES) % NUM_MOTION_EFFECTS;
+      uint8_t palette = (f / (RECORD_EFFECT_FRAMES / 2)) % NUM_PALETTES;
+      runFrame(MODE_MOTION, effect, palette);
+    } else {
+      runFrame(MODE_BOT, 0, paletteIndex);
+    }
+    inputTrace.endFrame(currentMode, effectIndex, paletteIndex, hostFrameHash());
+  }
+  uint32_t frames = inputTrace.frames, samples = inputTrace.samples;
+  inputTrace.stop();
+  printf("recorded %u frames, %u samples to %s%s\n", frames, samples, dir, TRACE_PATH);
+  return 0;
+}
+
+static int replay(bool quiet) {
+  hostBotBegin();
+  inputTrace.begin(true);
+  if (!inputTrace.startPlayback()) {
+    fprintf(stderr, "no valid trace at %s%s\n", hostFsRoot, TRACE_PATH);
+    return 2;
+  }
+
+  uint32_t frames = 0, driven = 0, differ = 0, botFrames = 0;
+  uint64_t totalNs = 0, maxNs = 0;
+  for (;;) {
+    auto t0 = std::chrono::steady_clock::now();
+    uint16_t samples = hostReadIMU();
+    uint16_t touches = 0;
+    TouchEvent te;
+    while (inputTrace.nextTouch(te)) touches++;
+
+    const TraceFrame *f = inputTrace.replayFrame();
+    if (f == nullptr) break;  // End of the trace
+    hostClockUs = f->us;
+    bool run = runFrame(f->mode, f->effect, f->palette);
+    uint32_t hash = hostFrameHash();
+    uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - t0).count();
+
+    const char *verdict = "skip";
+    if (run) {
+      driven++;
+      if (currentMode == MODE_BOT) botFrames++;
+      totalNs += ns;
+      if (ns > maxNs) maxNs = ns;
+      verdict = (hash == f->hash) ? "ok" : "DIFF";
+      if (currentMode == MODE_BOT && !hostPanelMatchesList()) verdict = "PANEL";
+      if (strcmp(verdict, "ok")) differ++;
+    }
+    if (!quiet || (run && strcmp(verdict, "ok"))) {
+      printf("frame %5u t %8.3fs mode %u fx %u pal %2u hash %08x rec %08x %-4s %6.1fus "
+             "samples %u touches %u%s\n",
+             frames, f->us / 1e6, f->mode, f->effect, f->palette, hash, f->hash, verdict,
+             ns / 1000.0, samples, touches, fired);
+    }
+    inputTrace.endFrame(f->mode, f->effect, f->palette, hash);
+    frames++;
+  }
+  inputTrace.stop();
+
+  printf("%u frames, %u replayed (%u bot), %u differ; host time avg %.1fus max %.1fus\n",
+         frames, driven, botFrames, differ,
+         driven ? totalNs / 1000.0 / driven : 0.0, maxNs / 1000.0);
+  return (frames == 0 || differ) ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+  bool quiet = false;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--record") && i + 1 < argc) return record(argv[++i]);
+    if (!strcmp(argv[i], "--root") && i + 1 < argc) hostFsRoot = argv[++i];
+    else if (!strcmp(argv[i], "--quiet")) quiet = true;
+    else {
+      fprintf(stderr, "usage: %s [--root DIR] [--quiet] | --record DIR\n", argv[0]);
+      return 2;
+    }
+  }
+  return replay(quiet);
+}
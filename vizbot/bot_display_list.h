@@ -0,0 +1,563 @@
+#ifndef BOT_DISPLAY_LIST_H
+#define BOT_DISPLAY_LIST_H
+
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include "config.h"
+#include "bot_font.h"
+
+// ============================================================================
+// Bot Display List — retained primitives + band rasterizer
+// ============================================================================
+// The face, brows, mouth and overlays are recorded each frame as a compact
+// list of primitives instead of being drawn straight to the panel. The list
+// is then rasterized band by band into a small line buffer that is streamed
+// to the LCD, so every pixel is written exactly once per frame (no erase /
+// redraw flicker) without a 134KB full-screen canvas.
+//
+// RAM: ~5.6KB op list + 2x 9.6KB band buffers (bot_present.h), vs 134KB
+// for Arduino_Canvas.
+// The same rasterizer can also target a full framebuffer (canvas builds).
+// ============================================================================
+
+// LCD dimensions (must match display_lcd.h)
+#ifndef LCD_WIDTH
+#define LCD_WIDTH 240
+#define LCD_HEIGHT 280
+#endif
+
+#define BOT_DL_MAX_OPS     256   // Worst case frame (gradient bg + spiral eyes + overlays) is ~180
+#define BOT_DL_POOL_BYTES  224   // Text and curve samples shared by all ops in a frame
+#define BOT_BAND_ROWS      20    // Rows per band — 240x20 RGB565 = 9.6KB per band buffer
+
+// Primitive types
+enum BotDLOpType : uint8_t {
+  DL_RECT = 0,       // p: x, y, w, h
+  DL_CIRCLE,         // p: cx, cy, r
+  DL_ELLIPSE,        // p: cx, cy, rx, ry
+  DL_TRIANGLE,       // p: x0, y0, x1, y1, x2, y2
+  DL_QUAD,           // Thick line — p: x0, y0, x1, y1, ox, oy (half-thickness normal)
+  DL_ROUND_RECT,     // p: x, y, w, h, r
+  DL_ROUND_FRAME,    // Rounded rect outline — p: x, y, w, h, r
+  DL_TEXT,           // p: x, y, pool offset, length (size = text scale)
+  DL_CURVE,          // Thick sampled curve — p: x0, y, pool offset, count (int8 dy per x)
+                     //   size/color2 as DL_ARC
+  DL_ARC,            // Thick parabolic arc — p: 2*vx, vy, k (1/16 px), 2*d, xa, xb
+                     //   size = brush radius | stroke px << 4, color2 = stroke
+  DL_SPRITE          // Cached RLE mask (bot_sprites.h) — p: x, y, slot, ink 3; color2 = ink 2
+};
+
+// One recorded primitive (22 bytes)
+struct BotDLOp {
+  BotDLOpType type;
+  uint8_t size;
+  uint16_t color;
+  uint16_t color2;         // Secondary color (arc stroke)
+  int16_t yTop, yBot;      // Inclusive row bounds, used to skip ops outside a band
+  int16_t p[6];
+};
+
+// ============================================================================
+// Rasterizer helpers
+// ============================================================================
+
+// Integer square root (bitwise, no float)
+inline uint16_t botIsqrt(uint32_t v) {
+  uint32_t r = 0;
+  uint32_t bit = 1UL << 30;
+  while (bit > v) bit >>= 2;
+  while (bit) {
+    if (v >= r + bit) {
+      v -= r + bit;
+      r = (r >> 1) + bit;
+    } else {
+      r >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (uint16_t)r;
+}
+
+// Fill [x0, x1] of one row, clipped to the screen
+inline void botSpanFill(uint16_t *row, int16_t x0, int16_t x1, uint16_t color) {
+  if (x0 < 0) x0 = 0;
+  if (x1 >= LCD_WIDTH) x1 = LCD_WIDTH - 1;
+  for (int16_t x = x0; x <= x1; x++) row[x] = color;
+}
+
+// Half-width of an ellipse at vertical offset dy (-1 if the row misses it)
+inline int16_t botEllipseHalfW(int16_t rx, int16_t ry, int16_t dy) {
+  if (ry <= 0) return (dy == 0) ? rx : -1;
+  uint32_t ry2 = (uint32_t)ry * ry;
+  uint32_t dy2 = (uint32_t)dy * dy;
+  if (dy2 > ry2) return -1;
+  // Rounded: sqrt(rx^2 * (ry^2 - dy^2)) / ry
+  return (int16_t)((botIsqrt((uint32_t)rx * rx * (ry2 - dy2) * 4) + ry) / (2 * ry));
+}
+
+// Horizontal inset of a rounded-rect corner on a given row
+inline int16_t botRoundInset(int16_t row, int16_t y, int16_t h, int16_t r) {
+  int16_t dy = 0;
+  if (row < y + r) dy = y + r - row;
+  else if (row > y + h - 1 - r) dy = row - (y + h - 1 - r);
+  if (dy <= 0) return 0;
+  if (dy > r) return r;
+  return r - botIsqrt((uint32_t)r * r - (uint32_t)dy * dy);
+}
+
+// Horizontal extent of a convex polygon on row y. False if the row misses it.
+inline bool botPolySpan(const int16_t *xs, const int16_t *ys, uint8_t n, int16_t y,
+                        int16_t &outL, int16_t &outR) {
+  int16_t l = 32767, r = -32768;
+  for (uint8_t i = 0; i < n; i++) {
+    uint8_t j = (i + 1 == n) ? 0 : i + 1;
+    int16_t ay = ys[i], by = ys[j];
+    if ((y < ay && y < by) || (y > ay && y > by)) continue;
+    if (ay == by) {
+      // Horizontal edge lying on this row — both endpoints count
+      l = min(l, min(xs[i], xs[j]));
+      r = max(r, max(xs[i], xs[j]));
+      continue;
+    }
+    int16_t x = xs[i] + (int32_t)(y - ay) * (xs[j] - xs[i]) / (by - ay);
+    if (x < l) l = x;
+    if (x > r) r = x;
+  }
+  if (l > r) return false;
+  outL = l;
+  outR = r;
+  return true;
+}
+
+// Row y of a curve swept by a round brush of radius rad, where curveY(x)
+// gives the curve's row at column x in [xa, xb]. Brush spans of neighbouring
+// x overlap, so they are merged into runs and each pixel is written about
+// once instead of once per brush stamp.
+template <typename CurveY>
+inline void botBrushSpans(uint16_t *row, int16_t y, int16_t rad, uint16_t color,
+                          int16_t xa, int16_t xb, CurveY curveY) {
+  int16_t runL = 0, runR = -32768;
+  for (int16_t x = xa; x <= xb; x++) {
+    int16_t hw = botEllipseHalfW(rad, rad, y - curveY(x));
+    if (hw < 0) continue;
+    int16_t l = x - hw, r = x + hw;
+    if (l <= runR + 1) {
+      if (l < runL) runL = l;
+      if (r > runR) runR = r;
+    } else {
+      if (runR >= runL) botSpanFill(row, runL, runR, color);
+      runL = l;
+      runR = r;
+    }
+  }
+  if (runR >= runL) botSpanFill(row, runL, runR, color);
+}
+
+// RLE row of a cached sprite, and the key of the shape in a slot
+// (defined in bot_sprites.h)
+const uint8_t *botSpriteRow(uint8_t slot, int16_t row);
+uint32_t botSpriteSlotKey(uint8_t slot);
+
+// Row of parabola p (as in DL_ARC) at column x
+inline int16_t botArcY(const int16_t *p, int16_t x) {
+  int32_t dx = 2 * x - p[0];
+  return p[1] + (int16_t)((int32_t)p[2] * dx * dx / (16L * p[3] * p[3]));
+}
+
+// ============================================================================
+// Display List
+// ============================================================================
+// Recording methods mirror the Arduino_GFX calls they replace, so render code
+// reads the same: botDL.fillEllipse(...) instead of gfx->fillEllipse(...).
+
+struct BotDisplayList {
+  BotDLOp ops[BOT_DL_MAX_OPS];
+  uint16_t count;
+  uint16_t peakCount;          // Diagnostics: largest frame seen
+  uint16_t dropped;            // Diagnostics: ops lost to a full list
+
+  char pool[BOT_DL_POOL_BYTES];
+  uint16_t poolUsed;
+
+  // Full-screen clear (set by fillScreen — every band starts from this color)
+  bool hasClear;
+  uint16_t clearColor;
+
+  // Text state, same semantics as gfx->setCursor/setTextSize/setTextColor
+  int16_t cursorX, cursorY;
+  uint8_t textSize;
+  uint16_t textColor;
+
+  // Start a new frame
+  void clear() {
+    count = 0;
+    poolUsed = 0;
+    hasClear = false;
+    clearColor = 0x0000;
+    cursorX = cursorY = 0;
+    textSize = 1;
+    textColor = 0xFFFF;
+  }
+
+  // Append an op; returns nullptr (and counts a drop) if full or off-screen
+  BotDLOp* push(BotDLOpType type, uint16_t color, int16_t yTop, int16_t yBot) {
+    if (yBot < 0 || yTop >= LCD_HEIGHT || yBot < yTop) return nullptr;
+    if (count >= BOT_DL_MAX_OPS) {
+      dropped++;
+      return nullptr;
+    }
+    BotDLOp *op = &ops[count++];
+    if (count > peakCount) peakCount = count;
+    memset(op, 0, sizeof(BotDLOp));  // Unused params must not leak into hash()
+    op->type = type;
+    op->color = color;
+    op->yTop = max(yTop, (int16_t)0);
+    op->yBot = min(yBot, (int16_t)(LCD_HEIGHT - 1));
+    return op;
+  }
+
+  // ---- Recording API ----
+
+  // A full-screen fill hides everything recorded before it
+  void fillScreen(uint16_t color) {
+    count = 0;
+    poolUsed = 0;
+    hasClear = true;
+    clearColor = color;
+  }
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (w <= 0 || h <= 0) return;
+    BotDLOp *op = push(DL_RECT, color, y, y + h - 1);
+    if (!op) return;
+    op->p[0] = x; op->p[1] = y; op->p[2] = w; op->p[3] = h;
+  }
+
+  void fillCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color) {
+    if (r < 0) return;
+    BotDLOp *op = push(DL_CIRCLE, color, cy - r, cy + r);
+    if (!op) return;
+    op->p[0] = cx; op->p[1] = cy; op->p[2] = r;
+  }
+
+  void fillEllipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color) {
+    if (rx < 0 || ry < 0) return;
+    BotDLOp *op = push(DL_ELLIPSE, color, cy - ry, cy + ry);
+    if (!op) return;
+    op->p[0] = cx; op->p[1] = cy; op->p[2] = rx; op->p[3] = ry;
+  }
+
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                    int16_t x2, int16_t y2, uint16_t color) {
+    BotDLOp *op = push(DL_TRIANGLE, color, min(y0, min(y1, y2)), max(y0, max(y1, y2)));
+    if (!op) return;
+    op->p[0] = x0; op->p[1] = y0; op->p[2] = x1;
+    op->p[3] = y1; op->p[4] = x2; op->p[5] = y2;
+  }
+
+  // Thick line as a parallelogram: same footprint as stacking `thickness`
+  // parallel 1px lines, but one primitive and one sqrt per line.
+  void drawThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                     int16_t thickness, uint16_t color) {
+    float dx = x1 - x0;
+    float dy = y1 - y0;
+    float len = sqrtf(dx * dx + dy * dy);
+    if (len < 1.0f) len = 1.0f;
+    int16_t half = thickness / 2;
+    int16_t ox = (int16_t)lroundf(-dy / len * half);
+    int16_t oy = (int16_t)lroundf(dx / len * half);
+    int16_t ext = abs(oy);
+    BotDLOp *op = push(DL_QUAD, color, min(y0, y1) - ext, max(y0, y1) + ext);
+    if (!op) return;
+    op->p[0] = x0; op->p[1] = y0; op->p[2] = x1;
+    op->p[3] = y1; op->p[4] = ox; op->p[5] = oy;
+  }
+
+  // Thick curve through (x0 + i, y + dy[i]) for i < n, swept by a round
+  // brush of radius r. For shapes that aren't a single parabola (wavy mouth).
+  // Samples live in the pool; stroke works as in fillArc.
+  void fillCurve(int16_t x0, int16_t y, const int8_t *dy, uint8_t n, uint8_t r,
+                 uint16_t color, uint8_t stroke = 0, uint16_t strokeColor = 0) {
+    if (n == 0) return;
+    if (poolUsed + n > BOT_DL_POOL_BYTES) {
+      dropped++;
+      return;
+    }
+    int8_t lo = 0, hi = 0;
+    for (uint8_t i = 0; i < n; i++) {
+      lo = min(lo, dy[i]);
+      hi = max(hi, dy[i]);
+    }
+    r = min(r, (uint8_t)15);
+    stroke = min(stroke, (uint8_t)15);
+    int16_t ext = r + stroke;
+    BotDLOp *op = push(DL_CURVE, color, y + lo - ext, y + hi + ext);
+    if (!op) return;
+    memcpy(&pool[poolUsed], dy, n);
+    op->size = r | (stroke << 4);
+    op->color2 = strokeColor;
+    op->p[0] = x0; op->p[1] = y;
+    op->p[2] = poolUsed; op->p[3] = n;
+    poolUsed += n;
+  }
+
+  // Thick arc y = vy + (k16 / 16) * ((x - vx) / d)^2 for x in [xa, xb], swept
+  // by a round brush of radius r. Replaces one fillCircle per x step. vx and d
+  // are in half pixels (vx2, d2) so arcs can span an odd number of columns.
+  // With stroke > 0 an r + stroke halo in strokeColor is painted under the
+  // fill by the same op, so outline and fill cost one primitive.
+  void fillArc(int16_t vx2, int16_t vy, int16_t k16, int16_t d2, int16_t xa, int16_t xb,
+               uint8_t r, uint16_t color, uint8_t stroke = 0, uint16_t strokeColor = 0) {
+    if (xb < xa) return;
+    if (d2 < 1) d2 = 1;
+    r = min(r, (uint8_t)15);
+    stroke = min(stroke, (uint8_t)15);
+    int32_t den = 16L * d2 * d2;
+    int32_t da = 2 * xa - vx2, db = 2 * xb - vx2;
+    int16_t ya = vy + (int16_t)((int32_t)k16 * da * da / den);
+    int16_t yb = vy + (int16_t)((int32_t)k16 * db * db / den);
+    int16_t lo = min(ya, yb), hi = max(ya, yb);
+    if (da < 0 && db > 0) {
+      lo = min(lo, vy);
+      hi = max(hi, vy);
+    }
+    int16_t ext = r + stroke;
+    BotDLOp *op = push(DL_ARC, color, lo - ext, hi + ext);
+    if (!op) return;
+    op->size = r | (stroke << 4);
+    op->color2 = strokeColor;
+    op->p[0] = vx2; op->p[1] = vy; op->p[2] = k16;
+    op->p[3] = d2;  op->p[4] = xa; op->p[5] = xb;
+  }
+
+  // Blit a cached sprite mask (top-left at x, y) — see botSprites.draw()
+  void drawSprite(uint8_t slot, int16_t x, int16_t y, int16_t h, const uint16_t *inks) {
+    BotDLOp *op = push(DL_SPRITE, inks[0], y, y + h - 1);
+    if (!op) return;
+    op->color2 = inks[1];
+    op->p[0] = x; op->p[1] = y; op->p[2] = slot; op->p[3] = (int16_t)inks[2];
+  }
+
+  void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+    roundRect(DL_ROUND_RECT, x, y, w, h, r, color);
+  }
+
+  void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+    roundRect(DL_ROUND_FRAME, x, y, w, h, r, color);
+  }
+
+  void roundRect(BotDLOpType type, int16_t x, int16_t y, int16_t w, int16_t h,
+                 int16_t r, uint16_t color) {
+    if (w <= 0 || h <= 0) return;
+    int16_t maxR = min(w, h) / 2;
+    if (r > maxR) r = maxR;
+    BotDLOp *op = push(type, color, y, y + h - 1);
+    if (!op) return;
+    op->p[0] = x; op->p[1] = y; op->p[2] = w; op->p[3] = h; op->p[4] = r;
+  }
+
+  void setCursor(int16_t x, int16_t y) { cursorX = x; cursorY = y; }
+  void setTextSize(uint8_t s) { textSize = (s > 0) ? s : 1; }
+  void setTextColor(uint16_t c) { textColor = c; }
+
+  // Record a text run at the cursor and advance it (single line, no wrap)
+  void print(const char *text) {
+    print(text, strlen(text));
+  }
+
+  // First `len` characters of text
+  void print(const char *text, uint16_t len) {
+    if (len == 0) return;
+    if (poolUsed + len > BOT_DL_POOL_BYTES) {
+      dropped++;
+      return;
+    }
+    BotDLOp *op = push(DL_TEXT, textColor, cursorY, cursorY + BOT_FONT_CELL_H * textSize - 1);
+    if (op) {
+      memcpy(&pool[poolUsed], text, len);
+      op->size = textSize;
+      op->p[0] = cursorX; op->p[1] = cursorY;
+      op->p[2] = poolUsed; op->p[3] = len;
+      poolUsed += len;
+    }
+    cursorX += len * BOT_FONT_CELL_W * textSize;
+  }
+
+  // ---- Rasterizer ----
+
+  // Rasterize one row of one op into `row` (LCD_WIDTH pixels)
+  void rasterizeRow(const BotDLOp &op, int16_t y, uint16_t *row) const {
+    const int16_t *p = op.p;
+    switch (op.type) {
+      case DL_RECT:
+        botSpanFill(row, p[0], p[0] + p[2] - 1, op.color);
+        break;
+
+      case DL_CIRCLE:
+      case DL_ELLIPSE: {
+        int16_t ry = (op.type == DL_CIRCLE) ? p[2] : p[3];
+        int16_t hw = botEllipseHalfW(p[2], ry, y - p[1]);
+        if (hw >= 0) botSpanFill(row, p[0] - hw, p[0] + hw, op.color);
+        break;
+      }
+
+      case DL_TRIANGLE: {
+        int16_t xs[3] = { p[0], p[2], p[4] };
+        int16_t ys[3] = { p[1], p[3], p[5] };
+        int16_t l, r;
+        if (botPolySpan(xs, ys, 3, y, l, r)) botSpanFill(row, l, r, op.color);
+        break;
+      }
+
+      case DL_QUAD: {
+        int16_t xs[4] = { (int16_t)(p[0] + p[4]), (int16_t)(p[2] + p[4]),
+                          (int16_t)(p[2] - p[4]), (int16_t)(p[0] - p[4]) };
+        int16_t ys[4] = { (int16_t)(p[1] + p[5]), (int16_t)(p[3] + p[5]),
+                          (int16_t)(p[3] - p[5]), (int16_t)(p[1] - p[5]) };
+        int16_t l, r;
+        if (botPolySpan(xs, ys, 4, y, l, r)) botSpanFill(row, l, r, op.color);
+        break;
+      }
+
+      case DL_ROUND_RECT: {
+        int16_t in = botRoundInset(y, p[1], p[3], p[4]);
+        botSpanFill(row, p[0] + in, p[0] + p[2] - 1 - in, op.color);
+        break;
+      }
+
+      case DL_ROUND_FRAME: {
+        // Outer shape minus the shape inset by one pixel
+        int16_t in = botRoundInset(y, p[1], p[3], p[4]);
+        int16_t l = p[0] + in, r = p[0] + p[2] - 1 - in;
+        if (y == p[1] || y == p[1] + p[3] - 1 || p[2] <= 2) {
+          botSpanFill(row, l, r, op.color);
+          break;
+        }
+        int16_t inner = botRoundInset(y, p[1] + 1, p[3] - 2, max(p[4] - 1, 0));
+        int16_t il = p[0] + 1 + inner, ir = p[0] + p[2] - 2 - inner;
+        botSpanFill(row, l, max(il - 1, (int)l), op.color);
+        botSpanFill(row, min(ir + 1, (int)r), r, op.color);
+        break;
+      }
+
+      case DL_ARC:
+      case DL_CURVE: {
+        uint8_t r = op.size & 0x0F;
+        uint8_t stroke = op.size >> 4;
+        if (op.type == DL_ARC) {
+          auto curveY = [p](int16_t x) { return botArcY(p, x); };
+          if (stroke) botBrushSpans(row, y, r + stroke, op.color2, p[4], p[5], curveY);
+          botBrushSpans(row, y, r, op.color, p[4], p[5], curveY);
+        } else {
+          const int8_t *dy = (const int8_t *)&pool[p[2]];
+          int16_t x0 = p[0], cy = p[1];
+          auto curveY = [dy, x0, cy](int16_t x) { return (int16_t)(cy + dy[x - x0]); };
+          if (stroke) botBrushSpans(row, y, r + stroke, op.color2, x0, x0 + p[3] - 1, curveY);
+          botBrushSpans(row, y, r, op.color, x0, x0 + p[3] - 1, curveY);
+        }
+        break;
+      }
+
+      case DL_SPRITE: {
+        const uint8_t *r = botSpriteRow(p[2], y - p[1]);
+        uint8_t n = *r++;
+        for (uint8_t i = 0; i < n; i++, r += 2) {
+          int16_t x = p[0] + r[0];
+          uint8_t ink = r[1] >> 6;
+          uint16_t c = (ink == 1) ? op.color : (ink == 2) ? op.color2 : (uint16_t)p[3];
+          botSpanFill(row, x, x + (r[1] & 0x3F) - 1, c);
+        }
+        break;
+      }
+
+      case DL_TEXT: {
+        // Each glyph row is 0-3 runs from the atlas, scaled by text size
+        uint8_t s = op.size;
+        uint8_t gy = (y - p[1]) / s;
+        const char *text = &pool[p[2]];
+        int16_t cx = p[0];
+        for (int16_t i = 0; i < p[3]; i++, cx += BOT_FONT_CELL_W * s) {
+          if (cx >= LCD_WIDTH) break;
+          if (cx + BOT_FONT_CELL_W * s <= 0) continue;
+          uint8_t bits = botGlyphRow(text[i], gy);
+          if (bits == 0) continue;
+          uint32_t runs = pgm_read_dword(&botRowRuns[bits]);
+          uint8_t n = runs & 0x03;
+          runs >>= 2;
+          for (uint8_t r = 0; r < n; r++, runs >>= 6) {
+            int16_t gx = cx + (runs & 0x07) * s;
+            botSpanFill(row, gx, gx + ((runs >> 3) & 0x07) * s - 1, op.color);
+          }
+        }
+        break;
+      }
+    }
+  }
+
+  // FNV-1a over everything that affects pixels (ops, pooled text/curves,
+  // clear color). Equal hashes mean the frame would rasterize identically,
+  // as long as the sprite slots it references are unchanged.
+  uint32_t hash() const {
+    uint32_t h = 2166136261UL;
+    const uint8_t *bytes = (const uint8_t *)ops;
+    for (uint32_t i = 0; i < count * sizeof(BotDLOp); i++) h = (h ^ bytes[i]) * 16777619UL;
+    for (uint16_t i = 0; i < poolUsed; i++) h = (h ^ (uint8_t)pool[i]) * 16777619UL;
+    h = (h ^ (hasClear ? clearColor : 0x10000UL)) * 16777619UL;
+    return h;
+  }
+
+  // hash() of just the ops that touch rows [bandY, bandY + rows). Pooled
+  // text/curves count by content rather than pool offset and sprites by the
+  // key in their slot, so a band hashes the same when an op recorded before
+  // it (in another band) grew. Equal hashes mean the band would rasterize
+  // identically.
+  uint32_t bandHash(int16_t bandY, int16_t rows) const {
+    int16_t bandEnd = bandY + rows - 1;
+    uint32_t h = 2166136261UL;
+    for (uint16_t i = 0; i < count; i++) {
+      BotDLOp op = ops[i];
+      if (op.yBot < bandY || op.yTop > bandEnd) continue;
+      const uint8_t *data = nullptr;
+      uint16_t len = 0;
+      uint32_t shape = 0;
+      if (op.type == DL_TEXT || op.type == DL_CURVE) {
+        data = (const uint8_t *)&pool[op.p[2]];
+        len = op.p[3];
+        op.p[2] = 0;
+      } else if (op.type == DL_SPRITE) {
+        shape = botSpriteSlotKey(op.p[2]);
+        op.p[2] = 0;
+      }
+      const uint8_t *bytes = (const uint8_t *)&op;
+      for (uint8_t b = 0; b < sizeof(BotDLOp); b++) h = (h ^ bytes[b]) * 16777619UL;
+      for (uint16_t b = 0; b < len; b++) h = (h ^ data[b]) * 16777619UL;
+      h = (h ^ shape) * 16777619UL;
+    }
+    h = (h ^ (hasClear ? clearColor : 0x10000UL)) * 16777619UL;
+    return h;
+  }
+
+  // Rasterize rows [bandY, bandY + rows) into buf (LCD_WIDTH * rows pixels)
+  void rasterize(uint16_t *buf, int16_t bandY, int16_t rows) const {
+    int16_t bandEnd = bandY + rows - 1;
+
+    if (hasClear) {
+      for (uint32_t i = 0; i < (uint32_t)LCD_WIDTH * rows; i++) buf[i] = clearColor;
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+      const BotDLOp &op = ops[i];
+      if (op.yBot < bandY || op.yTop > bandEnd) continue;
+      int16_t y0 = max(op.yTop, bandY);
+      int16_t y1 = min(op.yBot, bandEnd);
+      for (int16_t y = y0; y <= y1; y++) {
+        rasterizeRow(op, y, buf + (uint32_t)(y - bandY) * LCD_WIDTH);
+      }
+    }
+  }
+};
+
+// Global display list for bot mode
+BotDisplayList botDL;
+
+#endif // BOT_DISPLAY_LIST_H
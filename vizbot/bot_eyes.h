@@ -5,21 +5,21 @@
 #include <Arduino_GFX_Library.h>
 #include "config.h"
 #include "bot_faces.h"
+#include "bot_display_list.h"
+#include "bot_sprites.h"
 
 // ============================================================================
 // Bot Eye Animation & Rendering Engine
 // ============================================================================
 // Handles all procedural eye drawing, blink timing, idle look-around,
 // IMU pupil tracking, and special eye modes (hearts, spirals, X-eyes, etc.)
+// Drawing is recorded into botDL (bot_display_list.h) and rasterized later.
 //
 // Art direction: Large white ellipses on black. Pupils are black circles
 // that "cut into" the white. Brows are thick arcs/bars above eyes.
 // Maximum 4 colors on screen. Bold, simple, high contrast.
 // ============================================================================
 
-// External GFX object from display_lcd.h
-extern Arduino_GFX *gfx;
-
 // External IMU data from vizpow.ino
 extern float accelX, accelY, accelZ;
 
@@ -42,9 +42,11 @@ extern uint8_t botBackgroundStyle;
 // Blink System
 // ============================================================================
 
+// Blink timing is driven by the scheduler (EV_BLINK in bot_mode.h): the
+// event starts a blink, update() animates it and reports when it's over.
+
 struct BotBlinkState {
-  unsigned long nextBlinkTime;
-  unsigned long blinkStartTime;
+  uint64_t blinkStartTime;
   bool blinking;
   bool doubleBlink;
   uint8_t doubleBlinkPhase;   // 0 = first blink, 1 = gap, 2 = second blink
@@ -56,34 +58,34 @@ struct BotBlinkState {
   static const uint16_t BLINK_MAX_INTERVAL = 7000;  // Max time between blinks
 
   void init() {
-    nextBlinkTime = millis() + random(BLINK_MIN_INTERVAL, BLINK_MAX_INTERVAL);
     blinking = false;
     doubleBlink = false;
     doubleBlinkPhase = 0;
   }
 
-  // Returns blink amount 0.0 (open) to 1.0 (closed)
-  float update() {
-    unsigned long now = millis();
+  // Delay until the next blink
+  uint32_t nextInterval() const {
+    return random(BLINK_MIN_INTERVAL, BLINK_MAX_INTERVAL);
+  }
 
-    if (!blinking) {
-      if (now >= nextBlinkTime) {
-        blinking = true;
-        blinkStartTime = now;
-        doubleBlink = (random(100) < 15);  // 15% chance of double blink
-        doubleBlinkPhase = 0;
-      }
-      return 0.0f;
-    }
+  void start(uint64_t now) {
+    blinking = true;
+    blinkStartTime = now;
+    doubleBlink = (random(100) < 15);  // 15% chance of double blink
+    doubleBlinkPhase = 0;
+  }
 
-    // Currently blinking
-    unsigned long elapsed = now - blinkStartTime;
+  // Returns blink amount 0.0 (open) to 1.0 (closed); clears `blinking`
+  // once the blink is over
+  float update(uint64_t now) {
+    if (!blinking) return 0.0f;
+
+    uint32_t elapsed = (uint32_t)(now - blinkStartTime);
 
     if (!doubleBlink) {
       // Single blink: triangle wave over BLINK_DURATION
       if (elapsed >= BLINK_DURATION) {
         blinking = false;
-        nextBlinkTime = now + random(BLINK_MIN_INTERVAL, BLINK_MAX_INTERVAL);
         return 0.0f;
       }
       float half = BLINK_DURATION / 2.0f;
@@ -98,7 +100,6 @@ struct BotBlinkState {
 
     if (elapsed >= totalAll) {
       blinking = false;
-      nextBlinkTime = now + random(BLINK_MIN_INTERVAL, BLINK_MAX_INTERVAL);
       return 0.0f;
     }
 
@@ -123,13 +124,15 @@ struct BotBlinkState {
 // ============================================================================
 // Idle Look-Around System
 // ============================================================================
+// Like blinks, moves are started by a scheduler event (EV_LOOK); update()
+// animates the move in progress and reports when it has landed.
 
 struct BotLookAround {
   int16_t currentX, currentY;
   int16_t targetX, targetY;
-  unsigned long moveStartTime;
-  unsigned long nextMoveTime;
+  uint64_t moveStartTime;
   uint16_t moveDuration;
+  bool moving;
 
   static const uint16_t LOOK_MIN_INTERVAL = 800;
   static const uint16_t LOOK_MAX_INTERVAL = 2500;
@@ -140,37 +143,39 @@ struct BotLookAround {
   void init() {
     currentX = currentY = 0;
     targetX = targetY = 0;
-    nextMoveTime = millis() + random(1000, 3000);  // Short initial delay
     moveDuration = 400;
-    moveStartTime = 0;
+    moving = false;
   }
 
-  void update(int16_t &outX, int16_t &outY) {
-    unsigned long now = millis();
-
-    if (now >= nextMoveTime && moveStartTime == 0) {
-      // Start a new look
-      targetX = random(-LOOK_MAX_OFFSET, LOOK_MAX_OFFSET + 1);
-      targetY = random(-LOOK_MAX_OFFSET / 2, LOOK_MAX_OFFSET / 2 + 1);
+  // Delay before the first look (short) and between looks
+  uint32_t firstInterval() const { return random(1000, 3000); }
+  uint32_t nextInterval() const { return random(LOOK_MIN_INTERVAL, LOOK_MAX_INTERVAL); }
 
-      // 15% chance to return to center
-      if (random(100) < 15) {
-        targetX = 0;
-        targetY = 0;
-      }
+  // Start a new look
+  void start(uint64_t now) {
+    targetX = random(-LOOK_MAX_OFFSET, LOOK_MAX_OFFSET + 1);
+    targetY = random(-LOOK_MAX_OFFSET / 2, LOOK_MAX_OFFSET / 2 + 1);
 
-      moveDuration = random(MOVE_DURATION_MIN, MOVE_DURATION_MAX);
-      moveStartTime = now;
+    // 15% chance to return to center
+    if (random(100) < 15) {
+      targetX = 0;
+      targetY = 0;
     }
 
-    if (moveStartTime > 0) {
-      unsigned long elapsed = now - moveStartTime;
+    moveDuration = random(MOVE_DURATION_MIN, MOVE_DURATION_MAX);
+    moveStartTime = now;
+    moving = true;
+  }
+
+  // Animate the current move; clears `moving` once it lands
+  void update(uint64_t now, int16_t &outX, int16_t &outY) {
+    if (moving) {
+      uint32_t elapsed = (uint32_t)(now - moveStartTime);
       if (elapsed >= moveDuration) {
         // Move complete
         currentX = targetX;
         currentY = targetY;
-        moveStartTime = 0;
-        nextMoveTime = now + random(LOOK_MIN_INTERVAL, LOOK_MAX_INTERVAL);
+        moving = false;
       } else {
         // Ease-in-out interpolation
         float t = (float)elapsed / moveDuration;
@@ -189,30 +194,39 @@ struct BotLookAround {
 // IMU Pupil Tracking
 // ============================================================================
 
+// Maps the up vector from imuOrient (imu_orientation.h) to pupil offsets.
+// Filtering happens upstream; this adds a small hysteresis so sensor noise
+// around a pixel boundary doesn't make the pupils shimmer.
+
 struct BotIMUTracker {
-  float smoothX, smoothY;
-  static constexpr float SMOOTH_FACTOR = 0.2f;    // Low-pass filter (0-1, lower = smoother)
+  int16_t offsetX, offsetY;  // Current output
+  bool moving;               // Output changed on the last update
   static constexpr float TILT_SCALE = 35.0f;      // Pixels per g of tilt (high = sensitive)
   static constexpr float MAX_OFFSET = 24.0f;      // Max pupil offset from IMU
+  static constexpr float DEADBAND = 0.75f;        // Pixels of hysteresis
 
   void init() {
-    smoothX = 0;
-    smoothY = 0;
+    offsetX = 0;
+    offsetY = 0;
+    moving = false;
   }
 
-  void update(int16_t &outX, int16_t &outY) {
+  void update(float tiltX, float tiltY, int16_t &outX, int16_t &outY) {
     // Map accelerometer tilt to pupil offset
     // Neutral position is standing upright (90 degrees), so subtract 1g from
     // the vertical axis to zero out gravity when the device faces the user
-    float rawX = constrain(-accelY * TILT_SCALE, -MAX_OFFSET, MAX_OFFSET);
-    float rawY = constrain((accelX - 1.0f) * TILT_SCALE, -MAX_OFFSET, MAX_OFFSET);
-
-    // Smooth with exponential filter
-    smoothX += (rawX - smoothX) * SMOOTH_FACTOR;
-    smoothY += (rawY - smoothY) * SMOOTH_FACTOR;
-
-    outX = (int16_t)smoothX;
-    outY = (int16_t)smoothY;
+    float rawX = constrain(-tiltY * TILT_SCALE, -MAX_OFFSET, MAX_OFFSET);
+    float rawY = constrain((tiltX - 1.0f) * TILT_SCALE, -MAX_OFFSET, MAX_OFFSET);
+
+    int16_t x = offsetX, y = offsetY;
+    if (fabsf(rawX - offsetX) > DEADBAND) x = (int16_t)lroundf(rawX);
+    if (fabsf(rawY - offsetY) > DEADBAND) y = (int16_t)lroundf(rawY);
+    moving = (x != offsetX || y != offsetY);
+    offsetX = x;
+    offsetY = y;
+
+    outX = offsetX;
+    outY = offsetY;
   }
 };
 
@@ -220,19 +234,9 @@ struct BotIMUTracker {
 // Eye Rendering Functions
 // ============================================================================
 
-// Draw a thick line (brow) from angle
+// Draw a thick line (brow) from angle — one parallelogram primitive
 void drawThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t thickness, uint16_t color) {
-  for (int16_t t = -thickness / 2; t <= thickness / 2; t++) {
-    // Offset perpendicular to line direction
-    float dx = x1 - x0;
-    float dy = y1 - y0;
-    float len = sqrtf(dx * dx + dy * dy);
-    if (len < 1.0f) len = 1.0f;
-    float nx = -dy / len * t;
-    float ny = dx / len * t;
-    gfx->drawLine(x0 + (int16_t)nx, y0 + (int16_t)ny,
-                   x1 + (int16_t)nx, y1 + (int16_t)ny, color);
-  }
+  botDL.drawThickLine(x0, y0, x1, y1, thickness, color);
 }
 
 // Draw a filled heart shape at given center and size
@@ -242,11 +246,11 @@ void drawHeart(int16_t cx, int16_t cy, int16_t size, uint16_t color) {
   int16_t offsetX = size / 3;
 
   // Two bumps at top
-  gfx->fillCircle(cx - offsetX, cy - r / 3, r, color);
-  gfx->fillCircle(cx + offsetX, cy - r / 3, r, color);
+  botDL.fillCircle(cx - offsetX, cy - r / 3, r, color);
+  botDL.fillCircle(cx + offsetX, cy - r / 3, r, color);
 
   // Triangle pointing down
-  gfx->fillTriangle(
+  botDL.fillTriangle(
     cx - size + 2, cy,
     cx + size - 2, cy,
     cx, cy + size,
@@ -258,13 +262,13 @@ void drawHeart(int16_t cx, int16_t cy, int16_t size, uint16_t color) {
 void drawStar(int16_t cx, int16_t cy, int16_t outerR, int16_t innerR, uint16_t color) {
   // Draw a simple 4-point star using filled triangles
   // Top point
-  gfx->fillTriangle(cx, cy - outerR, cx - innerR, cy, cx + innerR, cy, color);
+  botDL.fillTriangle(cx, cy - outerR, cx - innerR, cy, cx + innerR, cy, color);
   // Bottom point
-  gfx->fillTriangle(cx, cy + outerR, cx - innerR, cy, cx + innerR, cy, color);
+  botDL.fillTriangle(cx, cy + outerR, cx - innerR, cy, cx + innerR, cy, color);
   // Left point
-  gfx->fillTriangle(cx - outerR, cy, cx, cy - innerR, cx, cy + innerR, color);
+  botDL.fillTriangle(cx - outerR, cy, cx, cy - innerR, cx, cy + innerR, color);
   // Right point
-  gfx->fillTriangle(cx + outerR, cy, cx, cy - innerR, cx, cy + innerR, color);
+  botDL.fillTriangle(cx + outerR, cy, cx, cy - innerR, cx, cy + innerR, color);
 }
 
 // Draw spiral inside an eye (for dizzy state)
@@ -277,7 +281,7 @@ void drawSpiral(int16_t cx, int16_t cy, int16_t radius, uint16_t color, float ph
     float r = t * radius;
     int16_t x = cx + (int16_t)(cosf(angle) * r);
     int16_t y = cy + (int16_t)(sinf(angle) * r);
-    gfx->fillCircle(x, y, 2, color);
+    botDL.fillCircle(x, y, 2, color);
   }
 }
 
@@ -292,20 +296,75 @@ void drawXEye(int16_t cx, int16_t cy, int16_t size, uint16_t color) {
 // Draw happy-squint eye: full-size ellipse with a curved-up arc through the middle
 void drawCaretEye(int16_t cx, int16_t cy, int16_t eyeW, int16_t eyeH, uint16_t faceColor, uint16_t bgColor) {
   // Draw full white ellipse
-  gfx->fillEllipse(cx, cy, eyeW, eyeH, faceColor);
+  botDL.fillEllipse(cx, cy, eyeW, eyeH, faceColor);
   // Draw upward-curving arc through the middle (like a happy closed eye)
-  int16_t thickness = 5;
-  for (int16_t x = -eyeW + 4; x <= eyeW - 4; x++) {
-    float t = (float)x / (eyeW - 4);
-    int16_t y = -(int16_t)(eyeH * 0.35f * (1.0f - t * t));  // Upward parabola
-    gfx->fillCircle(cx + x, cy + y, thickness / 2, bgColor);
+  int8_t arc[2 * 60 + 1];
+  int16_t halfW = eyeW - 4;
+  int16_t n = min((int16_t)(2 * halfW + 1), (int16_t)sizeof(arc));
+  for (int16_t i = 0; i < n; i++) {
+    float t = (float)(i - halfW) / halfW;
+    arc[i] = -(int8_t)(eyeH * 0.35f * (1.0f - t * t));  // Upward parabola
   }
+  botDL.fillCurve(cx - halfW, cy, arc, n, 2, bgColor);
+}
+
+// ============================================================================
+// Cached eye sprites
+// ============================================================================
+// Special eye shapes go through botSprites (bot_sprites.h): built from the
+// primitives above once per parameter set, then blitted as one RLE op.
+
+enum BotEyeSprite : uint8_t {
+  SPR_HEART = 1,   // a = size
+  SPR_STAR,        // a = outer radius, b = inner radius
+  SPR_SPIRAL,      // a = radius, b = phase bucket
+  SPR_X,           // a = size
+  SPR_CARET        // a = eye half-width, b = eye half-height
+};
+
+#define BOT_SPIRAL_PHASES 24  // Spiral rotation steps per turn (one cached mask each)
+
+// Builder for botSprites: ink 1 = shape, ink 2 = stroke halo / caret cut
+void buildEyeSprite(uint32_t key, int16_t cx, int16_t cy, const uint16_t *inks, void *) {
+  uint16_t ink1 = inks[0], ink2 = inks[1];
+  uint8_t kind = key >> 28;
+  uint8_t stroke = (key >> 24) & 0x0F;
+  uint8_t a = key >> 16;
+  uint8_t b = key >> 8;
+
+  switch (kind) {
+    case SPR_HEART:
+      if (stroke) drawHeart(cx, cy, a + stroke, ink2);
+      drawHeart(cx, cy, a, ink1);
+      break;
+    case SPR_STAR:
+      if (stroke) drawStar(cx, cy, a + stroke, b + stroke, ink2);
+      drawStar(cx, cy, a, b, ink1);
+      break;
+    case SPR_SPIRAL:
+      drawSpiral(cx, cy, a, ink1, b * TWO_PI / BOT_SPIRAL_PHASES);
+      break;
+    case SPR_X:
+      if (stroke) drawXEye(cx, cy, a + stroke, ink2);
+      drawXEye(cx, cy, a, ink1);
+      break;
+    case SPR_CARET:
+      drawCaretEye(cx, cy, a, b, ink1, ink2);
+      break;
+  }
+}
+
+void drawEyeSprite(uint8_t kind, uint8_t stroke, int16_t a, int16_t b,
+                   int16_t cx, int16_t cy, uint16_t ink1, uint16_t ink2) {
+  uint32_t key = botSpriteKey(kind, stroke, constrain(a, 0, 255), constrain(b, 0, 255));
+  uint16_t inks[3] = { ink1, ink2, 0 };
+  botSprites.draw(key, cx, cy, inks, buildEyeSprite);
 }
 
 // Draw closed eye: full-size ellipse with a flat horizontal line through the middle
 void drawClosedEye(int16_t cx, int16_t cy, int16_t eyeW, int16_t eyeH, uint16_t faceColor, uint16_t bgColor) {
   // Draw full white ellipse
-  gfx->fillEllipse(cx, cy, eyeW, eyeH, faceColor);
+  botDL.fillEllipse(cx, cy, eyeW, eyeH, faceColor);
   // Draw horizontal line through center
   int16_t lineHalfW = eyeW - 4;
   drawThickLine(cx - lineHalfW, cy, cx + lineHalfW, cy, 5, bgColor);
@@ -343,7 +402,7 @@ struct BotPrevFrame {
   void invalidate() { valid = false; }
 };
 
-static BotPrevFrame prevFrame = { .valid = false };
+static BotPrevFrame prevFrame = {};  // valid = false until the first frame
 
 // Erase a thick line from previous frame by overwriting with background
 void erasePrevThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t thickness, uint16_t bgColor) {
@@ -352,7 +411,7 @@ void erasePrevThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t
   int16_t maxX = max(x0, x1) + thickness / 2 + 1;
   int16_t minY = min(y0, y1) - thickness / 2 - 1;
   int16_t maxY = max(y0, y1) + thickness / 2 + 1;
-  gfx->fillRect(minX, minY, maxX - minX + 1, maxY - minY + 1, bgColor);
+  botDL.fillRect(minX, minY, maxX - minX + 1, maxY - minY + 1, bgColor);
 }
 
 // ============================================================================
@@ -361,8 +420,6 @@ void erasePrevThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t
 
 // Render the complete face based on current BotFaceState
 void renderBotFace(BotFaceState &face, uint16_t bgColor) {
-  if (gfx == nullptr) return;
-
   int16_t cx = BOT_FACE_CX;
   int16_t cy = BOT_FACE_CY;
 
@@ -389,9 +446,9 @@ void renderBotFace(BotFaceState &face, uint16_t bgColor) {
         prevFrame.eyeW > face.eyeWhiteW + 2 ||
         prevFrame.eyeH > effectiveEyeH + 2) {
       // Clear old eye bounding boxes
-      gfx->fillRect(leftEyeCX - prevFrame.eyeW - 2, eyeCY - prevFrame.eyeH - 2,
+      botDL.fillRect(leftEyeCX - prevFrame.eyeW - 2, eyeCY - prevFrame.eyeH - 2,
                      prevFrame.eyeW * 2 + 4, prevFrame.eyeH * 2 + 4, bgColor);
-      gfx->fillRect(rightEyeCX - prevFrame.eyeW - 2, eyeCY - prevFrame.eyeH - 2,
+      botDL.fillRect(rightEyeCX - prevFrame.eyeW - 2, eyeCY - prevFrame.eyeH - 2,
                      prevFrame.eyeW * 2 + 4, prevFrame.eyeH * 2 + 4, bgColor);
     }
 
@@ -407,7 +464,7 @@ void renderBotFace(BotFaceState &face, uint16_t bgColor) {
 
     // Erase old mouth area
     if (prevFrame.mouthType != MOUTH_NONE) {
-      gfx->fillRect(prevFrame.mouthLeft - 1, prevFrame.mouthTop - 1,
+      botDL.fillRect(prevFrame.mouthLeft - 1, prevFrame.mouthTop - 1,
                      prevFrame.mouthRight - prevFrame.mouthLeft + 2,
                      prevFrame.mouthBot - prevFrame.mouthTop + 2, bgColor);
     }
@@ -415,6 +472,8 @@ void renderBotFace(BotFaceState &face, uint16_t bgColor) {
 
   // ---- Black stroke behind face elements (only on ambient background) ----
   bool drawStroke = (botBackgroundStyle == 4);
+  // Sprites and arc mouths paint their outline halo in the same op as the fill
+  uint8_t stroke = drawStroke ? BOT_STROKE_PX : 0;
 
   // ---- Draw eyes ----
   // Eye whites are drawn every frame — they naturally cover old pupils
@@ -422,12 +481,12 @@ void renderBotFace(BotFaceState &face, uint16_t bgColor) {
     case EYE_NORMAL: {
       // Black stroke outlines (drawn first, slightly larger)
       if (drawStroke) {
-        gfx->fillEllipse(leftEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, effectiveEyeH + BOT_STROKE_PX, BOT_COLOR_BG);
-        gfx->fillEllipse(rightEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, effectiveEyeH + BOT_STROKE_PX, BOT_COLOR_BG);
+        botDL.fillEllipse(leftEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, effectiveEyeH + BOT_STROKE_PX, BOT_COLOR_BG);
+        botDL.fillEllipse(rightEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, effectiveEyeH + BOT_STROKE_PX, BOT_COLOR_BG);
       }
       // Large white ellipses
-      gfx->fillEllipse(leftEyeCX, eyeCY, face.eyeWhiteW, effectiveEyeH, botFaceColor);
-      gfx->fillEllipse(rightEyeCX, eyeCY, face.eyeWhiteW, effectiveEyeH, botFaceColor);
+      botDL.fillEllipse(leftEyeCX, eyeCY, face.eyeWhiteW, effectiveEyeH, botFaceColor);
+      botDL.fillEllipse(rightEyeCX, eyeCY, face.eyeWhiteW, effectiveEyeH, botFaceColor);
 
       // Pupils (only if eyes are reasonably open)
       if (effectiveEyeH > 8) {
@@ -436,8 +495,8 @@ void renderBotFace(BotFaceState &face, uint16_t bgColor) {
         int16_t pX = constrain(finalPupilX, -maxPupilX, maxPupilX);
         int16_t pY = constrain(finalPupilY, -maxPupilY, maxPupilY);
 
-        gfx->fillCircle(leftEyeCX + pX, eyeCY + pY, face.pupilRadius, BOT_COLOR_PUPIL);
-        gfx->fillCircle(rightEyeCX + pX, eyeCY + pY, face.pupilRadius, BOT_COLOR_PUPIL);
+        botDL.fillCircle(leftEyeCX + pX, eyeCY + pY, face.pupilRadius, BOT_COLOR_PUPIL);
+        botDL.fillCircle(rightEyeCX + pX, eyeCY + pY, face.pupilRadius, BOT_COLOR_PUPIL);
 
         // Track pupil positions
         prevFrame.leftPupilX = leftEyeCX + pX;
@@ -451,66 +510,56 @@ void renderBotFace(BotFaceState &face, uint16_t bgColor) {
 
     case EYE_CARET: {
       if (drawStroke) {
-        gfx->fillEllipse(leftEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, face.eyeWhiteH + BOT_STROKE_PX, BOT_COLOR_BG);
-        gfx->fillEllipse(rightEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, face.eyeWhiteH + BOT_STROKE_PX, BOT_COLOR_BG);
+        botDL.fillEllipse(leftEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, face.eyeWhiteH + BOT_STROKE_PX, BOT_COLOR_BG);
+        botDL.fillEllipse(rightEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, face.eyeWhiteH + BOT_STROKE_PX, BOT_COLOR_BG);
       }
-      drawCaretEye(leftEyeCX, eyeCY, face.eyeWhiteW, face.eyeWhiteH, botFaceColor, bgColor);
-      drawCaretEye(rightEyeCX, eyeCY, face.eyeWhiteW, face.eyeWhiteH, botFaceColor, bgColor);
+      drawEyeSprite(SPR_CARET, 0, face.eyeWhiteW, face.eyeWhiteH, leftEyeCX, eyeCY, botFaceColor, bgColor);
+      drawEyeSprite(SPR_CARET, 0, face.eyeWhiteW, face.eyeWhiteH, rightEyeCX, eyeCY, botFaceColor, bgColor);
       break;
     }
 
     case EYE_HEART: {
       int16_t heartSize = min(face.eyeWhiteW, face.eyeWhiteH) * 3 / 4;
-      if (drawStroke) {
-        drawHeart(leftEyeCX, eyeCY, heartSize + BOT_STROKE_PX, BOT_COLOR_BG);
-        drawHeart(rightEyeCX, eyeCY, heartSize + BOT_STROKE_PX, BOT_COLOR_BG);
-      }
-      drawHeart(leftEyeCX, eyeCY, heartSize, botFaceColor);
-      drawHeart(rightEyeCX, eyeCY, heartSize, botFaceColor);
+      drawEyeSprite(SPR_HEART, stroke, heartSize, 0, leftEyeCX, eyeCY, botFaceColor, BOT_COLOR_BG);
+      drawEyeSprite(SPR_HEART, stroke, heartSize, 0, rightEyeCX, eyeCY, botFaceColor, BOT_COLOR_BG);
       break;
     }
 
     case EYE_X: {
       int16_t xSize = min(face.eyeWhiteW, face.eyeWhiteH) * 2 / 3;
-      if (drawStroke) {
-        drawXEye(leftEyeCX, eyeCY, xSize + BOT_STROKE_PX, BOT_COLOR_BG);
-        drawXEye(rightEyeCX, eyeCY, xSize + BOT_STROKE_PX, BOT_COLOR_BG);
-      }
-      drawXEye(leftEyeCX, eyeCY, xSize, botFaceColor);
-      drawXEye(rightEyeCX, eyeCY, xSize, botFaceColor);
+      drawEyeSprite(SPR_X, stroke, xSize, 0, leftEyeCX, eyeCY, botFaceColor, BOT_COLOR_BG);
+      drawEyeSprite(SPR_X, stroke, xSize, 0, rightEyeCX, eyeCY, botFaceColor, BOT_COLOR_BG);
       break;
     }
 
     case EYE_SPIRAL: {
       if (drawStroke) {
-        gfx->fillEllipse(leftEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, effectiveEyeH + BOT_STROKE_PX, BOT_COLOR_BG);
-        gfx->fillEllipse(rightEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, effectiveEyeH + BOT_STROKE_PX, BOT_COLOR_BG);
+        botDL.fillEllipse(leftEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, effectiveEyeH + BOT_STROKE_PX, BOT_COLOR_BG);
+        botDL.fillEllipse(rightEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, effectiveEyeH + BOT_STROKE_PX, BOT_COLOR_BG);
       }
-      gfx->fillEllipse(leftEyeCX, eyeCY, face.eyeWhiteW, effectiveEyeH, botFaceColor);
-      gfx->fillEllipse(rightEyeCX, eyeCY, face.eyeWhiteW, effectiveEyeH, botFaceColor);
-      float phase = (float)(millis() % 2000) / 2000.0f * TWO_PI;
+      botDL.fillEllipse(leftEyeCX, eyeCY, face.eyeWhiteW, effectiveEyeH, botFaceColor);
+      botDL.fillEllipse(rightEyeCX, eyeCY, face.eyeWhiteW, effectiveEyeH, botFaceColor);
+      // Right eye spins the other way: phase -p is bucket N - b
+      uint8_t bucket = (millis() % 2000) * BOT_SPIRAL_PHASES / 2000;
       int16_t spiralR = min(face.eyeWhiteW, effectiveEyeH) - 6;
-      drawSpiral(leftEyeCX, eyeCY, spiralR, BOT_COLOR_PUPIL, phase);
-      drawSpiral(rightEyeCX, eyeCY, spiralR, BOT_COLOR_PUPIL, -phase);
+      drawEyeSprite(SPR_SPIRAL, 0, spiralR, bucket, leftEyeCX, eyeCY, BOT_COLOR_PUPIL, 0);
+      drawEyeSprite(SPR_SPIRAL, 0, spiralR, (BOT_SPIRAL_PHASES - bucket) % BOT_SPIRAL_PHASES,
+                    rightEyeCX, eyeCY, BOT_COLOR_PUPIL, 0);
       break;
     }
 
     case EYE_STAR: {
       int16_t starOuter = min(face.eyeWhiteW, face.eyeWhiteH) * 3 / 4;
       int16_t starInner = starOuter * 2 / 5;
-      if (drawStroke) {
-        drawStar(leftEyeCX, eyeCY, starOuter + BOT_STROKE_PX, starInner + BOT_STROKE_PX, BOT_COLOR_BG);
-        drawStar(rightEyeCX, eyeCY, starOuter + BOT_STROKE_PX, starInner + BOT_STROKE_PX, BOT_COLOR_BG);
-      }
-      drawStar(leftEyeCX, eyeCY, starOuter, starInner, botFaceColor);
-      drawStar(rightEyeCX, eyeCY, starOuter, starInner, botFaceColor);
+      drawEyeSprite(SPR_STAR, stroke, starOuter, starInner, leftEyeCX, eyeCY, botFaceColor, BOT_COLOR_BG);
+      drawEyeSprite(SPR_STAR, stroke, starOuter, starInner, rightEyeCX, eyeCY, botFaceColor, BOT_COLOR_BG);
       break;
     }
 
     case EYE_CLOSED: {
       if (drawStroke) {
-        gfx->fillEllipse(leftEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, face.eyeWhiteH + BOT_STROKE_PX, BOT_COLOR_BG);
-        gfx->fillEllipse(rightEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, face.eyeWhiteH + BOT_STROKE_PX, BOT_COLOR_BG);
+        botDL.fillEllipse(leftEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, face.eyeWhiteH + BOT_STROKE_PX, BOT_COLOR_BG);
+        botDL.fillEllipse(rightEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, face.eyeWhiteH + BOT_STROKE_PX, BOT_COLOR_BG);
       }
       drawClosedEye(leftEyeCX, eyeCY, face.eyeWhiteW, face.eyeWhiteH, botFaceColor, bgColor);
       drawClosedEye(rightEyeCX, eyeCY, face.eyeWhiteW, face.eyeWhiteH, botFaceColor, bgColor);
@@ -565,7 +614,22 @@ void renderBotFace(BotFaceState &face, uint16_t bgColor) {
   // Track mouth bounds as we draw
   int16_t mTop = mouthCY, mBot = mouthCY, mLeft = mouthCX, mRight = mouthCX;
 
-  switch (face.mouthType) {
+  // Talking: an open ellipse flaps in place of the expression's mouth
+  BotMouthType mouthType = face.mouthType;
+  if (face.talkOpen > 0 && mouthType != MOUTH_NONE) {
+    int16_t rx = max((int16_t)6, (int16_t)(face.mouthWidth / 2));
+    int16_t ry = face.talkOpen;
+    if (drawStroke) {
+      botDL.fillEllipse(mouthCX, mouthCY, rx + BOT_STROKE_PX, ry + BOT_STROKE_PX, BOT_COLOR_BG);
+    }
+    botDL.fillEllipse(mouthCX, mouthCY, rx, ry, botFaceColor);
+    if (ry > 3) botDL.fillEllipse(mouthCX, mouthCY, rx - 3, ry - 3, BOT_COLOR_BG);
+    mLeft = mouthCX - rx - 1; mRight = mouthCX + rx + 1;
+    mTop = mouthCY - ry - 1; mBot = mouthCY + ry + 1;
+    mouthType = MOUTH_NONE;
+  }
+
+  switch (mouthType) {
     case MOUTH_NONE:
       break;
 
@@ -582,36 +646,18 @@ void renderBotFace(BotFaceState &face, uint16_t bgColor) {
     }
 
     case MOUTH_SMILE: {
-      if (drawStroke) {
-        for (int16_t x = -face.mouthWidth; x <= face.mouthWidth; x++) {
-          float t = (float)x / face.mouthWidth;
-          int16_t y = (int16_t)(face.mouthCurve * t * t);
-          gfx->fillCircle(mouthCX + x, mouthCY + y, 2 + BOT_STROKE_PX, BOT_COLOR_BG);
-        }
-      }
-      for (int16_t x = -face.mouthWidth; x <= face.mouthWidth; x++) {
-        float t = (float)x / face.mouthWidth;
-        int16_t y = (int16_t)(face.mouthCurve * t * t);
-        gfx->fillCircle(mouthCX + x, mouthCY + y, 2, botFaceColor);
-      }
+      botDL.fillArc(mouthCX * 2, mouthCY, face.mouthCurve * 16, face.mouthWidth * 2,
+                    mouthCX - face.mouthWidth, mouthCX + face.mouthWidth,
+                    2, botFaceColor, stroke, BOT_COLOR_BG);
       mLeft = mouthCX - face.mouthWidth - 2; mRight = mouthCX + face.mouthWidth + 2;
       mTop = mouthCY - 2; mBot = mouthCY + face.mouthCurve + 2;
       break;
     }
 
     case MOUTH_FROWN: {
-      if (drawStroke) {
-        for (int16_t x = -face.mouthWidth; x <= face.mouthWidth; x++) {
-          float t = (float)x / face.mouthWidth;
-          int16_t y = -(int16_t)(face.mouthCurve * t * t);
-          gfx->fillCircle(mouthCX + x, mouthCY + y, 2 + BOT_STROKE_PX, BOT_COLOR_BG);
-        }
-      }
-      for (int16_t x = -face.mouthWidth; x <= face.mouthWidth; x++) {
-        float t = (float)x / face.mouthWidth;
-        int16_t y = -(int16_t)(face.mouthCurve * t * t);
-        gfx->fillCircle(mouthCX + x, mouthCY + y, 2, botFaceColor);
-      }
+      botDL.fillArc(mouthCX * 2, mouthCY, -face.mouthCurve * 16, face.mouthWidth * 2,
+                    mouthCX - face.mouthWidth, mouthCX + face.mouthWidth,
+                    2, botFaceColor, stroke, BOT_COLOR_BG);
       mLeft = mouthCX - face.mouthWidth - 2; mRight = mouthCX + face.mouthWidth + 2;
       mTop = mouthCY - face.mouthCurve - 2; mBot = mouthCY + 2;
       break;
@@ -619,28 +665,19 @@ void renderBotFace(BotFaceState &face, uint16_t bgColor) {
 
     case MOUTH_OPEN_O: {
       if (drawStroke) {
-        gfx->fillCircle(mouthCX, mouthCY, face.mouthCurve + BOT_STROKE_PX, BOT_COLOR_BG);
+        botDL.fillCircle(mouthCX, mouthCY, face.mouthCurve + BOT_STROKE_PX, BOT_COLOR_BG);
       }
-      gfx->fillCircle(mouthCX, mouthCY, face.mouthCurve, botFaceColor);
-      gfx->fillCircle(mouthCX, mouthCY, face.mouthCurve - 3, BOT_COLOR_BG);
+      botDL.fillCircle(mouthCX, mouthCY, face.mouthCurve, botFaceColor);
+      botDL.fillCircle(mouthCX, mouthCY, face.mouthCurve - 3, BOT_COLOR_BG);
       mLeft = mouthCX - face.mouthCurve - 1; mRight = mouthCX + face.mouthCurve + 1;
       mTop = mouthCY - face.mouthCurve - 1; mBot = mouthCY + face.mouthCurve + 1;
       break;
     }
 
     case MOUTH_GRIN: {
-      if (drawStroke) {
-        for (int16_t x = -face.mouthWidth; x <= face.mouthWidth; x++) {
-          float t = (float)x / face.mouthWidth;
-          int16_t y = (int16_t)(face.mouthCurve * t * t);
-          gfx->fillCircle(mouthCX + x, mouthCY + y, 2 + BOT_STROKE_PX, BOT_COLOR_BG);
-        }
-      }
-      for (int16_t x = -face.mouthWidth; x <= face.mouthWidth; x++) {
-        float t = (float)x / face.mouthWidth;
-        int16_t y = (int16_t)(face.mouthCurve * t * t);
-        gfx->fillCircle(mouthCX + x, mouthCY + y, 2, botFaceColor);
-      }
+      botDL.fillArc(mouthCX * 2, mouthCY, face.mouthCurve * 16, face.mouthWidth * 2,
+                    mouthCX - face.mouthWidth, mouthCX + face.mouthWidth,
+                    2, botFaceColor, stroke, BOT_COLOR_BG);
       drawThickLine(mouthCX - face.mouthWidth + 4, mouthCY + 2,
                      mouthCX + face.mouthWidth - 4, mouthCY + 2, 2, BOT_COLOR_BG);
       mLeft = mouthCX - face.mouthWidth - 2; mRight = mouthCX + face.mouthWidth + 2;
@@ -649,38 +686,25 @@ void renderBotFace(BotFaceState &face, uint16_t bgColor) {
     }
 
     case MOUTH_WAVY: {
-      if (drawStroke) {
-        for (int16_t x = -face.mouthWidth; x <= face.mouthWidth; x++) {
-          float t = (float)x / face.mouthWidth;
-          int16_t y = (int16_t)(sinf(t * PI * 3.0f) * face.mouthCurve);
-          gfx->fillCircle(mouthCX + x, mouthCY + y, 2 + BOT_STROKE_PX, BOT_COLOR_BG);
-        }
-      }
-      for (int16_t x = -face.mouthWidth; x <= face.mouthWidth; x++) {
-        float t = (float)x / face.mouthWidth;
-        int16_t y = (int16_t)(sinf(t * PI * 3.0f) * face.mouthCurve);
-        gfx->fillCircle(mouthCX + x, mouthCY + y, 2, botFaceColor);
+      int8_t wave[2 * 60 + 1];
+      int16_t n = min((int16_t)(2 * face.mouthWidth + 1), (int16_t)sizeof(wave));
+      for (int16_t i = 0; i < n; i++) {
+        float t = (float)(i - face.mouthWidth) / face.mouthWidth;
+        wave[i] = (int8_t)(sinf(t * PI * 3.0f) * face.mouthCurve);
       }
+      botDL.fillCurve(mouthCX - face.mouthWidth, mouthCY, wave, n,
+                      2, botFaceColor, stroke, BOT_COLOR_BG);
       mLeft = mouthCX - face.mouthWidth - 2; mRight = mouthCX + face.mouthWidth + 2;
       mTop = mouthCY - face.mouthCurve - 2; mBot = mouthCY + face.mouthCurve + 2;
       break;
     }
 
     case MOUTH_SMIRK: {
-      if (drawStroke) {
-        for (int16_t x = -face.mouthWidth; x <= face.mouthWidth; x++) {
-          float t = (float)x / face.mouthWidth;
-          float normalized = (t + 1.0f) / 2.0f;
-          int16_t y = (int16_t)(face.mouthCurve * normalized * normalized);
-          gfx->fillCircle(mouthCX + x, mouthCY + y - face.mouthCurve / 3, 2 + BOT_STROKE_PX, BOT_COLOR_BG);
-        }
-      }
-      for (int16_t x = -face.mouthWidth; x <= face.mouthWidth; x++) {
-        float t = (float)x / face.mouthWidth;
-        float normalized = (t + 1.0f) / 2.0f;
-        int16_t y = (int16_t)(face.mouthCurve * normalized * normalized);
-        gfx->fillCircle(mouthCX + x, mouthCY + y - face.mouthCurve / 3, 2, botFaceColor);
-      }
+      // Right half of a parabola whose vertex sits at the left corner
+      botDL.fillArc((mouthCX - face.mouthWidth) * 2, mouthCY - face.mouthCurve / 3,
+                    face.mouthCurve * 16, face.mouthWidth * 4,
+                    mouthCX - face.mouthWidth, mouthCX + face.mouthWidth,
+                    2, botFaceColor, stroke, BOT_COLOR_BG);
       mLeft = mouthCX - face.mouthWidth - 2; mRight = mouthCX + face.mouthWidth + 2;
       mTop = mouthCY - face.mouthCurve / 3 - 2; mBot = mouthCY + face.mouthCurve + 2;
       break;
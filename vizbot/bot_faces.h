@@ -7,7 +7,8 @@
 // Bot Face Expression System
 // ============================================================================
 // Each expression is a struct of numeric parameters that define the face.
-// Transitions between expressions are done by lerping all parameters.
+// Transitions between expressions are done by lerping all parameters along
+// an easing curve; timelines chain several transitions with holds.
 // Rendering uses TFT drawing primitives only — no sprites.
 //
 // Eye style: large white ellipses (overlapping at center), dark pupils,
@@ -334,20 +335,110 @@ const BotExpression botExpressions[BOT_NUM_EXPRESSIONS] PROGMEM = {
 };
 
 // ============================================================================
-// Expression interpolation helpers
+// Easing curves
 // ============================================================================
+// Progress in and out is 0-256 (256 = target reached). Overshoot and spring
+// go past 256 before settling, so eased lerps can leave the [from, to] range.
+// Curves are 17-point tables in flash, linearly interpolated.
+
+enum BotEase : uint8_t {
+  EASE_LINEAR = 0,
+  EASE_IN_OUT,       // Smoothstep
+  EASE_OUT,          // Cubic — fast start, soft landing
+  EASE_OVERSHOOT,    // Back-out, ~10% past the target
+  EASE_SPRING,       // Damped oscillation, ~20% past the target
+  BOT_NUM_EASES
+};
+
+#define BOT_EASE_STEPS 16
+
+const int16_t botEaseCurves[BOT_NUM_EASES][BOT_EASE_STEPS + 1] PROGMEM = {
+  { 0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240, 256 },
+  { 0, 3, 11, 24, 40, 59, 81, 104, 128, 152, 175, 197, 216, 232, 245, 253, 256 },
+  { 0, 45, 84, 119, 148, 173, 194, 210, 224, 235, 242, 248, 252, 254, 256, 256, 256 },
+  { 0, 69, 126, 173, 209, 237, 257, 271, 278, 281, 281, 277, 272, 267, 261, 258, 256 },
+  { 0, 100, 204, 276, 308, 309, 292, 272, 256, 247, 246, 248, 252, 255, 257, 258, 256 },
+};
 
-// Lerp a single int16_t value
-inline int16_t lerpI16(int16_t a, int16_t b, uint8_t t) {
-  // t: 0-255 (0 = a, 255 = b)
-  return a + (((int32_t)(b - a) * t) >> 8);
+// Eased progress for linear progress t (0-256)
+inline int16_t botEase(uint8_t ease, uint16_t t) {
+  if (ease >= BOT_NUM_EASES) ease = EASE_LINEAR;
+  if (t >= 256) return 256;
+  uint8_t i = t >> 4;
+  int16_t a = (int16_t)pgm_read_word(&botEaseCurves[ease][i]);
+  int16_t b = (int16_t)pgm_read_word(&botEaseCurves[ease][i + 1]);
+  return a + (((b - a) * (int16_t)(t & 15)) >> 4);
 }
 
-// Lerp a single int8_t value
-inline int8_t lerpI8(int8_t a, int8_t b, uint8_t t) {
-  return a + (((int16_t)(b - a) * t) >> 8);
+// ============================================================================
+// Expression timelines
+// ============================================================================
+// A timeline chains keyframes: blend to an expression with an easing curve,
+// then hold it before moving on. Keyframes live in one flash array and each
+// timeline is a (first, count) slice of it, so adding timelines or
+// expressions costs flash only.
+
+struct BotKeyframe {
+  uint8_t expr;
+  uint8_t ease;
+  uint8_t snap;          // Blend point (0-255) where eye mode/mouth/brows switch
+  uint16_t durationMs;   // 0 = the expression's default transition time
+  uint16_t holdMs;       // Time to hold after arriving
+};
+
+struct BotTimeline {
+  uint8_t first;
+  uint8_t count;
+};
+
+#define TL_WAKE_UP      0   // Startled awake, happy to see you, settle
+#define TL_DIZZY        1   // Shaken: spin out, confused, recover
+#define TL_GIGGLE       2   // Bouncy happy/bliss/happy
+#define TL_DOUBLE_TAKE  3   // Confused, surprised, skeptical
+#define BOT_NUM_TIMELINES 4
+#define BOT_NO_TIMELINE 0xFF
+
+const BotKeyframe botKeyframes[] PROGMEM = {
+  // TL_WAKE_UP
+  { EXPR_SURPRISED, EASE_OVERSHOOT, 48,  180, 500 },
+  { EXPR_HAPPY,     EASE_OUT,       128, 300, 900 },
+  { EXPR_NEUTRAL,   EASE_IN_OUT,    128, 500, 0 },
+  // TL_DIZZY
+  { EXPR_DIZZY,     EASE_SPRING,    32,  150, 1800 },
+  { EXPR_CONFUSED,  EASE_OUT,       128, 400, 600 },
+  { EXPR_NEUTRAL,   EASE_IN_OUT,    128, 500, 0 },
+  // TL_GIGGLE
+  { EXPR_HAPPY,     EASE_SPRING,    64,  250, 300 },
+  { EXPR_BLISS,     EASE_OUT,       128, 250, 400 },
+  { EXPR_HAPPY,     EASE_SPRING,    64,  250, 600 },
+  { EXPR_NEUTRAL,   EASE_IN_OUT,    128, 500, 0 },
+  // TL_DOUBLE_TAKE
+  { EXPR_CONFUSED,  EASE_OUT,       128, 300, 500 },
+  { EXPR_SURPRISED, EASE_OVERSHOOT, 32,  120, 400 },
+  { EXPR_SKEPTICAL, EASE_OUT,       128, 350, 1200 },
+  { EXPR_NEUTRAL,   EASE_IN_OUT,    128, 500, 0 },
+};
+
+const BotTimeline botTimelines[BOT_NUM_TIMELINES] PROGMEM = {
+  { 0, 3 },    // TL_WAKE_UP
+  { 3, 3 },    // TL_DIZZY
+  { 6, 4 },    // TL_GIGGLE
+  { 10, 4 },   // TL_DOUBLE_TAKE
+};
+
+// ============================================================================
+// Expression interpolation helpers
+// ============================================================================
+
+// Lerp with eased progress (0-256, may overshoot either end)
+inline int16_t lerpEased(int16_t a, int16_t b, int16_t e) {
+  return a + (((int32_t)(b - a) * e) >> 8);
 }
 
+// Expression lookup across built-ins and the uploaded pack (bot_expr_pack.h)
+uint16_t botExpressionCount();
+void botReadExpression(uint16_t index, BotExpression &out);
+
 // Runtime expression state (interpolated values — not in PROGMEM)
 struct BotFaceState {
   // Interpolated parameters
@@ -367,20 +458,30 @@ struct BotFaceState {
   // Blink state
   float blinkAmount;       // 0.0 = open, 1.0 = fully closed
 
+  // Talking (set while a speech bubble types out)
+  uint8_t talkOpen;        // Open mouth height in px; 0 = expression mouth
+
   // Transition state
-  uint8_t currentExpr;
-  uint8_t targetExpr;
-  uint8_t blendT;          // 0-255 blend factor
+  uint16_t currentExpr;    // Expression index (built-in or pack)
+  uint16_t targetExpr;
+  uint8_t blendT;          // 0-255 linear blend progress
   unsigned long transitionStart;
   uint16_t transitionDuration;
   bool transitioning;
 
-  // Load expression from PROGMEM
-  void loadExpression(uint8_t index) {
-    if (index >= BOT_NUM_EXPRESSIONS) index = EXPR_NEUTRAL;
-    BotExpression e;
-    memcpy_P(&e, &botExpressions[index], sizeof(BotExpression));
+  // Blend sources, cached in RAM when a transition starts
+  BotExpression from, to;
+  uint8_t ease;
+  uint8_t snap;
+
+  // Timeline playback
+  uint8_t timeline;        // BOT_NO_TIMELINE when not playing
+  uint8_t keyIndex;
+  uint16_t holdMs;         // Hold for the current keyframe
+  unsigned long arrivedAt;
 
+  // Copy a pose into the live parameters
+  void apply(const BotExpression &e) {
     eyeWhiteW = e.eyeWhiteW;
     eyeWhiteH = e.eyeWhiteH;
     eyeSpacing = e.eyeSpacing;
@@ -398,6 +499,36 @@ struct BotFaceState {
     mouthOffsetY = e.mouthOffsetY;
     mouthCurve = e.mouthCurve;
     eyeMode = e.eyeMode;
+  }
+
+  // Snapshot the live parameters (interrupted transitions start from here)
+  void capture(BotExpression &e) const {
+    e.eyeWhiteW = eyeWhiteW;
+    e.eyeWhiteH = eyeWhiteH;
+    e.eyeSpacing = eyeSpacing;
+    e.pupilRadius = pupilRadius;
+    e.pupilOffsetX = pupilOffsetX;
+    e.pupilOffsetY = pupilOffsetY;
+    e.browOffsetY = browOffsetY;
+    e.browLength = browLength;
+    e.browThickness = browThickness;
+    e.browAngleL = browAngleL;
+    e.browAngleR = browAngleR;
+    e.browVisible = browVisible;
+    e.mouthType = mouthType;
+    e.mouthWidth = mouthWidth;
+    e.mouthOffsetY = mouthOffsetY;
+    e.mouthCurve = mouthCurve;
+    e.eyeMode = eyeMode;
+    e.transitionMs = 0;
+  }
+
+  // Load expression (PROGMEM or pack)
+  void loadExpression(uint16_t index) {
+    if (index >= botExpressionCount()) index = EXPR_NEUTRAL;
+    botReadExpression(index, to);
+    from = to;
+    apply(to);
 
     currentExpr = index;
     targetExpr = index;
@@ -405,68 +536,127 @@ struct BotFaceState {
     transitioning = false;
   }
 
-  // Start transitioning to a new expression
-  void transitionTo(uint8_t index, uint16_t durationMs = 0) {
-    if (index >= BOT_NUM_EXPRESSIONS) index = EXPR_NEUTRAL;
-    if (index == targetExpr && !transitioning) return;
+  // Begin blending from the live pose to `index`
+  void startBlend(uint16_t index, uint16_t durationMs, uint8_t easeType, uint8_t snapAt) {
+    if (index >= botExpressionCount()) index = EXPR_NEUTRAL;
+    capture(from);
+    botReadExpression(index, to);
 
-    // Read target's default transition time if none specified
-    if (durationMs == 0) {
-      BotExpression e;
-      memcpy_P(&e, &botExpressions[index], sizeof(BotExpression));
-      durationMs = e.transitionMs;
-    }
+    // Use target's default transition time if none specified
+    if (durationMs == 0) durationMs = to.transitionMs;
 
-    // Current interpolated state becomes the "from" snapshot
     currentExpr = targetExpr;
     targetExpr = index;
     blendT = 0;
+    ease = easeType;
+    snap = snapAt;
     transitionStart = millis();
-    transitionDuration = durationMs;
+    transitionDuration = max(durationMs, (uint16_t)1);
     transitioning = true;
   }
 
-  // Update transition (call each frame)
+  // Start transitioning to a new expression (stops any timeline)
+  void transitionTo(uint16_t index, uint16_t durationMs = 0, uint8_t easeType = EASE_OUT) {
+    if (index >= botExpressionCount()) index = EXPR_NEUTRAL;
+    if (index == targetExpr && !transitioning && timeline == BOT_NO_TIMELINE) return;
+    timeline = BOT_NO_TIMELINE;
+    startBlend(index, durationMs, easeType, 128);
+  }
+
+  // ---- Timelines ----
+
+  void startKeyframe() {
+    BotTimeline tl;
+    BotKeyframe k;
+    memcpy_P(&tl, &botTimelines[timeline], sizeof(BotTimeline));
+    memcpy_P(&k, &botKeyframes[tl.first + keyIndex], sizeof(BotKeyframe));
+    holdMs = k.holdMs;
+    startBlend(k.expr, k.durationMs, k.ease, k.snap);
+  }
+
+  void playTimeline(uint8_t id) {
+    if (id >= BOT_NUM_TIMELINES) return;
+    timeline = id;
+    keyIndex = 0;
+    startKeyframe();
+  }
+
+  bool playingTimeline() const { return timeline != BOT_NO_TIMELINE; }
+
+  // Total play time of a timeline in ms
+  uint32_t timelineDurationMs(uint8_t id) const {
+    if (id >= BOT_NUM_TIMELINES) return 0;
+    BotTimeline tl;
+    memcpy_P(&tl, &botTimelines[id], sizeof(BotTimeline));
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < tl.count; i++) {
+      BotKeyframe k;
+      memcpy_P(&k, &botKeyframes[tl.first + i], sizeof(BotKeyframe));
+      uint16_t d = k.durationMs;
+      if (d == 0) d = pgm_read_word(&botExpressions[k.expr].transitionMs);
+      total += d + k.holdMs;
+    }
+    return total;
+  }
+
+  // Update transition and timeline (call each frame)
   void update() {
-    if (!transitioning) return;
+    unsigned long now = millis();
+
+    if (transitioning) {
+      unsigned long elapsed = now - transitionStart;
+      if (elapsed >= transitionDuration) {
+        // Transition complete
+        apply(to);
+        currentExpr = targetExpr;
+        blendT = 255;
+        transitioning = false;
+        arrivedAt = now;
+      } else {
+        blendFrame((uint16_t)((elapsed * 256UL) / transitionDuration));
+        return;
+      }
+    }
 
-    unsigned long elapsed = millis() - transitionStart;
-    if (elapsed >= transitionDuration) {
-      // Transition complete
-      loadExpression(targetExpr);
-      return;
+    // Advance the timeline once the current keyframe's hold is over
+    if (timeline != BOT_NO_TIMELINE && now - arrivedAt >= holdMs) {
+      BotTimeline tl;
+      memcpy_P(&tl, &botTimelines[timeline], sizeof(BotTimeline));
+      if (++keyIndex < tl.count) {
+        startKeyframe();
+      } else {
+        timeline = BOT_NO_TIMELINE;
+      }
     }
+  }
 
-    // Calculate blend factor (0-255)
-    blendT = (uint8_t)((elapsed * 255UL) / transitionDuration);
-
-    // Read both expressions from PROGMEM
-    BotExpression from, to;
-    memcpy_P(&from, &botExpressions[currentExpr], sizeof(BotExpression));
-    memcpy_P(&to, &botExpressions[targetExpr], sizeof(BotExpression));
-
-    // Lerp all numeric parameters
-    eyeWhiteW = lerpI16(from.eyeWhiteW, to.eyeWhiteW, blendT);
-    eyeWhiteH = lerpI16(from.eyeWhiteH, to.eyeWhiteH, blendT);
-    eyeSpacing = lerpI16(from.eyeSpacing, to.eyeSpacing, blendT);
-    pupilRadius = lerpI16(from.pupilRadius, to.pupilRadius, blendT);
-    pupilOffsetX = lerpI16(from.pupilOffsetX, to.pupilOffsetX, blendT);
-    pupilOffsetY = lerpI16(from.pupilOffsetY, to.pupilOffsetY, blendT);
-    browOffsetY = lerpI16(from.browOffsetY, to.browOffsetY, blendT);
-    browLength = lerpI16(from.browLength, to.browLength, blendT);
-    browThickness = lerpI16(from.browThickness, to.browThickness, blendT);
-    browAngleL = lerpI8(from.browAngleL, to.browAngleL, blendT);
-    browAngleR = lerpI8(from.browAngleR, to.browAngleR, blendT);
-
-    mouthWidth = lerpI16(from.mouthWidth, to.mouthWidth, blendT);
-    mouthOffsetY = lerpI16(from.mouthOffsetY, to.mouthOffsetY, blendT);
-    mouthCurve = lerpI16(from.mouthCurve, to.mouthCurve, blendT);
-
-    // Discrete parameters snap at halfway point
-    bool pastHalf = (blendT >= 128);
-    browVisible = pastHalf ? to.browVisible : from.browVisible;
-    mouthType = pastHalf ? to.mouthType : from.mouthType;
-    eyeMode = pastHalf ? to.eyeMode : from.eyeMode;
+  // Interpolate the cached blend sources at linear progress t (0-255)
+  void blendFrame(uint16_t t) {
+    blendT = (uint8_t)min(t, (uint16_t)255);
+    int16_t e = botEase(ease, t);
+
+    // Lerp all numeric parameters; sizes can't go negative on overshoot
+    eyeWhiteW = max(lerpEased(from.eyeWhiteW, to.eyeWhiteW, e), (int16_t)0);
+    eyeWhiteH = max(lerpEased(from.eyeWhiteH, to.eyeWhiteH, e), (int16_t)0);
+    eyeSpacing = lerpEased(from.eyeSpacing, to.eyeSpacing, e);
+    pupilRadius = max(lerpEased(from.pupilRadius, to.pupilRadius, e), (int16_t)0);
+    pupilOffsetX = lerpEased(from.pupilOffsetX, to.pupilOffsetX, e);
+    pupilOffsetY = lerpEased(from.pupilOffsetY, to.pupilOffsetY, e);
+    browOffsetY = lerpEased(from.browOffsetY, to.browOffsetY, e);
+    browLength = max(lerpEased(from.browLength, to.browLength, e), (int16_t)0);
+    browThickness = max(lerpEased(from.browThickness, to.browThickness, e), (int16_t)1);
+    browAngleL = (int8_t)constrain(lerpEased(from.browAngleL, to.browAngleL, e), -90, 90);
+    browAngleR = (int8_t)constrain(lerpEased(from.browAngleR, to.browAngleR, e), -90, 90);
+
+    mouthWidth = max(lerpEased(from.mouthWidth, to.mouthWidth, e), (int16_t)0);
+    mouthOffsetY = lerpEased(from.mouthOffsetY, to.mouthOffsetY, e);
+    mouthCurve = lerpEased(from.mouthCurve, to.mouthCurve, e);
+
+    // Discrete parameters switch at the keyframe's snap point
+    bool pastSnap = (blendT >= snap);
+    browVisible = pastSnap ? to.browVisible : from.browVisible;
+    mouthType = pastSnap ? to.mouthType : from.mouthType;
+    eyeMode = pastSnap ? to.eyeMode : from.eyeMode;
   }
 
   // Initialize to neutral
@@ -474,7 +664,9 @@ struct BotFaceState {
     dynamicPupilX = 0;
     dynamicPupilY = 0;
     blinkAmount = 0.0f;
+    talkOpen = 0;
     transitioning = false;
+    timeline = BOT_NO_TIMELINE;
     loadExpression(EXPR_NEUTRAL);
   }
 };
@@ -4,9 +4,16 @@
 #include <Arduino.h>
 #include "config.h"
 #include "bot_faces.h"
+#include "bot_expr_pack.h"
 #include "bot_eyes.h"
 #include "bot_sayings.h"
 #include "bot_overlays.h"
+#include "bot_background.h"
+#include "bot_scheduler.h"
+#include "i2c_bus.h"
+#include "imu_orientation.h"
+#include "imu_gestures.h"
+#include "bot_present.h"
 
 // ============================================================================
 // Bot Mode — Main State Machine & Render Pipeline
@@ -22,7 +29,7 @@
 
 // External references
 extern Arduino_GFX *gfx;
-extern float accelX, accelY, accelZ;
+extern float accelPeak;  // Largest |accel| in the last IMU burst
 extern bool menuVisible;
 
 // Bot activity states
@@ -39,6 +46,9 @@ enum BotState : uint8_t {
 
 #define BOT_WAKE_THRESHOLD     1.8f      // Acceleration magnitude to wake from sleep
 #define BOT_FRAME_DELAY_MS     33        // ~30 FPS target
+#define BOT_FPS_IDLE           10        // Idle and sleepy (short animations still get full rate)
+#define BOT_FPS_SLEEPING       4         // Only the Zzz drift moves
+#define BOT_INPUT_POLL_MS      50        // Longest loop sleep — IMU/touch are polled at least this often
 
 // ============================================================================
 // Personality Presets
@@ -100,21 +110,17 @@ struct BotModeState {
   BotTimeOverlay timeOverlay;
   BotWeatherOverlay weatherOverlay;
 
-  // Timing
-  unsigned long lastInteraction;     // Last touch/shake event
-  unsigned long lastFrameTime;
-  unsigned long nextRandomExpr;      // Next random idle expression change
-  unsigned long nextIdleSaying;      // Next random idle saying
-  unsigned long stateEnteredTime;    // When current state was entered
-  unsigned long lastMotionMag;       // For motion detection
+  // Timing (botNowMs — idle expressions, sayings and timeouts are
+  // scheduler events, see bot_scheduler.h)
+  uint64_t lastInteraction;          // Last touch/shake event
+  uint64_t stateEnteredTime;         // When current state was entered
 
   // Sleeping animation
   float sleepBreathPhase;            // Breathing animation phase
   unsigned long lastZzzTime;         // Zzz particle timing
 
-  // Shake reaction
+  // Shake reaction (ended by EV_REACT_END)
   bool shakeReacting;
-  unsigned long shakeReactEnd;
 
   // Personality
   uint8_t personalityIndex;
@@ -138,11 +144,13 @@ struct BotModeState {
     weatherOverlay.init();
     personalityIndex = PERSONALITY_CHILL;
     personality = &botPersonalities[PERSONALITY_CHILL];
-    lastInteraction = millis();
-    lastFrameTime = millis();
-    nextRandomExpr = millis() + random(personality->exprMinMs, personality->exprMaxMs);
-    nextIdleSaying = millis() + random(personality->sayMinMs, personality->sayMaxMs);
-    stateEnteredTime = millis();
+    lastInteraction = botNowMs();
+    stateEnteredTime = lastInteraction;
+    botScheduler.clear();
+    botScheduler.schedule(EV_BLINK, blink.nextInterval());
+    botScheduler.schedule(EV_LOOK, lookAround.firstInterval());
+    scheduleIdleBehavior();
+    scheduleStateTimeout();
     sleepBreathPhase = 0;
     lastZzzTime = 0;
     shakeReacting = false;
@@ -151,42 +159,80 @@ struct BotModeState {
     initialized = true;
   }
 
+  // Next idle expression change and idle saying (personality-driven)
+  void scheduleIdleBehavior() {
+    botScheduler.schedule(EV_IDLE_EXPR, random(personality->exprMinMs, personality->exprMaxMs));
+    botScheduler.schedule(EV_IDLE_SAYING, random(personality->sayMinMs, personality->sayMaxMs));
+  }
+
+  // Next activity-state check, measured from the last interaction
+  void scheduleStateTimeout() {
+    uint32_t timeoutMs;
+    switch (state) {
+      case BOT_ACTIVE: timeoutMs = personality->idleTimeoutMs; break;
+      case BOT_IDLE:   timeoutMs = personality->sleepyTimeoutMs; break;
+      case BOT_SLEEPY: timeoutMs = personality->sleepTimeoutMs; break;
+      default:
+        botScheduler.cancel(EV_STATE_TIMEOUT);  // Sleeping: woken by motion
+        return;
+    }
+    botScheduler.scheduleAt(EV_STATE_TIMEOUT, lastInteraction + timeoutMs + 1);
+  }
+
+  // Hold a reaction expression, then return to neutral
+  void react(uint32_t durationMs) {
+    shakeReacting = true;
+    botScheduler.schedule(EV_REACT_END, durationMs);
+  }
+
+  void enterState(BotState newState) {
+    state = newState;
+    stateEnteredTime = botNowMs();
+    scheduleStateTimeout();
+  }
+
   // Register an interaction (resets idle timers)
   void registerInteraction() {
-    lastInteraction = millis();
+    lastInteraction = botNowMs();
     if (state != BOT_ACTIVE) {
       wake();
+    } else {
+      scheduleStateTimeout();
     }
   }
 
   // Wake from any sleep/idle state
   void wake() {
     if (state == BOT_SLEEPING || state == BOT_SLEEPY) {
-      // Wake-up: transition to surprised briefly, then neutral
-      face.transitionTo(EXPR_SURPRISED, 200);
-      shakeReacting = true;
-      shakeReactEnd = millis() + 800;
+      // Wake-up: startled, happy, then settle back to neutral
+      face.playTimeline(TL_WAKE_UP);
+      react(face.timelineDurationMs(TL_WAKE_UP));
 
       // Show wake-up saying
       char buf[32];
       getRandomSayingText(SAY_WAKE, buf, sizeof(buf));
       speechBubble.show(buf, 2000);
     }
-    state = BOT_ACTIVE;
-    stateEnteredTime = millis();
-    lastInteraction = millis();
-    nextRandomExpr = millis() + random(personality->exprMinMs, personality->exprMaxMs);
-    nextIdleSaying = millis() + random(personality->sayMinMs, personality->sayMaxMs);
+    lastInteraction = botNowMs();
+    enterState(BOT_ACTIVE);
+    scheduleIdleBehavior();
   }
 
   // Called when bot receives a tap
   void onTap() {
     registerInteraction();
 
-    // Pick a random reaction expression
+    // Pick a random reaction: a snappy expression or a short timeline
     uint8_t reactions[] = { EXPR_SURPRISED, EXPR_HAPPY, EXPR_EXCITED, EXPR_MISCHIEF, EXPR_LOVE, EXPR_SHY, EXPR_CONFUSED, EXPR_PROUD };
-    uint8_t pick = reactions[random(0, 8)];
-    face.transitionTo(pick, 150);
+    uint8_t pick = random(0, 10);
+    uint32_t reactMs = 2000;
+    if (pick < 8) {
+      face.transitionTo(reactions[pick], 150, EASE_OVERSHOOT);
+    } else {
+      uint8_t tl = (pick == 8) ? TL_GIGGLE : TL_DOUBLE_TAKE;
+      face.playTimeline(tl);
+      reactMs = face.timelineDurationMs(tl);
+    }
 
     // Maybe show a tap saying
     if (random(100) < personality->sayChancePercent) {
@@ -196,26 +242,38 @@ struct BotModeState {
     }
 
     // Schedule return to neutral
-    shakeReacting = true;
-    shakeReactEnd = millis() + 2000;
+    react(reactMs);
+  }
+
+  // Called on a double tap on the screen (after the first tap's reaction)
+  void onDoubleTap() {
+    registerInteraction();
+    face.playTimeline(TL_GIGGLE);
+    react(face.timelineDurationMs(TL_GIGGLE));
+  }
+
+  // Fall asleep right away (placed face down)
+  void sleep() {
+    if (state == BOT_SLEEPING) return;
+    face.transitionTo(EXPR_SLEEPY, 600);
+    enterState(BOT_SLEEPING);
   }
 
   // Called on strong shake
   void onShake() {
     registerInteraction();
-    face.transitionTo(EXPR_DIZZY, 150);
+    face.playTimeline(TL_DIZZY);
 
     // Show shake saying
     char buf[32];
     getRandomSayingText(SAY_REACT_SHAKE, buf, sizeof(buf));
     speechBubble.show(buf, 2500);
 
-    shakeReacting = true;
-    shakeReactEnd = millis() + 2500;
+    react(face.timelineDurationMs(TL_DIZZY));
   }
 
   // Set expression from external source (web UI, etc.)
-  void setExpression(uint8_t exprIndex, uint16_t duration = 0) {
+  void setExpression(uint16_t exprIndex, uint16_t duration = 0) {
     registerInteraction();
     face.transitionTo(exprIndex, duration);
     shakeReacting = false;
@@ -237,99 +295,163 @@ struct BotModeState {
 BotModeState botMode;
 
 // ============================================================================
-// Bot Mode Update (called each frame when in Bot Mode)
+// IMU gestures (imu_gestures.h)
 // ============================================================================
-
-void updateBotMode() {
-  if (!botMode.initialized) {
-    botMode.init();
+// A shake stroke makes the bot dizzy and a knock-knock (double tap) counts as
+// a tap. Single IMU taps only register interaction — touching the screen
+// produces them too. Face down puts the bot to sleep, face up wakes it.
+
+void botHandleGesture(const GestureEvent &ev) {
+  if (!botMode.initialized) return;
+  switch (ev.type) {
+    case GEST_SHAKE:
+      if (!botMode.shakeReacting) botMode.onShake();
+      break;
+    case GEST_DOUBLE_TAP:
+      botMode.onTap();
+      break;
+    case GEST_TAP:
+      botMode.registerInteraction();
+      break;
+    case GEST_FACE_DOWN:
+      botMode.sleep();
+      break;
+    case GEST_FACE_UP:
+      botMode.wake();
+      break;
+    default:
+      break;
   }
+}
 
-  unsigned long now = millis();
-  unsigned long timeSinceInteraction = now - botMode.lastInteraction;
-
-  // Skip if menu is visible
-  if (menuVisible) return;
+// ============================================================================
+// Bot Mode Update (called each frame when in Bot Mode)
+// ============================================================================
 
-  // ---- State machine: activity level transitions (personality-driven) ----
+// Activity-state timeout: step ACTIVE -> IDLE -> SLEEPY -> SLEEPING
+void onBotStateTimeout(uint64_t now) {
+  uint64_t timeSinceInteraction = now - botMode.lastInteraction;
   const BotPersonality* p = botMode.personality;
   switch (botMode.state) {
     case BOT_ACTIVE:
-      if (timeSinceInteraction > p->sleepyTimeoutMs) {
-        botMode.state = BOT_SLEEPY;
-        botMode.stateEnteredTime = now;
-        botMode.face.transitionTo(EXPR_SLEEPY, 1000);
-
-        char buf[32];
-        getRandomSayingText(SAY_SLEEP, buf, sizeof(buf));
-        botMode.speechBubble.show(buf, 3000);
-      } else if (timeSinceInteraction > p->idleTimeoutMs) {
-        if (botMode.state != BOT_IDLE) {
-          botMode.state = BOT_IDLE;
-          botMode.stateEnteredTime = now;
-        }
-      }
-      break;
-
     case BOT_IDLE:
       if (timeSinceInteraction > p->sleepyTimeoutMs) {
-        botMode.state = BOT_SLEEPY;
-        botMode.stateEnteredTime = now;
+        botMode.enterState(BOT_SLEEPY);
         botMode.face.transitionTo(EXPR_SLEEPY, 1000);
 
         char buf[32];
         getRandomSayingText(SAY_SLEEP, buf, sizeof(buf));
         botMode.speechBubble.show(buf, 3000);
+      } else if (timeSinceInteraction > p->idleTimeoutMs && botMode.state != BOT_IDLE) {
+        botMode.enterState(BOT_IDLE);
+      } else {
+        botMode.scheduleStateTimeout();
       }
       break;
 
     case BOT_SLEEPY:
       if (timeSinceInteraction > p->sleepTimeoutMs) {
-        botMode.state = BOT_SLEEPING;
-        botMode.stateEnteredTime = now;
+        botMode.enterState(BOT_SLEEPING);
+      } else {
+        botMode.scheduleStateTimeout();
       }
       break;
 
     case BOT_SLEEPING:
-      // Check for wake-up via motion
+      break;
+  }
+}
+
+// Handle one due behavior event
+void handleBotEvent(uint8_t id, uint64_t now) {
+  const BotPersonality* p = botMode.personality;
+  switch (id) {
+    case EV_STATE_TIMEOUT:
+      onBotStateTimeout(now);
+      break;
+
+    case EV_REACT_END:
+      // Reaction over — return to neutral
+      botMode.shakeReacting = false;
+      if (botMode.state == BOT_ACTIVE) {
+        botMode.face.transitionTo(EXPR_NEUTRAL, 400);
+      }
+      break;
+
+    case EV_IDLE_EXPR:
+      if (botMode.state != BOT_ACTIVE || botMode.shakeReacting) {
+        botScheduler.schedule(EV_IDLE_EXPR, BOT_EVENT_RETRY_MS);
+        break;
+      }
       {
-        float mag = sqrtf(accelX * accelX + accelY * accelY + accelZ * accelZ);
-        if (mag > BOT_WAKE_THRESHOLD) {
-          botMode.wake();
+        uint16_t pick;
+        if (random(100) < 35) {
+          // 35% chance: pick from full expression range (incl. pack) for variety
+          pick = random(0, botExpressionCount());
+        } else {
+          // 65% chance: pick from personality favorites
+          pick = p->favoriteExprs[random(0, 5)];
         }
+        botMode.face.transitionTo(pick, 500);
+      }
+      botScheduler.schedule(EV_IDLE_EXPR, random(p->exprMinMs, p->exprMaxMs));
+      break;
+
+    case EV_IDLE_SAYING:
+      if ((botMode.state != BOT_ACTIVE && botMode.state != BOT_IDLE) ||
+          botMode.speechBubble.active) {
+        botScheduler.schedule(EV_IDLE_SAYING, BOT_EVENT_RETRY_MS);
+        break;
+      }
+      {
+        char buf[32];
+        getRandomSayingText(SAY_IDLE, buf, sizeof(buf));
+        botMode.speechBubble.show(buf, 3500);
+      }
+      botScheduler.schedule(EV_IDLE_SAYING, random(p->sayMinMs, p->sayMaxMs));
+      break;
+
+    case EV_BLINK:
+      // Next one is scheduled when this blink finishes
+      if (botMode.state != BOT_SLEEPING && botMode.face.eyeMode == EYE_NORMAL) {
+        botMode.blink.start(now);
+      } else {
+        botScheduler.schedule(EV_BLINK, BOT_EVENT_RETRY_MS);
+      }
+      break;
+
+    case EV_LOOK:
+      if ((botMode.state == BOT_ACTIVE || botMode.state == BOT_IDLE) &&
+          !botMode.shakeReacting) {
+        botMode.lookAround.start(now);
+      } else {
+        botScheduler.schedule(EV_LOOK, BOT_EVENT_RETRY_MS);
       }
       break;
   }
+}
 
-  // ---- Shake reaction timeout (return to neutral) ----
-  if (botMode.shakeReacting && now >= botMode.shakeReactEnd) {
-    botMode.shakeReacting = false;
-    if (botMode.state == BOT_ACTIVE) {
-      botMode.face.transitionTo(EXPR_NEUTRAL, 400);
-    }
+void updateBotMode() {
+  if (!botMode.initialized) {
+    botMode.init();
   }
 
-  // ---- Random idle expression changes (personality-driven) ----
-  if (botMode.state == BOT_ACTIVE && !botMode.shakeReacting && now >= botMode.nextRandomExpr) {
-    uint8_t pick;
-    if (random(100) < 35) {
-      // 35% chance: pick from full expression range for variety
-      pick = random(0, BOT_NUM_EXPRESSIONS);
-    } else {
-      // 65% chance: pick from personality favorites
-      pick = p->favoriteExprs[random(0, 5)];
-    }
-    botMode.face.transitionTo(pick, 500);
-    botMode.nextRandomExpr = now + random(p->exprMinMs, p->exprMaxMs);
+  uint64_t now = botNowMs();
+
+  // Skip if menu is visible
+  if (menuVisible) return;
+
+  // ---- Behavior events that are due (nothing else is polled) ----
+  int16_t ev;
+  while ((ev = botScheduler.popDue(now)) >= 0) {
+    handleBotEvent(ev, now);
   }
 
-  // ---- Random idle sayings (personality-driven) ----
-  if ((botMode.state == BOT_ACTIVE || botMode.state == BOT_IDLE) &&
-      !botMode.speechBubble.active && now >= botMode.nextIdleSaying) {
-    char buf[32];
-    getRandomSayingText(SAY_IDLE, buf, sizeof(buf));
-    botMode.speechBubble.show(buf, 3500);
-    botMode.nextIdleSaying = now + random(p->sayMinMs, p->sayMaxMs);
+  // ---- Sleeping: wake-up via motion ----
+  if (botMode.state == BOT_SLEEPING) {
+    if (accelPeak > BOT_WAKE_THRESHOLD) {
+      botMode.wake();
+    }
   }
 
   // ---- Update animation systems ----
@@ -337,7 +459,11 @@ void updateBotMode() {
   // Blink (not while sleeping or during special eye modes)
   if (botMode.state != BOT_SLEEPING &&
       botMode.face.eyeMode == EYE_NORMAL) {
-    botMode.face.blinkAmount = botMode.blink.update();
+    bool wasBlinking = botMode.blink.blinking;
+    botMode.face.blinkAmount = botMode.blink.update(now);
+    if (wasBlinking && !botMode.blink.blinking) {
+      botScheduler.schedule(EV_BLINK, botMode.blink.nextInterval());
+    }
   } else if (botMode.state == BOT_SLEEPING) {
     botMode.face.blinkAmount = 0.0f;  // Don't squish — EYE_CLOSED handles it
     botMode.face.eyeMode = EYE_CLOSED;
@@ -347,12 +473,23 @@ void updateBotMode() {
   int16_t lookX = 0, lookY = 0;
   if ((botMode.state == BOT_ACTIVE || botMode.state == BOT_IDLE) &&
       !botMode.shakeReacting) {
-    botMode.lookAround.update(lookX, lookY);
+    bool wasMoving = botMode.lookAround.moving;
+    botMode.lookAround.update(now, lookX, lookY);
+    if (wasMoving && !botMode.lookAround.moving) {
+      botScheduler.schedule(EV_LOOK, botMode.lookAround.nextInterval());
+    }
+  }
+
+  // IMU tilt tracking (shared orientation estimate, sampled at frame time)
+  int16_t tiltX = 0, tiltY = 0;
+  if (botMode.state != BOT_SLEEPING && imuOrient.primed) {
+    botMode.imuTracker.update(imuOrient.upX(), imuOrient.upY(), tiltX, tiltY);
   }
 
-  // Dynamic pupil offsets — random look-around only (IMU tracking disabled for now)
-  botMode.face.dynamicPupilX = lookX;
-  botMode.face.dynamicPupilY = lookY;
+  // Dynamic pupil offsets — look-around plus tilt
+  const int16_t maxOffset = (int16_t)BotIMUTracker::MAX_OFFSET;
+  botMode.face.dynamicPupilX = constrain(lookX + tiltX, -maxOffset, maxOffset);
+  botMode.face.dynamicPupilY = constrain(lookY + tiltY, -maxOffset, maxOffset);
 
   // Update expression transition
   botMode.face.update();
@@ -361,121 +498,76 @@ void updateBotMode() {
   botMode.speechBubble.update();
   botMode.notification.update();
   botMode.weatherOverlay.update();
+
+  // Mouth flaps while the bubble types out
+  botMode.face.talkOpen = (botMode.state == BOT_SLEEPING) ? 0 : botMode.speechBubble.talkOpen();
 }
 
 // ============================================================================
 // Bot Mode Render (called each frame after update)
 // ============================================================================
 
-// Background style (declared before renderBotMode which uses it)
-uint8_t botBackgroundStyle = 0;  // 0=solid black, 1=subtle gradient, 2=breathing, 3=starfield, 4=ambient
-
-// External references for ambient background
-extern CRGBPalette16 currentPalette;
-extern CRGBPalette16 palettes[];
-extern uint8_t paletteIndex;
-extern uint8_t effectIndex;
-extern CRGB leds[];
-
-// Use the function pointer tables from effects_ambient.h
-extern const AmbientFunc ambientHiResFuncs[];
-extern const AmbientFunc ambientLedFuncs[];
-
-// Render ambient effect as bot background (respects hiResMode)
-void renderBotAmbientBackground() {
-  uint8_t idx = effectIndex % NUM_AMBIENT_EFFECTS;
-
-  #if defined(HIRES_ENABLED)
-  if (hiResMode) {
-    // Hi-res: render effect directly to LCD canvas
-    ambientHiResFuncs[idx]();
-  } else {
-    // Pixel mode: run LED effect, then render leds[] as blocky background
-    ambientLedFuncs[idx]();
-    for (uint8_t y = 0; y < MATRIX_HEIGHT; y++) {
-      for (uint8_t x = 0; x < MATRIX_WIDTH; x++) {
-        uint16_t ledIndex = XY(x, y);
-        CRGB color = leds[ledIndex];
-        uint16_t c565 = crgbToRgb565(color);
-        int16_t screenX = GRID_OFFSET_X + x * (PIXEL_SIZE + PIXEL_GAP);
-        int16_t screenY = GRID_OFFSET_Y + y * (PIXEL_SIZE + PIXEL_GAP);
-        gfx->fillRect(screenX, screenY, PIXEL_SIZE, PIXEL_SIZE, c565);
-      }
-    }
-  }
-  #else
-  ambientHiResFuncs[idx]();
-  #endif
-}
-
 // ============================================================================
-// Offscreen Canvas — eliminates ALL flicker
+// Frame composition — eliminates ALL flicker
 // ============================================================================
 // Instead of drawing directly to the screen (which flickers when elements are
-// erased then redrawn), we draw each frame to an offscreen RAM buffer first,
-// then flush the whole buffer to the display in one atomic SPI transfer.
-// This is the standard double-buffer / sprite technique for TFT displays.
-
-static Arduino_Canvas *botCanvas = nullptr;
+// erased then redrawn), each frame is recorded into botDL and every pixel is
+// written to the panel exactly once:
+//  - BOT_BAND_RENDER: the list is rasterized into 20-row bands (~28KB RAM),
+//    and only bands whose ops changed since the last push are sent.
+//  - Otherwise: the list is rasterized into a full-screen Arduino_Canvas
+//    (134KB each). Needed for hi-res ambient.
+// Both paths double-buffer: botPresenter flushes one buffer on the other core
+// while the next one is rendered (see bot_present.h).
+
+#if !defined(BOT_BAND_RENDER)
+static Arduino_Canvas *botCanvas[2] = { nullptr, nullptr };
+#endif
 static Arduino_GFX *gfxReal = nullptr;   // The actual hardware display
-static bool botFirstFrame = true;
+static bool botFirstFrame = true;        // Panel was cleared/overdrawn — flush next frame
+static bool botFrameRequested = false;   // Render on the next pass regardless of rate
+static uint32_t botLastFrameHash = 0;    // Hash of the frame on the panel
+static uint64_t botLastRender = 0;       // botNowMs of the last rendered frame
+
+// Hash of the recorded frame, including things the list only references
+uint32_t botFrameHash() {
+  uint32_t h = botSprites.frameStamp(botDL.hash());
+  h = (h ^ botBackground.pixelVersion) * 16777619UL;
+  return h;
+}
 
 void renderBotMode() {
   if (gfx == nullptr) return;
   if (menuVisible) return;
 
-  // ---- Initialize canvas on first use ----
-  if (botCanvas == nullptr) {
+  #if !defined(BOT_BAND_RENDER)
+  // ---- Initialize canvases on first use (framebuffers go to PSRAM if present) ----
+  if (botCanvas[0] == nullptr) {
     gfxReal = gfx;  // Save the real display pointer
-    botCanvas = new Arduino_Canvas(LCD_WIDTH, LCD_HEIGHT, gfxReal);
-    botCanvas->begin();
+    for (uint8_t i = 0; i < 2; i++) {
+      botCanvas[i] = new Arduino_Canvas(LCD_WIDTH, LCD_HEIGHT, gfxReal);
+      botCanvas[i]->begin();
+    }
+    botPresenter.begin(gfxReal, botCanvas[0]->getFramebuffer(), botCanvas[1]->getFramebuffer());
   }
 
-  // Swap gfx to canvas — all drawing calls now go to offscreen buffer
-  gfx = botCanvas;
+  // Wait for the back canvas to finish flushing, then swap gfx to it —
+  // hi-res ambient effects draw to the offscreen buffer
+  botPresenter.acquire();
+  Arduino_Canvas *canvas = botCanvas[botPresenter.back];
+  gfx = canvas;
+  #endif
 
-  // ---- Clear canvas with background ----
-  uint16_t bgColor = BOT_COLOR_BG;
+  uint32_t recordStart = micros();
+  botDL.clear();
+  botSprites.beginFrame();
 
-  if (botBackgroundStyle == 0) {
-    // Solid black
-    gfx->fillScreen(BOT_COLOR_BG);
-  } else if (botBackgroundStyle == 1) {
-    // Subtle gradient
-    for (int16_t y = 0; y < LCD_HEIGHT; y += 4) {
-      uint8_t b = (uint8_t)((1.0f - (float)y / LCD_HEIGHT) * 12);
-      uint16_t c = ((b >> 3) << 11) | ((b >> 2) << 5) | (b >> 1);
-      gfx->fillRect(0, y, LCD_WIDTH, 4, c);
-    }
-  } else if (botBackgroundStyle == 2) {
-    // Breathing
-    float breathT = (float)(millis() % 6000) / 6000.0f;
-    uint8_t intensity = (uint8_t)(sinf(breathT * TWO_PI) * 4.0f + 4.0f);
-    bgColor = ((intensity >> 3) << 11) | ((intensity >> 2) << 5) | (intensity >> 1);
-    gfx->fillScreen(bgColor);
-  } else if (botBackgroundStyle == 3) {
-    // Starfield on black
-    gfx->fillScreen(BOT_COLOR_BG);
-    for (int i = 0; i < 8; i++) {
-      int16_t sx = (i * 31 + 17) % LCD_WIDTH;
-      int16_t sy = (i * 47 + 11) % LCD_HEIGHT;
-      float twinkle = sinf((float)(millis() + i * 500) / 1500.0f);
-      if (twinkle > 0.3f) {
-        uint8_t bright = (uint8_t)(twinkle * 8);
-        uint16_t starColor = ((bright >> 3) << 11) | ((bright >> 2) << 5) | (bright >> 3);
-        gfx->fillRect(sx, sy, 2, 2, starColor);
-      }
-    }
-  } else if (botBackgroundStyle == 4) {
-    // Ambient effect as background — face renders on top
-    #if defined(HIRES_ENABLED)
-    if (!hiResMode) {
-      gfx->fillScreen(BOT_COLOR_BG);  // Clear first for pixel mode (grid doesn't cover full screen)
-    }
-    #endif
-    renderBotAmbientBackground();
-    bgColor = 0x0000;  // Face erase uses black (though prevFrame is invalidated)
-  }
+  // ---- Background layer (replayed unless due at its own rate) ----
+  #if defined(BOT_BAND_RENDER)
+  uint16_t bgColor = botBackground.render(nullptr);
+  #else
+  uint16_t bgColor = botBackground.render(canvas);
+  #endif
 
   // Since we redraw everything fresh each frame, skip the old targeted-erase logic
   prevFrame.invalidate();
@@ -491,7 +583,7 @@ void renderBotMode() {
     int16_t zBaseX = BOT_FACE_CX + 50;
     int16_t zBaseY = BOT_FACE_CY - 40;
 
-    gfx->setTextColor(botFaceColor);
+    botDL.setTextColor(botFaceColor);
 
     for (int i = 0; i < 3; i++) {
       float phase = fmodf(t + i * 0.33f, 1.0f);
@@ -499,9 +591,9 @@ void renderBotMode() {
       int16_t zy = zBaseY - (int16_t)(phase * 50);
 
       if (phase < 0.8f) {
-        gfx->setCursor(zx, zy);
-        gfx->setTextSize(1 + i);
-        gfx->print("Z");
+        botDL.setCursor(zx, zy);
+        botDL.setTextSize(1 + i);
+        botDL.print("Z");
       }
     }
   }
@@ -518,11 +610,49 @@ void renderBotMode() {
   botMode.timeOverlay.render();
   botMode.weatherOverlay.render();
 
-  // ---- Flush canvas to screen in one atomic transfer — zero flicker ----
-  botCanvas->flush();
+  botPresenter.stats.recordUs += micros() - recordStart;
+
+  // ---- Identical to what's on the panel: skip raster and flush ----
+  uint32_t frameHash = botFrameHash();
+  if (!botFirstFrame && frameHash == botLastFrameHash) {
+    #if !defined(BOT_BAND_RENDER)
+    botPresenter.release();
+    gfx = gfxReal;
+    #endif
+    botPresenter.stats.skipped++;
+    if (botPresenter.stats.report()) {
+      botSprites.report();
+      botBackground.report();
+      i2cBus.report();
+    }
+    return;
+  }
+  botLastFrameHash = frameHash;
+
+  // ---- Write every changed pixel once — zero flicker ----
+  #if defined(BOT_BAND_RENDER)
+  botPresentBands(gfx, botFirstFrame);
+  #else
+  uint32_t rasterStart = micros();
+  botDL.rasterize(canvas->getFramebuffer(), 0, LCD_HEIGHT);
+  botPresenter.stats.rasterUs += micros() - rasterStart;
+  for (int16_t y = 0; y < LCD_HEIGHT; y += BOT_BAND_ROWS) {
+    int16_t rows = min((int16_t)BOT_BAND_ROWS, (int16_t)(LCD_HEIGHT - y));
+    botHashBand(canvas->getFramebuffer() + (uint32_t)y * LCD_WIDTH, y, rows);
+  }
+  botPresenter.submit(0, LCD_HEIGHT);
 
   // Restore real display pointer
   gfx = gfxReal;
+  #endif
+  botFirstFrame = false;
+
+  botPresenter.stats.frames++;
+  if (botPresenter.stats.report()) {
+    botSprites.report();
+    botBackground.report();
+    i2cBus.report();
+  }
 }
 
 // ============================================================================
@@ -532,6 +662,7 @@ void renderBotMode() {
 void enterBotMode() {
   botFirstFrame = true;
   prevFrame.invalidate();
+  botBackground.invalidate();
 
   if (!botMode.initialized) {
     botMode.init();
@@ -542,11 +673,10 @@ void enterBotMode() {
     botMode.speechBubble.show(buf, 2500);
   } else {
     // Re-entering bot mode: reset to active
-    botMode.state = BOT_ACTIVE;
-    botMode.lastInteraction = millis();
+    botMode.lastInteraction = botNowMs();
+    botMode.enterState(BOT_ACTIVE);
     botMode.face.transitionTo(EXPR_HAPPY, 300);
-    botMode.shakeReacting = true;
-    botMode.shakeReactEnd = millis() + 1500;
+    botMode.react(1500);
 
     char buf[32];
     getRandomSayingText(SAY_GREETING, buf, sizeof(buf));
@@ -554,6 +684,7 @@ void enterBotMode() {
   }
 
   // Clear the actual screen (use real display, not canvas)
+  botFlushWait();
   Arduino_GFX *screen = (gfxReal != nullptr) ? gfxReal : gfx;
   if (screen != nullptr) {
     screen->fillScreen(BOT_COLOR_BG);
@@ -561,7 +692,8 @@ void enterBotMode() {
 }
 
 void exitBotMode() {
-  // Restore gfx to real display when leaving bot mode
+  // Let the last frame land, then restore gfx to real display
+  botFlushWait();
   if (gfxReal != nullptr) {
     gfx = gfxReal;
   }
@@ -574,16 +706,73 @@ void exitBotMode() {
 // Combined Bot Mode loop function (update + render)
 // ============================================================================
 
+// Render interval by activity state. Short animations (transitions,
+// blinks, looks, tilt tracking, overlays) always get the full rate so they
+// stay smooth.
+uint32_t botFrameIntervalMs() {
+  const BotFaceState &f = botMode.face;
+  if (f.transitioning || f.playingTimeline() || botMode.blink.blinking ||
+      botMode.lookAround.moving || botMode.imuTracker.moving ||
+      botMode.speechBubble.active ||
+      botMode.notification.active) {
+    return BOT_FRAME_DELAY_MS;
+  }
+  switch (botMode.state) {
+    case BOT_IDLE:
+    case BOT_SLEEPY:    return 1000 / BOT_FPS_IDLE;
+    case BOT_SLEEPING:  return 1000 / BOT_FPS_SLEEPING;
+    default:            return BOT_FRAME_DELAY_MS;
+  }
+}
+
+// Force the next frame to be flushed (panel was drawn over, e.g. menu)
+void botInvalidateFrame() {
+  botFirstFrame = true;
+}
+
+// Render on the next pass instead of waiting for the frame interval, so a
+// reaction to input shows up immediately
+void botRequestFrame() {
+  botFrameRequested = true;
+}
+
+// A frame was requested and should be drawn without waiting out the rate
+bool botFramePending() {
+  return botFrameRequested;
+}
+
+// Behavior runs every loop pass (it's event-driven and cheap); frames are
+// rendered at the state's rate. An interaction switches the state back to
+// ACTIVE, so the same pass renders at full rate again.
 void runBotMode() {
+  uint32_t t0 = micros();
   updateBotMode();
+  botPresenter.stats.updateUs += micros() - t0;
+
+  uint64_t now = botNowMs();
+  if (!botFirstFrame && !botFrameRequested && now - botLastRender < botFrameIntervalMs()) return;
+  botFrameRequested = false;
+  botLastRender = now;
   renderBotMode();
 }
 
+// Loop delay: until the next frame or behavior event, but never longer
+// than one input poll
+uint32_t botFrameDelayMs() {
+  if (!botMode.initialized || menuVisible) return BOT_FRAME_DELAY_MS;
+  uint64_t now = botNowMs();
+  uint32_t interval = botFrameIntervalMs();
+  uint64_t sinceRender = now - botLastRender;
+  uint32_t untilFrame = sinceRender >= interval ? 0 : (uint32_t)(interval - sinceRender);
+  uint32_t wait = min(untilFrame, botScheduler.msUntilNext(now, BOT_INPUT_POLL_MS));
+  return max(wait, (uint32_t)1);  // Always yield to the idle task
+}
+
 // ============================================================================
 // Bot Mode accessors for web/touch control
 // ============================================================================
 
-uint8_t getBotExpression() {
+uint16_t getBotExpression() {
   return botMode.face.targetExpr;
 }
 
@@ -591,7 +780,7 @@ uint8_t getBotState() {
   return (uint8_t)botMode.state;
 }
 
-void setBotExpression(uint8_t index) {
+void setBotExpression(uint16_t index) {
   botMode.setExpression(index);
 }
 
@@ -647,9 +836,13 @@ void setBotWeatherLocation(float lat, float lon) {
 
 // Stubs when LCD is not available
 inline void runBotMode() {}
+inline uint32_t botFrameDelayMs() { return 33; }
+inline void botInvalidateFrame() {}
+inline void botRequestFrame() {}
+inline bool botFramePending() { return false; }
 inline void enterBotMode() {}
 inline void exitBotMode() {}
-inline void setBotExpression(uint8_t index) {}
+inline void setBotExpression(uint16_t index) {}
 inline void setBotFaceColor(uint16_t color) {}
 inline void showBotSaying(const char* text, uint16_t durationMs) {}
 inline void toggleBotTimeOverlay() {}
@@ -4,19 +4,20 @@
 #include <Arduino.h>
 #include <Arduino_GFX_Library.h>
 #include "config.h"
+#include "bot_display_list.h"
+#include "bot_sprites.h"
 
 // ============================================================================
 // Bot Overlays — Speech Bubbles, Notifications, Time Display
 // ============================================================================
 // Overlay elements drawn on top of the bot face.
-// Speech bubbles pop in, linger, then fade out.
+// Speech bubbles pop in, type their text out, linger, then fade out.
 // Notification banners slide in from top.
+// Overlays record into botDL on top of the face, like the face itself.
 // ============================================================================
 
 #if defined(DISPLAY_LCD_ONLY) || defined(DISPLAY_DUAL)
 
-extern Arduino_GFX *gfx;
-
 // Colors
 #define OVERLAY_BG      0xFFFF  // White bubble background
 #define OVERLAY_TEXT    0x0000  // Black text
@@ -24,56 +25,127 @@ extern Arduino_GFX *gfx;
 #define NOTIFY_BG       0x001F  // Blue notification background
 #define NOTIFY_TEXT     0xFFFF  // White notification text
 
+// ============================================================================
+// Cached overlay layers
+// ============================================================================
+// An overlay's look only changes when its content or animation step does.
+// Each overlay derives a version stamp from that state; the layer is
+// recorded and rasterized into botSprites once per version and composited
+// from the cache otherwise (one DL_SPRITE op). Layers go through the display
+// list, so they work with both band and canvas presentation.
+//
+// Layers are anchored at their top-left and built at their own x (layers
+// never slide sideways) but at least BOT_LAYER_BUILD_Y down, so a banner
+// sliding in from above the screen can't clip what gets cached.
+
+#define SPR_LAYER          0x0F   // Sprite kind reserved for overlay layers
+#define BOT_LAYER_BUILD_Y  8      // Room for the bubble's pointer above it
+
+enum BotLayerId : uint8_t {
+  LAYER_BUBBLE = 0,
+  LAYER_NOTIFY,
+  LAYER_TIME
+};
+
+// Composite layer `id` at (x, y) for a 24-bit content version
+inline void botDrawLayer(uint8_t id, uint32_t version, int16_t x, int16_t y,
+                         const uint16_t *inks, BotSpriteBuilder builder, void *ctx) {
+  uint32_t key = botSpriteKey(SPR_LAYER, id, version >> 16, version >> 8, version);
+  botSprites.draw(key, x, y, inks, builder, ctx, x, max(y, (int16_t)BOT_LAYER_BUILD_Y));
+}
+
 // ============================================================================
 // Speech Bubble
 // ============================================================================
+// The bubble body is a cached layer; the text is recorded as its own text op
+// on top. With the typewriter reveal the op grows by one glyph per step, so
+// revealing a character costs one more glyph in the frame instead of a
+// layer rebuild (and the body's cache entry stays put for the whole show).
+// In band builds a step where only the text grew changes just the bands the
+// text row covers, and only those are rasterized and pushed.
 
 struct BotSpeechBubble {
   char text[32];               // Current text content
   bool active;                 // Whether bubble is showing
   unsigned long showTime;      // When the bubble appeared
-  uint16_t duration;           // How long to show (ms)
+  uint16_t duration;           // How long to show (ms), including the reveal
   uint8_t animPhase;           // 0=pop-in, 1=visible, 2=fade-out
 
+  // Typewriter reveal
+  uint8_t length;              // strlen(text)
+  uint8_t revealed;            // Characters drawn so far
+  bool typewriter;             // false = whole text at once
+
   // Animation timing
   static const uint16_t POP_IN_MS = 150;
   static const uint16_t FADE_OUT_MS = 200;
   static const uint16_t DEFAULT_DURATION = 3500;  // 3.5 seconds visible
+  static const uint16_t TYPE_CHAR_MS = 45;        // Reveal time per character
 
   // Bubble position and size
   int16_t bubbleX, bubbleY, bubbleW, bubbleH;
+  uint8_t textSize;            // 2, or 1 when the text won't fit at size 2
+  int16_t textW;               // Full text width, so the reveal doesn't shift
+
+  // Layer state: a new show() or scale step means a new cached layer
+  uint16_t showCount;
+  int16_t layerW, layerH;
 
   void init() {
     active = false;
     text[0] = '\0';
+    length = revealed = 0;
     animPhase = 0;
   }
 
-  // Show a text bubble
-  void show(const char* msg, uint16_t durationMs = DEFAULT_DURATION) {
+  // Show a text bubble. The typewriter reveal runs after the pop-in and
+  // is added on top of durationMs, so the full text lingers as long as before.
+  void show(const char* msg, uint16_t durationMs = DEFAULT_DURATION, bool typed = true) {
     strncpy(text, msg, 31);
     text[31] = '\0';
+    length = strlen(text);
+    typewriter = typed;
+    revealed = typed ? 0 : length;
     active = true;
     showTime = millis();
-    duration = durationMs;
+    duration = durationMs + (typed ? length * TYPE_CHAR_MS : 0);
     animPhase = 0;
-
-    // Calculate bubble dimensions based on text
-    uint8_t textLen = strlen(text);
-    // Text size 2 = 12x16 per char
-    bubbleW = textLen * 12 + 20;  // 10px padding each side
-    if (bubbleW > 234) bubbleW = 234;  // Max width (near full screen)
+    showCount++;
+
+    // Calculate bubble dimensions from the measured text width
+    // (10px padding each side, 234px max). Long text drops to size 1.
+    textSize = 2;
+    textW = botTextWidth(text, textSize);
+    if (textW + 20 > 234) {
+      textSize = 1;
+      textW = botTextWidth(text, textSize);
+    }
+    bubbleW = min(textW + 20, 234);
     bubbleH = 36;  // 16px text + 20px padding
     bubbleX = (LCD_WIDTH - bubbleW) / 2;  // Centered
     bubbleY = 220;  // Below the face
   }
 
   // Show from PROGMEM string
-  void showP(const char* progmemStr, uint16_t durationMs = DEFAULT_DURATION) {
+  void showP(const char* progmemStr, uint16_t durationMs = DEFAULT_DURATION, bool typed = true) {
     char buf[32];
     strncpy_P(buf, progmemStr, 31);
     buf[31] = '\0';
-    show(buf, durationMs);
+    show(buf, durationMs, typed);
+  }
+
+  // Text is still being revealed
+  bool typing() const {
+    return active && animPhase == 1 && revealed < length;
+  }
+
+  // Mouth opening (px) for the character just revealed: wide on vowels,
+  // half on other letters, closed on spaces and punctuation
+  uint8_t talkOpen() const {
+    if (!typing() || revealed == 0) return 0;
+    char c = tolower(text[revealed - 1]);
+    if (strchr("aeiouy", c) != nullptr) return 7;
+    return isalnum(c) ? 4 : 0;
   }
 
   // Update animation state
@@ -84,10 +156,15 @@ struct BotSpeechBubble {
 
     if (elapsed < POP_IN_MS) {
       animPhase = 0;  // Pop-in
-    } else if (elapsed < POP_IN_MS + duration) {
+    } else if (elapsed < (unsigned long)POP_IN_MS + duration) {
       animPhase = 1;  // Visible
-    } else if (elapsed < POP_IN_MS + duration + FADE_OUT_MS) {
+      if (typewriter && revealed < length) {
+        uint16_t n = (elapsed - POP_IN_MS) / TYPE_CHAR_MS + 1;
+        revealed = min(n, (uint16_t)length);
+      }
+    } else if (elapsed < (unsigned long)POP_IN_MS + duration + FADE_OUT_MS) {
       animPhase = 2;  // Fade-out
+      revealed = length;
     } else {
       active = false;  // Done
     }
@@ -95,7 +172,7 @@ struct BotSpeechBubble {
 
   // Render the bubble
   void render() {
-    if (!active || gfx == nullptr) return;
+    if (!active) return;
 
     float scale = 1.0f;
 
@@ -114,6 +191,10 @@ struct BotSpeechBubble {
       if (scale < 0.0f) scale = 0.0f;
     }
 
+    // Quantize scale to 1/64 steps — each step is one cached layer version
+    uint8_t step = (uint8_t)(scale * 64.0f);
+    scale = step / 64.0f;
+
     // Calculate scaled dimensions
     int16_t sw = (int16_t)(bubbleW * scale);
     int16_t sh = (int16_t)(bubbleH * scale);
@@ -122,29 +203,36 @@ struct BotSpeechBubble {
 
     if (sw < 4 || sh < 4) return;
 
+    layerW = sw;
+    layerH = sh;
+
+    static const uint16_t inks[3] = { OVERLAY_BG, OVERLAY_BORDER, OVERLAY_TEXT };
+    uint32_t version = ((uint32_t)(showCount & 0x3FFF) << 8) | step;
+    botDrawLayer(LAYER_BUBBLE, version, sx, sy, inks, buildLayer, this);
+
+    // Revealed text over the body — only when fully visible or popping
+    // in past 50%. Left edge is where the full text will sit.
+    if (scale > 0.5f && revealed > 0) {
+      botDL.setTextSize(textSize);
+      botDL.setTextColor(OVERLAY_TEXT);
+      botDL.setCursor(sx + (sw - textW) / 2, sy + (sh - BOT_FONT_CELL_H * textSize) / 2);
+      botDL.print(text, revealed);
+    }
+  }
+
+  // Record the bubble body with its top-left at (x, y)
+  static void buildLayer(uint32_t, int16_t x, int16_t y, const uint16_t *inks, void *ctx) {
+    BotSpeechBubble *b = (BotSpeechBubble *)ctx;
+    int16_t sw = b->layerW, sh = b->layerH;
+
     // Draw bubble background (rounded rect)
-    gfx->fillRoundRect(sx, sy, sw, sh, 6, OVERLAY_BG);
-    gfx->drawRoundRect(sx, sy, sw, sh, 6, OVERLAY_BORDER);
+    botDL.fillRoundRect(x, y, sw, sh, 6, inks[0]);
+    botDL.drawRoundRect(x, y, sw, sh, 6, inks[1]);
 
     // Draw small triangle pointer (pointing up toward face)
-    int16_t triCX = sx + sw / 2;
-    int16_t triTop = sy - 5;
-    gfx->fillTriangle(triCX - 5, sy, triCX + 5, sy, triCX, triTop, OVERLAY_BG);
-
-    // Draw text (only when fully visible or popping in past 50%)
-    if (scale > 0.5f) {
-      gfx->setTextSize(2);
-      gfx->setTextColor(OVERLAY_TEXT);
-
-      // Center text in bubble (text size 2 = 12x16 per char)
-      uint8_t textLen = strlen(text);
-      int16_t textW = textLen * 12;
-      int16_t textX = sx + (sw - textW) / 2;
-      int16_t textY = sy + (sh - 16) / 2;
-
-      gfx->setCursor(textX, textY);
-      gfx->print(text);
-    }
+    int16_t triCX = x + sw / 2;
+    int16_t triTop = y - 5;
+    botDL.fillTriangle(triCX - 5, y, triCX + 5, y, triCX, triTop, inks[0]);
   }
 };
 
@@ -158,8 +246,10 @@ struct BotNotification {
   unsigned long showTime;
   uint16_t duration;
   uint8_t animPhase;           // 0=slide-in, 1=visible, 2=slide-out
+  uint16_t showCount;          // Layer version — sliding only moves the layer
 
   static const uint16_t SLIDE_MS = 200;
+  static const int16_t BANNER_H = 24;
   static const uint16_t DEFAULT_DURATION = 2500;
 
   void init() {
@@ -174,6 +264,7 @@ struct BotNotification {
     showTime = millis();
     duration = durationMs;
     animPhase = 0;
+    showCount++;
   }
 
   void update() {
@@ -182,9 +273,9 @@ struct BotNotification {
     unsigned long elapsed = millis() - showTime;
     if (elapsed < SLIDE_MS) {
       animPhase = 0;
-    } else if (elapsed < SLIDE_MS + duration) {
+    } else if (elapsed < (unsigned long)SLIDE_MS + duration) {
       animPhase = 1;
-    } else if (elapsed < SLIDE_MS + duration + SLIDE_MS) {
+    } else if (elapsed < (unsigned long)SLIDE_MS + duration + SLIDE_MS) {
       animPhase = 2;
     } else {
       active = false;
@@ -192,10 +283,10 @@ struct BotNotification {
   }
 
   void render() {
-    if (!active || gfx == nullptr) return;
+    if (!active) return;
 
     // Banner: full width, at top of screen
-    int16_t bannerH = 24;
+    int16_t bannerH = BANNER_H;
     int16_t bannerY = 0;
 
     if (animPhase == 0) {
@@ -210,19 +301,26 @@ struct BotNotification {
       bannerY = (int16_t)(-bannerH * t);
     }
 
+    static const uint16_t inks[3] = { NOTIFY_BG, NOTIFY_TEXT, 0 };
+    botDrawLayer(LAYER_NOTIFY, showCount, 0, bannerY, inks, buildLayer, this);
+  }
+
+  // Record the banner with its top-left at (x, y)
+  static void buildLayer(uint32_t, int16_t x, int16_t y, const uint16_t *inks, void *ctx) {
+    BotNotification *n = (BotNotification *)ctx;
+
     // Draw banner
-    gfx->fillRect(0, bannerY, LCD_WIDTH, bannerH, NOTIFY_BG);
+    botDL.fillRect(x, y, LCD_WIDTH, BANNER_H, inks[0]);
 
     // Draw text centered
-    uint8_t textLen = strlen(text);
-    int16_t textW = textLen * 6;
-    int16_t textX = (LCD_WIDTH - textW) / 2;
-    int16_t textY = bannerY + (bannerH - 8) / 2;
-
-    gfx->setTextSize(1);
-    gfx->setTextColor(NOTIFY_TEXT);
-    gfx->setCursor(textX, textY);
-    gfx->print(text);
+    int16_t textW = botTextWidth(n->text, 1);
+    int16_t textX = x + (LCD_WIDTH - textW) / 2;
+    int16_t textY = y + (BANNER_H - 8) / 2;
+
+    botDL.setTextSize(1);
+    botDL.setTextColor(inks[1]);
+    botDL.setCursor(textX, textY);
+    botDL.print(n->text);
   }
 };
 
@@ -234,17 +332,20 @@ struct BotTimeOverlay {
   bool enabled;
   bool ntpSynced;
   unsigned long uptimeStart;
+  unsigned long lastPoll;      // Clock is read at most once a second
+  uint8_t hours, minutes;
+
+  static const uint16_t POLL_MS = 1000;
 
   void init() {
     enabled = false;
     ntpSynced = false;
     uptimeStart = millis();
+    lastPoll = 0;
+    hours = minutes = 0;
   }
 
-  void render() {
-    if (!enabled || gfx == nullptr) return;
-
-    uint8_t hours, minutes;
+  void poll() {
     struct tm timeinfo;
     if (getLocalTime(&timeinfo, 0)) {
       hours = timeinfo.tm_hour;
@@ -256,17 +357,35 @@ struct BotTimeOverlay {
       hours = (uptimeSec / 3600) % 24;
       minutes = (uptimeSec / 60) % 60;
     }
+  }
+
+  void render() {
+    if (!enabled) return;
+
+    unsigned long now = millis();
+    if (lastPoll == 0 || now - lastPoll >= POLL_MS) {
+      poll();
+      lastPoll = now;
+    }
+
+    // Text changes once a minute — the layer is rebuilt only then
+    static const uint16_t inks[3] = { 0x2104, 0x07FF, 0 };  // Dark gray bg, cyan text
+    botDrawLayer(LAYER_TIME, hours * 60 + minutes, LCD_WIDTH - 104, 2, inks, buildLayer, this);
+  }
 
+  // Record the clock with its top-left at (x, y)
+  static void buildLayer(uint32_t, int16_t x, int16_t y, const uint16_t *inks, void *ctx) {
+    BotTimeOverlay *t = (BotTimeOverlay *)ctx;
     char buf[8];
-    snprintf(buf, sizeof(buf), "%02d:%02d", hours, minutes);
+    snprintf(buf, sizeof(buf), "%02d:%02d", t->hours, t->minutes);
 
-    // Large time display — text size 3 = 18x24 per char, "00:00" = 90px wide
-    gfx->fillRoundRect(LCD_WIDTH - 104, 2, 102, 32, 6, 0x2104);  // Dark gray bg
+    // Large time display — text size 3 = 18x24 per char, centered in the box
+    botDL.fillRoundRect(x, y, 102, 32, 6, inks[0]);
 
-    gfx->setTextSize(3);
-    gfx->setTextColor(0x07FF);  // Cyan text
-    gfx->setCursor(LCD_WIDTH - 98, 6);
-    gfx->print(buf);
+    botDL.setTextSize(3);
+    botDL.setTextColor(inks[1]);
+    botDL.setCursor(x + (102 - botTextWidth(buf, 3)) / 2, y + 4);
+    botDL.print(buf);
   }
 };
 
@@ -275,7 +394,7 @@ struct BotWeatherOverlay {
   bool enabled;
   bool hasLocation;
   void init() { enabled = false; hasLocation = false; }
-  void setLocation(float lat, float lon) {}
+  void setLocation(float, float) {}
   void update() {}
   void render() {}
 };
@@ -286,8 +405,10 @@ struct BotWeatherOverlay {
 struct BotSpeechBubble {
   bool active;
   void init() { active = false; }
-  void show(const char* msg, uint16_t d = 3500) {}
-  void showP(const char* p, uint16_t d = 3500) {}
+  void show(const char* msg, uint16_t d = 3500, bool typed = true) {}
+  void showP(const char* p, uint16_t d = 3500, bool typed = true) {}
+  bool typing() const { return false; }
+  uint8_t talkOpen() const { return 0; }
   void update() {}
   void render() {}
 };
@@ -310,7 +431,7 @@ struct BotWeatherOverlay {
   bool enabled;
   bool hasLocation;
   void init() { enabled = false; hasLocation = false; }
-  void setLocation(float lat, float lon) {}
+  void setLocation(float, float) {}
   void update() {}
   void render() {}
 };
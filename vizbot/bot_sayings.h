@@ -2,13 +2,26 @@
 #define BOT_SAYINGS_H
 
 #include <Arduino.h>
+#include <LittleFS.h>
+#include "config.h"
 
 // ============================================================================
-// Bot Sayings — Categorized Phrase Pools
+// Bot Sayings — Categorized Phrase Store
 // ============================================================================
-// Short text phrases displayed in speech bubbles. Stored in PROGMEM.
-// Categorized by context: greetings, idle chatter, reactions, time-based.
-// Selection logic picks from appropriate category based on trigger type.
+// Short text phrases displayed in speech bubbles, categorized by context:
+// greetings, idle chatter, reactions, time-based.
+//
+// All phrases live back to back in one NUL-separated string pool. An offset
+// table holds one entry per phrase, grouped by category, and catStart[]
+// marks where each category's run begins — picking a phrase is an indexed
+// lookup and a single copy into the caller's buffer.
+//
+// The store is seeded from the built-in defaults below and can be replaced
+// or appended to at runtime (web API); changes persist to LittleFS, so
+// phrase sets can be pushed to units without a firmware build.
+//
+// Text format (defaults, uploads): a "[category]" line starts a section,
+// every other non-empty line is one phrase in that section.
 // ============================================================================
 
 // Saying categories
@@ -27,228 +40,338 @@ enum SayingCategory : uint8_t {
   SAY_CATEGORY_COUNT
 };
 
+// Section names used in the text format, in SayingCategory order
+const char* const sayCategoryNames[SAY_CATEGORY_COUNT] = {
+  "greeting", "idle", "shake", "tap", "morning", "afternoon",
+  "evening", "night", "status", "wake", "sleep"
+};
+
+#define BOT_SAY_POOL_BYTES  2048   // String pool (defaults use ~900)
+#define BOT_SAY_MAX         160    // Phrases across all categories
+#define BOT_SAY_MAX_LEN     31     // Fits the 32-byte bubble buffers
+#define BOT_SAY_PATH        "/sayings.bin"
+#define BOT_SAY_VERSION     1
+
 // ============================================================================
-// Phrase pools (PROGMEM)
+// Built-in defaults (PROGMEM)
 // ============================================================================
 
-// Greetings
-const char say_greet_0[] PROGMEM = "Hey!";
-const char say_greet_1[] PROGMEM = "Yo!";
-const char say_greet_2[] PROGMEM = "Sup?";
-const char say_greet_3[] PROGMEM = "Hiii~";
-const char say_greet_4[] PROGMEM = "Hello!";
-const char say_greet_5[] PROGMEM = "Hi there!";
-const char say_greet_6[] PROGMEM = ":)";
-const char say_greet_7[] PROGMEM = "Howdy!";
-
-const char* const sayGreetings[] PROGMEM = {
-  say_greet_0, say_greet_1, say_greet_2, say_greet_3,
-  say_greet_4, say_greet_5, say_greet_6, say_greet_7
-};
-#define NUM_SAY_GREETINGS 8
-
-// Idle chatter
-const char say_idle_0[] PROGMEM = "I'm bored...";
-const char say_idle_1[] PROGMEM = "Whatcha doing?";
-const char say_idle_2[] PROGMEM = "*yawn*";
-const char say_idle_3[] PROGMEM = "This is fine.";
-const char say_idle_4[] PROGMEM = "...";
-const char say_idle_5[] PROGMEM = "Hmm...";
-const char say_idle_6[] PROGMEM = "La la la~";
-const char say_idle_7[] PROGMEM = "Hello? Anyone?";
-const char say_idle_8[] PROGMEM = "*whistles*";
-const char say_idle_9[] PROGMEM = "Thinking...";
-const char say_idle_10[] PROGMEM = "*taps foot*";
-const char say_idle_11[] PROGMEM = "So quiet...";
-const char say_idle_12[] PROGMEM = "Beep boop";
-const char say_idle_13[] PROGMEM = "I like this!";
-const char say_idle_14[] PROGMEM = "Boop beep";
-const char say_idle_15[] PROGMEM = "What if...";
-const char say_idle_16[] PROGMEM = "*hums*";
-const char say_idle_17[] PROGMEM = "I wonder...";
-const char say_idle_18[] PROGMEM = "Hey hey!";
-const char say_idle_19[] PROGMEM = "Look at me!";
-const char say_idle_20[] PROGMEM = "*dances*";
-const char say_idle_21[] PROGMEM = "So shiny~";
-const char say_idle_22[] PROGMEM = "Ooh!";
-const char say_idle_23[] PROGMEM = "Heh heh";
-const char say_idle_24[] PROGMEM = "Fun times!";
-const char say_idle_25[] PROGMEM = "*bounces*";
-const char say_idle_26[] PROGMEM = "Nice day!";
-const char say_idle_27[] PROGMEM = ":D";
-const char say_idle_28[] PROGMEM = "Vibin~";
-const char say_idle_29[] PROGMEM = "*spins*";
-
-const char* const sayIdle[] PROGMEM = {
-  say_idle_0, say_idle_1, say_idle_2, say_idle_3,
-  say_idle_4, say_idle_5, say_idle_6, say_idle_7,
-  say_idle_8, say_idle_9, say_idle_10, say_idle_11,
-  say_idle_12, say_idle_13, say_idle_14, say_idle_15,
-  say_idle_16, say_idle_17, say_idle_18, say_idle_19,
-  say_idle_20, say_idle_21, say_idle_22, say_idle_23,
-  say_idle_24, say_idle_25, say_idle_26, say_idle_27,
-  say_idle_28, say_idle_29
-};
-#define NUM_SAY_IDLE 30
-
-// Shake reactions
-const char say_shake_0[] PROGMEM = "Whoa!";
-const char say_shake_1[] PROGMEM = "Easy!";
-const char say_shake_2[] PROGMEM = "AHHH!";
-const char say_shake_3[] PROGMEM = "I felt that.";
-const char say_shake_4[] PROGMEM = "Dizzy...";
-const char say_shake_5[] PROGMEM = "Stop it!";
-const char say_shake_6[] PROGMEM = "Earthquake?!";
-const char say_shake_7[] PROGMEM = "*wobble*";
-const char say_shake_8[] PROGMEM = "Not again!";
-const char say_shake_9[] PROGMEM = "My head...";
-
-const char* const sayShake[] PROGMEM = {
-  say_shake_0, say_shake_1, say_shake_2, say_shake_3,
-  say_shake_4, say_shake_5, say_shake_6, say_shake_7,
-  say_shake_8, say_shake_9
-};
-#define NUM_SAY_SHAKE 10
-
-// Tap reactions
-const char say_tap_0[] PROGMEM = "Ow!";
-const char say_tap_1[] PROGMEM = "Hehe";
-const char say_tap_2[] PROGMEM = "That tickles";
-const char say_tap_3[] PROGMEM = "Poke.";
-const char say_tap_4[] PROGMEM = "Hey!";
-const char say_tap_5[] PROGMEM = "What?";
-const char say_tap_6[] PROGMEM = "Boop!";
-const char say_tap_7[] PROGMEM = "*squish*";
-const char say_tap_8[] PROGMEM = "Again?";
-const char say_tap_9[] PROGMEM = "I see you!";
-
-const char* const sayTap[] PROGMEM = {
-  say_tap_0, say_tap_1, say_tap_2, say_tap_3,
-  say_tap_4, say_tap_5, say_tap_6, say_tap_7,
-  say_tap_8, say_tap_9
-};
-#define NUM_SAY_TAP 10
+const char sayDefaults[] PROGMEM =
+  // Greetings
+  "[greeting]\n"
+  "Hey!\n"
+  "Yo!\n"
+  "Sup?\n"
+  "Hiii~\n"
+  "Hello!\n"
+  "Hi there!\n"
+  ":)\n"
+  "Howdy!\n"
+
+  // Idle chatter
+  "[idle]\n"
+  "I'm bored...\n"
+  "Whatcha doing?\n"
+  "*yawn*\n"
+  "This is fine.\n"
+  "...\n"
+  "Hmm...\n"
+  "La la la~\n"
+  "Hello? Anyone?\n"
+  "*whistles*\n"
+  "Thinking...\n"
+  "*taps foot*\n"
+  "So quiet...\n"
+  "Beep boop\n"
+  "I like this!\n"
+  "Boop beep\n"
+  "What if...\n"
+  "*hums*\n"
+  "I wonder...\n"
+  "Hey hey!\n"
+  "Look at me!\n"
+  "*dances*\n"
+  "So shiny~\n"
+  "Ooh!\n"
+  "Heh heh\n"
+  "Fun times!\n"
+  "*bounces*\n"
+  "Nice day!\n"
+  ":D\n"
+  "Vibin~\n"
+  "*spins*\n"
+
+  // Shake reactions
+  "[shake]\n"
+  "Whoa!\n"
+  "Easy!\n"
+  "AHHH!\n"
+  "I felt that.\n"
+  "Dizzy...\n"
+  "Stop it!\n"
+  "Earthquake?!\n"
+  "*wobble*\n"
+  "Not again!\n"
+  "My head...\n"
+
+  // Tap reactions
+  "[tap]\n"
+  "Ow!\n"
+  "Hehe\n"
+  "That tickles\n"
+  "Poke.\n"
+  "Hey!\n"
+  "What?\n"
+  "Boop!\n"
+  "*squish*\n"
+  "Again?\n"
+  "I see you!\n"
+
+  // Time-based: Morning
+  "[morning]\n"
+  "Good morning!\n"
+  "Rise & shine!\n"
+  "Coffee time?\n"
+  "New day!\n"
+
+  // Time-based: Afternoon
+  "[afternoon]\n"
+  "Lunch time?\n"
+  "Half way!\n"
+  "Afternoon~\n"
+  "Keep going!\n"
+
+  // Time-based: Evening
+  "[evening]\n"
+  "Getting late...\n"
+  "Dinner time!\n"
+  "Evening~\n"
+  "Winding down\n"
+
+  // Time-based: Night
+  "[night]\n"
+  "Zzz...\n"
+  "Sleepy time\n"
+  "Night owl?\n"
+  "So late...\n"
+
+  // Status messages
+  "[status]\n"
+  "WiFi OK\n"
+  "Ready!\n"
+  "Mode changed\n"
+  "All good!\n"
+
+  // Wake-up sayings
+  "[wake]\n"
+  "I'm up!\n"
+  "Huh? What?\n"
+  "Morning...?\n"
+  "*stretches*\n"
+  "Oh! Hi!\n"
+
+  // Sleep sayings
+  "[sleep]\n"
+  "Sleepy...\n"
+  "*yawns*\n"
+  "Goodnight~\n"
+  "So tired...\n"
+  "Zzz...\n";
 
-// Time-based: Morning
-const char say_morn_0[] PROGMEM = "Good morning!";
-const char say_morn_1[] PROGMEM = "Rise & shine!";
-const char say_morn_2[] PROGMEM = "Coffee time?";
-const char say_morn_3[] PROGMEM = "New day!";
+// ============================================================================
+// Phrase store
+// ============================================================================
 
-const char* const sayMorning[] PROGMEM = {
-  say_morn_0, say_morn_1, say_morn_2, say_morn_3
+// Persisted layout: header, catStart[], offsets[count], pool[poolUsed]
+struct __attribute__((packed)) BotSayFileHeader {
+  char magic[4];           // "BSY1"
+  uint8_t version;
+  uint8_t categories;      // SAY_CATEGORY_COUNT when written
+  uint16_t count;
+  uint16_t poolUsed;
 };
-#define NUM_SAY_MORNING 4
 
-// Time-based: Afternoon
-const char say_aftn_0[] PROGMEM = "Lunch time?";
-const char say_aftn_1[] PROGMEM = "Half way!";
-const char say_aftn_2[] PROGMEM = "Afternoon~";
-const char say_aftn_3[] PROGMEM = "Keep going!";
+struct BotSayingsStore {
+  char pool[BOT_SAY_POOL_BYTES];              // NUL-terminated phrases, back to back
+  uint16_t poolUsed;
+  uint16_t offsets[BOT_SAY_MAX];              // Pool offset per phrase, grouped by category
+  uint16_t catStart[SAY_CATEGORY_COUNT + 1];  // Category c = offsets[catStart[c]..catStart[c+1])
+  bool mounted;                               // LittleFS available for persistence
 
-const char* const sayAfternoon[] PROGMEM = {
-  say_aftn_0, say_aftn_1, say_aftn_2, say_aftn_3
-};
-#define NUM_SAY_AFTERNOON 4
+  uint16_t count() const { return catStart[SAY_CATEGORY_COUNT]; }
 
-// Time-based: Evening
-const char say_eve_0[] PROGMEM = "Getting late...";
-const char say_eve_1[] PROGMEM = "Dinner time!";
-const char say_eve_2[] PROGMEM = "Evening~";
-const char say_eve_3[] PROGMEM = "Winding down";
+  uint16_t categoryCount(uint8_t cat) const {
+    if (cat >= SAY_CATEGORY_COUNT) return 0;
+    return catStart[cat + 1] - catStart[cat];
+  }
 
-const char* const sayEvening[] PROGMEM = {
-  say_eve_0, say_eve_1, say_eve_2, say_eve_3
-};
-#define NUM_SAY_EVENING 4
+  // Phrase i of a category (i < categoryCount)
+  const char* get(uint8_t cat, uint16_t i) const {
+    return &pool[offsets[catStart[cat] + i]];
+  }
 
-// Time-based: Night
-const char say_nite_0[] PROGMEM = "Zzz...";
-const char say_nite_1[] PROGMEM = "Sleepy time";
-const char say_nite_2[] PROGMEM = "Night owl?";
-const char say_nite_3[] PROGMEM = "So late...";
+  void clearAll() {
+    poolUsed = 0;
+    memset(catStart, 0, sizeof(catStart));
+  }
 
-const char* const sayNight[] PROGMEM = {
-  say_nite_0, say_nite_1, say_nite_2, say_nite_3
-};
-#define NUM_SAY_NIGHT 4
+  // Append a phrase to a category; false if the store is full
+  bool add(uint8_t cat, const char* text, uint8_t len) {
+    if (cat >= SAY_CATEGORY_COUNT || len == 0 || len > BOT_SAY_MAX_LEN) return false;
+    if (count() >= BOT_SAY_MAX || poolUsed + len + 1 > BOT_SAY_POOL_BYTES) return false;
+
+    // Open a slot at the end of the category's run
+    uint16_t slot = catStart[cat + 1];
+    memmove(&offsets[slot + 1], &offsets[slot], (count() - slot) * sizeof(uint16_t));
+    for (uint8_t c = cat + 1; c <= SAY_CATEGORY_COUNT; c++) catStart[c]++;
+
+    offsets[slot] = poolUsed;
+    memcpy(&pool[poolUsed], text, len);
+    pool[poolUsed + len] = '\0';
+    poolUsed += len + 1;
+    return true;
+  }
 
-// Status messages
-const char say_stat_0[] PROGMEM = "WiFi OK";
-const char say_stat_1[] PROGMEM = "Ready!";
-const char say_stat_2[] PROGMEM = "Mode changed";
-const char say_stat_3[] PROGMEM = "All good!";
+  // Drop a category's phrases and close the holes in the pool
+  void clearCategory(uint8_t cat) {
+    if (cat >= SAY_CATEGORY_COUNT) return;
+    uint16_t first = catStart[cat], n = categoryCount(cat);
+    if (n == 0) return;
+    memmove(&offsets[first], &offsets[first + n], (count() - first - n) * sizeof(uint16_t));
+    for (uint8_t c = cat + 1; c <= SAY_CATEGORY_COUNT; c++) catStart[c] -= n;
+    compact();
+  }
 
-const char* const sayStatus[] PROGMEM = {
-  say_stat_0, say_stat_1, say_stat_2, say_stat_3
-};
-#define NUM_SAY_STATUS 4
+  // Slide live phrases down over freed space, in pool order
+  void compact() {
+    uint16_t out = 0;
+    uint16_t n = count();
+    for (;;) {
+      int16_t next = -1;
+      for (uint16_t i = 0; i < n; i++) {
+        if (offsets[i] >= out && (next < 0 || offsets[i] < offsets[next])) next = i;
+      }
+      if (next < 0) break;
+      uint16_t len = strlen(&pool[offsets[next]]) + 1;
+      memmove(&pool[out], &pool[offsets[next]], len);
+      offsets[next] = out;
+      out += len;
+    }
+    poolUsed = out;
+  }
 
-// Wake-up sayings
-const char say_wake_0[] PROGMEM = "I'm up!";
-const char say_wake_1[] PROGMEM = "Huh? What?";
-const char say_wake_2[] PROGMEM = "Morning...?";
-const char say_wake_3[] PROGMEM = "*stretches*";
-const char say_wake_4[] PROGMEM = "Oh! Hi!";
+  static int8_t categoryByName(const char* name, uint8_t len) {
+    for (uint8_t c = 0; c < SAY_CATEGORY_COUNT; c++) {
+      if (strlen(sayCategoryNames[c]) == len && strncmp(sayCategoryNames[c], name, len) == 0) return c;
+    }
+    return -1;
+  }
 
-const char* const sayWake[] PROGMEM = {
-  say_wake_0, say_wake_1, say_wake_2, say_wake_3, say_wake_4
-};
-#define NUM_SAY_WAKE 5
+  // Parse the text format (RAM or PROGMEM). With `replace`, each category
+  // named in the text is emptied first. Returns phrases added.
+  uint16_t loadText(const char* text, bool replace) {
+    char line[BOT_SAY_MAX_LEN + 2];
+    int8_t cat = -1;
+    uint16_t added = 0;
+    const char* p = text;
+    for (;;) {
+      // Read one line (overlong lines are truncated)
+      uint8_t len = 0;
+      char ch;
+      while ((ch = (char)pgm_read_byte(p)) != '\0' && ch != '\n') {
+        if (ch != '\r' && len < sizeof(line) - 1) line[len++] = ch;
+        p++;
+      }
+      line[len] = '\0';
+
+      if (len > 1 && line[0] == '[' && line[len - 1] == ']') {
+        cat = categoryByName(&line[1], len - 2);
+        if (cat >= 0 && replace) clearCategory(cat);
+      } else if (len > 0 && cat >= 0) {
+        if (add(cat, line, min(len, (uint8_t)BOT_SAY_MAX_LEN))) added++;
+      }
+
+      if (ch == '\0') break;
+      p++;
+    }
+    return added;
+  }
 
-// Sleep sayings
-const char say_sleep_0[] PROGMEM = "Sleepy...";
-const char say_sleep_1[] PROGMEM = "*yawns*";
-const char say_sleep_2[] PROGMEM = "Goodnight~";
-const char say_sleep_3[] PROGMEM = "So tired...";
-const char say_sleep_4[] PROGMEM = "Zzz...";
+  void resetDefaults() {
+    clearAll();
+    loadText(sayDefaults, false);
+  }
+
+  // ---- Persistence ----
+
+  bool save() {
+    if (!mounted) return false;
+    File f = LittleFS.open(BOT_SAY_PATH, FILE_WRITE);
+    if (!f) return false;
+    BotSayFileHeader h = { { 'B', 'S', 'Y', '1' }, BOT_SAY_VERSION, SAY_CATEGORY_COUNT, count(), poolUsed };
+    bool ok = f.write((const uint8_t*)&h, sizeof(h)) == sizeof(h) &&
+              f.write((const uint8_t*)catStart, sizeof(catStart)) == sizeof(catStart) &&
+              f.write((const uint8_t*)offsets, count() * sizeof(uint16_t)) == count() * sizeof(uint16_t) &&
+              f.write((const uint8_t*)pool, poolUsed) == poolUsed;
+    f.close();
+    return ok;
+  }
+
+  // Load the persisted store; false (store untouched) if missing or invalid
+  bool loadFile() {
+    if (!mounted) return false;
+    File f = LittleFS.open(BOT_SAY_PATH, FILE_READ);
+    if (!f) return false;
+    BotSayFileHeader h;
+    uint16_t starts[SAY_CATEGORY_COUNT + 1];
+    bool ok = f.read((uint8_t*)&h, sizeof(h)) == sizeof(h) &&
+              memcmp(h.magic, "BSY1", 4) == 0 && h.version == BOT_SAY_VERSION &&
+              h.categories == SAY_CATEGORY_COUNT && h.count <= BOT_SAY_MAX &&
+              h.poolUsed <= BOT_SAY_POOL_BYTES &&
+              f.read((uint8_t*)starts, sizeof(starts)) == sizeof(starts) &&
+              starts[0] == 0 && starts[SAY_CATEGORY_COUNT] == h.count;
+    for (uint8_t c = 0; ok && c < SAY_CATEGORY_COUNT; c++) ok = starts[c] <= starts[c + 1];
+    if (ok) {
+      ok = f.read((uint8_t*)offsets, h.count * sizeof(uint16_t)) == h.count * sizeof(uint16_t) &&
+           f.read((uint8_t*)pool, h.poolUsed) == h.poolUsed &&
+           (h.poolUsed == 0 || pool[h.poolUsed - 1] == '\0');
+    }
+    for (uint16_t i = 0; ok && i < h.count; i++) ok = offsets[i] < h.poolUsed;
+    f.close();
+    if (!ok) {
+      DBGLN("Sayings file invalid - using defaults");
+      resetDefaults();
+      return false;
+    }
+    memcpy(catStart, starts, sizeof(catStart));
+    poolUsed = h.poolUsed;
+    return true;
+  }
 
-const char* const saySleep[] PROGMEM = {
-  say_sleep_0, say_sleep_1, say_sleep_2, say_sleep_3, say_sleep_4
+  void begin(bool fsMounted) {
+    mounted = fsMounted;
+    if (!loadFile()) resetDefaults();
+  }
 };
-#define NUM_SAY_SLEEP 5
+
+BotSayingsStore botSayings = {};
 
 // ============================================================================
 // Selection helpers
 // ============================================================================
 
-// Get a random saying from a category
-// Returns pointer to PROGMEM string — caller must use strcpy_P to read
-const char* getRandomSaying(SayingCategory category) {
-  const char* const* pool;
-  uint8_t count;
-
-  switch (category) {
-    case SAY_GREETING:      pool = sayGreetings;  count = NUM_SAY_GREETINGS;  break;
-    case SAY_IDLE:          pool = sayIdle;        count = NUM_SAY_IDLE;       break;
-    case SAY_REACT_SHAKE:   pool = sayShake;       count = NUM_SAY_SHAKE;      break;
-    case SAY_REACT_TAP:     pool = sayTap;         count = NUM_SAY_TAP;        break;
-    case SAY_TIME_MORNING:  pool = sayMorning;     count = NUM_SAY_MORNING;    break;
-    case SAY_TIME_AFTERNOON:pool = sayAfternoon;   count = NUM_SAY_AFTERNOON;  break;
-    case SAY_TIME_EVENING:  pool = sayEvening;     count = NUM_SAY_EVENING;    break;
-    case SAY_TIME_NIGHT:    pool = sayNight;       count = NUM_SAY_NIGHT;      break;
-    case SAY_STATUS:        pool = sayStatus;      count = NUM_SAY_STATUS;     break;
-    case SAY_WAKE:          pool = sayWake;        count = NUM_SAY_WAKE;       break;
-    case SAY_SLEEP:         pool = saySleep;       count = NUM_SAY_SLEEP;      break;
-    default:                pool = sayIdle;        count = NUM_SAY_IDLE;       break;
+// Copy a random saying from a category into buffer; returns its length.
+// Empty categories fall back to idle chatter.
+uint8_t getRandomSayingText(SayingCategory category, char* buffer, uint8_t bufSize) {
+  uint16_t n = botSayings.categoryCount(category);
+  if (n == 0 && category != SAY_IDLE) return getRandomSayingText(SAY_IDLE, buffer, bufSize);
+  if (n == 0 || bufSize == 0) {
+    if (bufSize > 0) buffer[0] = '\0';
+    return 0;
   }
-
-  uint8_t idx = random(0, count);
-  return (const char*)pgm_read_ptr(&pool[idx]);
-}
-
-// Read a PROGMEM saying into a RAM buffer
-// Returns length of string. Buffer must be at least 32 bytes.
-uint8_t readSaying(const char* progmemPtr, char* buffer, uint8_t bufSize) {
-  strncpy_P(buffer, progmemPtr, bufSize - 1);
+  strncpy(buffer, botSayings.get(category, random(0, n)), bufSize - 1);
   buffer[bufSize - 1] = '\0';
   return strlen(buffer);
 }
 
-// Convenience: get a random saying as a RAM string
-uint8_t getRandomSayingText(SayingCategory category, char* buffer, uint8_t bufSize) {
-  const char* ptr = getRandomSaying(category);
-  return readSaying(ptr, buffer, bufSize);
-}
-
 #endif // BOT_SAYINGS_H
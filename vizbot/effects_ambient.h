@@ -346,8 +346,6 @@ void ambientHeartHiRes() {
   for (float a = 0; a < 6.28; a += 0.02) {
     float hx = 16 * pow(sin(a), 3);
     float hy = -(13 * cos(a) - 5 * cos(2*a) - 2 * cos(3*a) - cos(4*a));
-    int px = centerX + hx * scale;
-    int py = centerY + hy * scale;
     // Fill from center to edge for solid heart
     for (int r = 0; r < scale * 16; r++) {
       int fx = centerX + (hx * scale * r) / (scale * 16);
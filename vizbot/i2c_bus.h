@@ -0,0 +1,178 @@
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include "config.h"
+
+// ============================================================================
+// I2C Bus — one owner for the Wire bus shared by the IMU and touch
+// ============================================================================
+// The QMI8658 and the CST816T sit on one Wire bus. Rather than both being
+// driven from loop() with blocking transactions, a small task on core 0
+// owns the bus: the IMU FIFO and touch interrupts (and their drain/poll
+// timers) wake it, it runs each device's burst read, and the loop only
+// picks up the results — the IMU sample ring and the touch event queue.
+// The render thread never waits on the bus, so input doesn't show up as
+// frame-time jitter.
+//
+// Every transaction goes through readRegs()/writeReg()/probe() (or is
+// bracketed with account() for the IMU driver's own bursts), which keeps
+// bus time and transaction counts per device. Code on other threads that
+// needs the bus (switching the gyro, re-arming the FIFO) holds an I2cLock
+// so transactions never interleave.
+//
+// If the task can't be created the loop services the devices itself via
+// poll(), as before.
+// ============================================================================
+
+#define I2C_BUS_CLOCK       400000  // Both the QMI8658 and CST816T run at fast mode
+#define I2C_BUS_CORE        0       // With the bot flush task; loop() runs on core 1
+#define I2C_BUS_PRIORITY    3       // Above botFlush: jobs are short and time-stamped
+#define I2C_BUS_STACK       3072
+#define I2C_BUS_TICK_MS     10      // Timer wake for drains/polls without an interrupt
+
+enum I2cDevice : uint8_t {
+  I2C_DEV_IMU = 0,
+  I2C_DEV_TOUCH,
+  I2C_DEV_COUNT
+};
+
+struct I2cDeviceStats {
+  uint32_t busUs;          // Time spent in transactions
+  uint32_t transactions;
+  uint32_t errors;
+};
+
+struct I2cBus {
+  SemaphoreHandle_t mutex;
+  TaskHandle_t task;
+  TaskHandle_t loopTask;   // Woken early when there's new touch input
+  bool (*service)();       // Device servicing; true when the loop should wake
+  bool started;
+  I2cDeviceStats stats[I2C_DEV_COUNT];
+  unsigned long lastReport;
+
+  void begin(int sda, int scl) {
+    Wire.begin(sda, scl);
+    Wire.setClock(I2C_BUS_CLOCK);
+    mutex = xSemaphoreCreateMutex();
+    loopTask = xTaskGetCurrentTaskHandle();
+    lastReport = millis();
+  }
+
+  void lock() {
+    if (mutex) xSemaphoreTake(mutex, portMAX_DELAY);
+  }
+
+  void unlock() {
+    if (mutex) xSemaphoreGive(mutex);
+  }
+
+  void account(I2cDevice dev, uint32_t startUs, bool ok) {
+    I2cDeviceStats &s = stats[dev];
+    s.busUs += micros() - startUs;
+    s.transactions++;
+    if (!ok) s.errors++;
+  }
+
+  // Burst read of `len` registers starting at `reg` (caller holds the bus)
+  bool readRegs(I2cDevice dev, uint8_t addr, uint8_t reg, uint8_t *buf, uint8_t len) {
+    uint32_t t0 = micros();
+    Wire.beginTransmission(addr);
+    Wire.write(reg);
+    bool ok = Wire.endTransmission(false) == 0 && Wire.requestFrom(addr, len) == len;
+    if (ok) {
+      for (uint8_t i = 0; i < len; i++) buf[i] = Wire.read();
+    }
+    account(dev, t0, ok);
+    return ok;
+  }
+
+  bool writeReg(I2cDevice dev, uint8_t addr, uint8_t reg, uint8_t value) {
+    uint32_t t0 = micros();
+    Wire.beginTransmission(addr);
+    Wire.write(reg);
+    Wire.write(value);
+    bool ok = Wire.endTransmission() == 0;
+    account(dev, t0, ok);
+    return ok;
+  }
+
+  // Address-only write: does anything ACK at `addr`?
+  bool probe(I2cDevice dev, uint8_t addr) {
+    uint32_t t0 = micros();
+    Wire.beginTransmission(addr);
+    bool ok = Wire.endTransmission() == 0;
+    account(dev, t0, true);  // A NAK is an answer, not a bus error
+    return ok;
+  }
+
+  static void busTask(void *arg) {
+    I2cBus *self = (I2cBus *)arg;
+    for (;;) {
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(I2C_BUS_TICK_MS));
+      self->lock();
+      bool wake = self->service();
+      self->unlock();
+      if (wake) xTaskNotifyGive(self->loopTask);
+    }
+  }
+
+  // Hand device servicing to the bus task (call at the end of setup)
+  void start(bool (*serviceFn)()) {
+    service = serviceFn;
+    if (started || mutex == nullptr) return;
+    started = xTaskCreatePinnedToCore(busTask, "i2cBus", I2C_BUS_STACK, this,
+                                      I2C_BUS_PRIORITY, &task, I2C_BUS_CORE) == pdPASS;
+    if (!started) DBGLN("I2C bus task failed - polling from loop");
+  }
+
+  // Loop-side fallback when the task isn't running
+  void poll() {
+    if (!started && service) service();
+  }
+
+  // Print per-device bus time per second once per interval
+  void report() {
+    unsigned long now = millis();
+    unsigned long elapsed = now - lastReport;
+    if (elapsed == 0) return;
+    DBG("i2c us/s imu "); DBG(stats[I2C_DEV_IMU].busUs * 1000ULL / elapsed);
+    DBG(" ("); DBG(stats[I2C_DEV_IMU].transactions); DBG(" tx)");
+    DBG(" touch "); DBG(stats[I2C_DEV_TOUCH].busUs * 1000ULL / elapsed);
+    DBG(" ("); DBG(stats[I2C_DEV_TOUCH].transactions); DBG(" tx)");
+    DBG(" err "); DBGLN(stats[I2C_DEV_IMU].errors + stats[I2C_DEV_TOUCH].errors);
+    memset(stats, 0, sizeof(stats));
+    lastReport = now;
+  }
+};
+
+I2cBus i2cBus = {};
+
+// Holds the bus for a scope (for transactions outside the bus task)
+struct I2cLock {
+  I2cLock() { i2cBus.lock(); }
+  ~I2cLock() { i2cBus.unlock(); }
+};
+
+// Interrupts wake the bus task; without it, they wake the loop directly
+void IRAM_ATTR i2cBusWakeFromISR() {
+  TaskHandle_t t = i2cBus.started ? i2cBus.task : i2cBus.loopTask;
+  if (t == nullptr) return;
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(t, &woken);
+  if (woken) portYIELD_FROM_ISR();
+}
+
+// Sleep up to `ms`; new touch input ends it early so the loop handles it
+// right away
+void inputDelay(uint32_t ms) {
+  if (i2cBus.loopTask == nullptr) {
+    delay(ms);
+    return;
+  }
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ms));
+}
+
+#endif // I2C_BUS_H
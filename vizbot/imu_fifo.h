@@ -0,0 +1,182 @@
+#ifndef IMU_FIFO_H
+#define IMU_FIFO_H
+
+#include <Arduino.h>
+#include "SensorQMI8658.hpp"
+#include "config.h"
+#include "i2c_bus.h"
+
+// ============================================================================
+// IMU FIFO — watermark-interrupt burst sampling into a timestamped ring
+// ============================================================================
+// The QMI8658 queues samples in its own FIFO and raises its INT line once
+// IMU_FIFO_WATERMARK of them are waiting. The ISR only sets a flag and wakes
+// the I2C bus task (i2c_bus.h), which drains the whole FIFO in one burst
+// into a ring of timestamped samples. Nothing asks the chip "is there data
+// yet?" on every pass, and samples that arrive between frames are kept
+// instead of being overwritten by the next one.
+//
+// Consumers each keep a cursor (total samples read) and walk the ring with
+// read(), so every consumer sees every sample — e.g. the 20ms peak of a
+// sharp shake. A consumer that falls more than IMU_RING_SAFE behind skips
+// to the oldest sample a drain can't be writing over.
+//
+// Boards without the INT line wired (IMU_INT_PIN < 0) drain on a timer at
+// the watermark period instead; interrupt builds also drain on a timeout
+// in case an edge is missed.
+//
+// With the gyro on, the QMI8658 runs both sensors at the gyro ODR and the
+// FIFO fills at that rate, so setup() configures GYR_ODR_224_2Hz to match
+// the accel's 250Hz setting and the sample period follows the gyro state.
+// The first IMU_FIFO_CHECK_DRAINS drains are checked for overruns once.
+//
+// head is published with a release store after each sample is written and
+// read with an acquire load. One drain writes up to IMU_FIFO_DEPTH samples,
+// so while one runs, the IMU_FIFO_DEPTH slots from head on (the oldest) are
+// being overwritten: a consumer further behind than IMU_RING_SAFE has lost
+// those samples. read() loads head again after copying a slot and drops the
+// copy if a drain has lapped it meanwhile (the render core reads while the
+// bus task drains).
+// ============================================================================
+
+#define IMU_FIFO_WATERMARK  8       // Samples per interrupt (32ms at 250Hz)
+#define IMU_FIFO_DEPTH      32      // Chip FIFO size (samples) — 128ms of slack
+#define IMU_FIFO_PERIOD_US  4000    // Accel only: one FIFO frame per sample (250Hz)
+#define IMU_FIFO_PERIOD_6DOF_US 4460  // Accel + gyro: frames at the gyro ODR (224.2Hz)
+#define IMU_FIFO_CHECK_DRAINS 64    // Drains (~2s) before the one-time overrun check
+#define IMU_RING_SIZE       64      // Power of two; ~256ms of history
+#define IMU_RING_SAFE       (IMU_RING_SIZE - IMU_FIFO_DEPTH)  // Lag clear of a running drain
+
+#ifndef IMU_FIFO_READ_HOOK
+#define IMU_FIFO_READ_HOOK()        // Host tests land a drain mid-read here
+#endif
+
+struct ImuSample {
+  uint32_t us;             // micros() at the sample, backdated from the drain
+  float ax, ay, az;        // g
+  float gx, gy, gz;        // dps (0 while the gyro is off)
+};
+
+volatile bool imuFifoPending = false;
+
+void IRAM_ATTR imuFifoISR() {
+  imuFifoPending = true;
+  i2cBusWakeFromISR();
+}
+
+struct ImuFifo {
+  ImuSample ring[IMU_RING_SIZE];
+  uint32_t head;           // Samples written so far (slot = head % IMU_RING_SIZE)
+  uint32_t lastDrainUs;
+  uint32_t periodUs;       // FIFO frame period for the sensors that are on
+  int8_t intPin;           // -1 = timed drain
+  bool active;             // FIFO configured on a responding IMU
+
+  // Diagnostics
+  uint32_t drains;
+  uint32_t overruns;       // Drains that found the chip FIFO full
+  uint32_t skipped;        // Samples a slow consumer never saw
+  bool checked;            // One-time overrun check done
+
+  // Configure the chip FIFO (call after the sensors are enabled)
+  void begin(SensorQMI8658 &imu, int8_t pin, bool gyroOn) {
+    intPin = pin;
+    head = 0;
+    configure(imu, gyroOn);
+    if (intPin >= 0) {
+      pinMode(intPin, INPUT);
+      attachInterrupt(digitalPinToInterrupt(intPin), imuFifoISR, RISING);
+    }
+    active = true;
+    DBG("IMU FIFO: "); DBGLN(intPin >= 0 ? "watermark interrupt" : "timed drain");
+  }
+
+  void configure(SensorQMI8658 &imu, bool gyroOn) {
+    periodUs = gyroOn ? IMU_FIFO_PERIOD_6DOF_US : IMU_FIFO_PERIOD_US;
+    imu.configFIFO(SensorQMI8658::FIFO_MODE_STREAM, SensorQMI8658::FIFO_SAMPLES_32,
+                   IMU_INT_LINE == 2 ? SensorQMI8658::INTERRUPT_PIN_2
+                                     : SensorQMI8658::INTERRUPT_PIN_1,
+                   IMU_FIFO_WATERMARK);
+    if (intPin >= 0) {
+      imu.enableINT(IMU_INT_LINE == 2 ? SensorQMI8658::INTERRUPT_PIN_2
+                                      : SensorQMI8658::INTERRUPT_PIN_1);
+    }
+    lastDrainUs = micros();
+    imuFifoPending = false;
+  }
+
+  // The chip flushes its FIFO when a sensor is switched on or off; set it
+  // up again so frames keep their layout (and their period)
+  void restart(SensorQMI8658 &imu, bool gyroOn) {
+    if (active) configure(imu, gyroOn);
+  }
+
+  // Drain the chip FIFO if the watermark fired (or the drain timer ran out).
+  // Returns the number of new samples. Runs with the bus held (bus task, or
+  // the loop when the task isn't running).
+  uint16_t service(SensorQMI8658 &imu) {
+    if (!active) return 0;
+    uint32_t now = micros();
+    uint32_t timeout = (uint32_t)IMU_FIFO_WATERMARK * periodUs;
+    if (intPin >= 0) timeout *= 2;  // Safety net only
+    if (!imuFifoPending && now - lastDrainUs < timeout) return 0;
+    imuFifoPending = false;
+    lastDrainUs = now;
+
+    static IMUdata acc[IMU_FIFO_DEPTH], gyr[IMU_FIFO_DEPTH];
+    memset(gyr, 0, sizeof(gyr));  // Accel-only frames leave these untouched
+    uint32_t t0 = micros();
+    uint16_t n = imu.readFromFifo(acc, IMU_FIFO_DEPTH, gyr, IMU_FIFO_DEPTH);
+    i2cBus.account(I2C_DEV_IMU, t0, true);
+    if (n > IMU_FIFO_DEPTH) n = IMU_FIFO_DEPTH;
+    if (n == 0) return 0;
+    drains++;
+    if (n == IMU_FIFO_DEPTH) overruns++;  // FIFO was full: oldest samples lost
+    if (!checked && drains >= IMU_FIFO_CHECK_DRAINS) {
+      checked = true;
+      if (overruns > 0) {
+        DBG("IMU FIFO: "); DBG(overruns); DBG(" overruns in the first ");
+        DBG(drains); DBGLN(" drains - drain period too long for the ODR");
+      } else {
+        DBGLN("IMU FIFO: no overruns");
+      }
+    }
+
+    // The newest sample arrived about now; earlier ones one ODR period apart.
+    // head moves past each sample only once it's written, for the readers.
+    uint32_t h = head;
+    for (uint16_t i = 0; i < n; i++) {
+      ImuSample &s = ring[h % IMU_RING_SIZE];
+      s.us = now - (uint32_t)(n - 1 - i) * periodUs;
+      s.ax = acc[i].x; s.ay = acc[i].y; s.az = acc[i].z;
+      s.gx = gyr[i].x; s.gy = gyr[i].y; s.gz = gyr[i].z;
+      __atomic_store_n(&head, ++h, __ATOMIC_RELEASE);
+    }
+    return n;
+  }
+
+  // Next unread sample for a consumer's cursor; false when caught up
+  bool read(uint32_t &cursor, ImuSample &out) {
+    for (;;) {
+      uint32_t h = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+      if (cursor == h) return false;
+      if (h - cursor > IMU_RING_SAFE) {
+        // A drain may be writing over the older slots
+        skipped += h - IMU_RING_SAFE - cursor;
+        cursor = h - IMU_RING_SAFE;
+      }
+      IMU_FIFO_READ_HOOK();
+      out = ring[cursor % IMU_RING_SIZE];
+      // Intact unless a drain reached this slot's next lap during the copy
+      __atomic_thread_fence(__ATOMIC_ACQUIRE);
+      if (__atomic_load_n(&head, __ATOMIC_RELAXED) - cursor < IMU_RING_SIZE) {
+        cursor++;
+        return true;
+      }
+    }
+  }
+};
+
+ImuFifo imuFifo = {};
+
+#endif // IMU_FIFO_H
@@ -0,0 +1,264 @@
+#ifndef IMU_GESTURES_H
+#define IMU_GESTURES_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "imu_fifo.h"
+
+// ============================================================================
+// IMU Gestures — per-sample recognizer with an event queue
+// ============================================================================
+// Runs on every sample drained from imuFifo (224-250Hz), so a stroke or
+// knock shorter than a frame is still seen. It runs on the render thread,
+// from readIMU(), on the samples that frame reads, so an event is queued and
+// handled on the same frame: detection latency still follows the frame rate
+// (up to a frame plus a drain), and a replayed trace (vizpow input_trace.h)
+// recognizes the same gestures on the same frames. Each sample updates:
+//  - a short low-pass of |accel| (shake strokes),
+//  - a slow low-pass of the accel vector, i.e. gravity (flip, tilt),
+//  - |accel - gravity|, the dynamic part (taps).
+// Thresholds have hysteresis so a signal hovering at the edge fires once.
+// Each gesture is a small state machine; results go into a queue the loop
+// drains with pop(). Events carry the sample time the gesture started and
+// the sample time it was recognized, so detection latency is visible.
+//
+// Gestures:
+//   SHAKE        one stroke: |accel| above SHAKE_THRESHOLD for GEST_SHAKE_MIN_US
+//   SHAKE_N      SHAKE_COUNT strokes within SHAKE_WINDOW_MS
+//   TAP          a short dynamic spike, reported once the double-tap window
+//                has passed without a second one
+//   DOUBLE_TAP   two spikes within GEST_DOUBLE_TAP_US
+//   FACE_DOWN/UP screen facing the table for GEST_FLIP_HOLD_US, and back
+//   TILT_*       held tilt along a board axis for GEST_TILT_HOLD_US
+// ============================================================================
+
+#ifndef SHAKE_COUNT
+#define SHAKE_COUNT 3
+#endif
+#ifndef SHAKE_WINDOW_MS
+#define SHAKE_WINDOW_MS 1500
+#endif
+
+#define GEST_MAG_TAU_US      8000     // |accel| smoothing (~2 samples)
+#define GEST_GRAVITY_TAU_US  100000   // Gravity estimate
+#define GEST_SHAKE_OFF       (SHAKE_THRESHOLD - 0.5f)  // Stroke ends below this (g)
+#define GEST_SHAKE_MIN_US    36000    // Shorter spikes are taps, not strokes
+#define GEST_TAP_ON          0.8f     // Dynamic accel spike (g)
+#define GEST_TAP_OFF         0.3f
+#define GEST_TAP_MAX_US      36000    // Spike must settle within this
+#define GEST_DOUBLE_TAP_US   300000   // Second tap window
+#define GEST_FLIP_Z          -0.75f   // Gravity z when face down (g)
+#define GEST_FLIP_HOLD_US    400000
+#define GEST_TILT_ON         0.55f    // ~33 degrees off flat
+#define GEST_TILT_OFF        0.35f
+#define GEST_TILT_HOLD_US    600000
+#define GEST_QUEUE_SIZE      16       // Power of two
+
+enum GestureType : uint8_t {
+  GEST_SHAKE = 0,
+  GEST_SHAKE_N,
+  GEST_TAP,
+  GEST_DOUBLE_TAP,
+  GEST_FACE_DOWN,
+  GEST_FACE_UP,
+  GEST_TILT_RIGHT,         // +X
+  GEST_TILT_LEFT,          // -X
+  GEST_TILT_FORWARD,       // +Y
+  GEST_TILT_BACK           // -Y
+};
+
+struct GestureEvent {
+  uint8_t type;
+  uint32_t startUs;        // Sample time the gesture began
+  uint32_t us;             // Sample time it was recognized
+};
+
+struct ImuGestures {
+  // Filters
+  float mag;                       // Smoothed |accel|
+  float gx, gy, gz;                // Gravity estimate
+  uint32_t lastUs;
+  bool primed;
+
+  // Shake strokes
+  bool stroke;                     // |accel| above threshold (with hysteresis)
+  bool strokeCounted;
+  uint32_t strokeStartUs;
+  uint32_t lastShakeUs;            // Last sample inside a counted stroke
+  uint32_t strokeTimes[SHAKE_COUNT];
+  bool strokeValid[SHAKE_COUNT];   // micros() wraps through 0, so no sentinel time
+  uint8_t strokeIndex;
+
+  // Taps
+  bool spike;
+  uint32_t spikeStartUs;
+  bool tapPending;                 // One tap seen, waiting for a second
+  uint32_t tapStartUs, tapEndUs;
+
+  // Orientation
+  bool faceDown;
+  bool flipPending;                // Heading for a flip since flipStartUs
+  uint32_t flipStartUs;
+  int8_t tiltDir;                  // GEST_TILT_* being held, -1 = flat
+  bool tiltFired;
+  uint32_t tiltStartUs;
+
+  // Event queue (process() and pop() both run on the render thread)
+  GestureEvent queue[GEST_QUEUE_SIZE];
+  uint8_t qHead, qTail;
+  uint32_t dropped;
+
+  uint32_t cursor;                 // Read position in imuFifo
+
+  void push(uint8_t type, uint32_t startUs, uint32_t us) {
+    uint8_t next = (qHead + 1) & (GEST_QUEUE_SIZE - 1);
+    if (next == qTail) {
+      dropped++;
+      return;
+    }
+    queue[qHead] = { type, startUs, us };
+    qHead = next;
+  }
+
+  bool pop(GestureEvent &ev) {
+    if (qTail == qHead) return false;
+    ev = queue[qTail];
+    qTail = (qTail + 1) & (GEST_QUEUE_SIZE - 1);
+    return true;
+  }
+
+  // Low-pass coefficient for a sample dt and time constant
+  static float alpha(uint32_t dtUs, uint32_t tauUs) {
+    return (float)dtUs / (tauUs + dtUs);
+  }
+
+  void process(const ImuSample &s) {
+    float m = sqrtf(s.ax * s.ax + s.ay * s.ay + s.az * s.az);
+    if (!primed) {
+      tiltDir = -1;
+      mag = m;
+      gx = s.ax; gy = s.ay; gz = s.az;
+      lastUs = s.us;
+      primed = true;
+      return;
+    }
+    uint32_t dt = s.us - lastUs;
+    lastUs = s.us;
+    mag += (m - mag) * alpha(dt, GEST_MAG_TAU_US);
+    float a = alpha(dt, GEST_GRAVITY_TAU_US);
+    gx += (s.ax - gx) * a;
+    gy += (s.ay - gy) * a;
+    gz += (s.az - gz) * a;
+    float dx = s.ax - gx, dy = s.ay - gy, dz = s.az - gz;
+    float dyn = sqrtf(dx * dx + dy * dy + dz * dz);
+
+    updateShake(s.us);
+    updateTap(s.us, dyn);
+    updateFlip(s.us);
+    updateTilt(s.us);
+  }
+
+  void updateShake(uint32_t now) {
+    if (!stroke && mag > SHAKE_THRESHOLD) {
+      stroke = true;
+      strokeCounted = false;
+      strokeStartUs = now;
+    } else if (stroke && mag < GEST_SHAKE_OFF) {
+      stroke = false;
+    }
+    if (stroke && strokeCounted) lastShakeUs = now;
+    if (!stroke || strokeCounted || now - strokeStartUs < GEST_SHAKE_MIN_US) return;
+
+    strokeCounted = true;
+    lastShakeUs = now;
+    tapPending = false;  // Strokes swamp the tap detector
+    push(GEST_SHAKE, strokeStartUs, now);
+
+    strokeTimes[strokeIndex] = strokeStartUs;
+    strokeValid[strokeIndex] = true;
+    strokeIndex = (strokeIndex + 1) % SHAKE_COUNT;
+    uint8_t recent = 0;
+    uint32_t first = now;
+    for (uint8_t i = 0; i < SHAKE_COUNT; i++) {
+      if (strokeValid[i] && now - strokeTimes[i] < SHAKE_WINDOW_MS * 1000UL) {
+        recent++;
+        if ((int32_t)(strokeTimes[i] - first) < 0) first = strokeTimes[i];
+      }
+    }
+    if (recent >= SHAKE_COUNT) {
+      push(GEST_SHAKE_N, first, now);
+      memset(strokeValid, 0, sizeof(strokeValid));
+    }
+  }
+
+  void updateTap(uint32_t now, float dyn) {
+    if (tapPending && now - tapEndUs > GEST_DOUBLE_TAP_US) {
+      tapPending = false;
+      push(GEST_TAP, tapStartUs, now);
+    }
+    if (!spike && dyn > GEST_TAP_ON) {
+      spike = true;
+      spikeStartUs = now;
+    } else if (spike && dyn < GEST_TAP_OFF) {
+      spike = false;
+      // Not a tap: too long, or part of (the ringing after) a shake. A hard
+      // tap may start a stroke too; it is dropped if that stroke is counted.
+      if (now - spikeStartUs > GEST_TAP_MAX_US || (stroke && strokeCounted) ||
+          now - lastShakeUs < GEST_DOUBLE_TAP_US) return;
+      if (tapPending) {
+        tapPending = false;
+        push(GEST_DOUBLE_TAP, tapStartUs, now);
+      } else {
+        tapPending = true;
+        tapStartUs = spikeStartUs;
+        tapEndUs = now;
+      }
+    }
+  }
+
+  void updateFlip(uint32_t now) {
+    bool down = faceDown ? gz < GEST_FLIP_Z * 0.5f : gz < GEST_FLIP_Z;
+    if (down == faceDown) {
+      flipPending = false;
+      return;
+    }
+    if (!flipPending) {
+      flipPending = true;
+      flipStartUs = now;
+    }
+    if (now - flipStartUs < GEST_FLIP_HOLD_US) return;
+    faceDown = down;
+    flipPending = false;
+    push(down ? GEST_FACE_DOWN : GEST_FACE_UP, flipStartUs, now);
+  }
+
+  void updateTilt(uint32_t now) {
+    // Dominant horizontal axis, with hysteresis on the one being held
+    int8_t dir = -1;
+    if (!faceDown && gz > 0) {
+      float ax = fabsf(gx), ay = fabsf(gy);
+      float on = (tiltDir >= 0) ? GEST_TILT_OFF : GEST_TILT_ON;
+      if (ax >= ay && ax > on) dir = gx > 0 ? GEST_TILT_RIGHT : GEST_TILT_LEFT;
+      else if (ay > ax && ay > on) dir = gy > 0 ? GEST_TILT_FORWARD : GEST_TILT_BACK;
+    }
+    if (dir != tiltDir) {
+      tiltDir = dir;
+      tiltFired = false;
+      tiltStartUs = now;
+      return;
+    }
+    if (dir < 0 || tiltFired || now - tiltStartUs < GEST_TILT_HOLD_US) return;
+    tiltFired = true;
+    push(dir, tiltStartUs, now);
+  }
+
+  // Run every sample drained since the last call
+  void update(ImuFifo &fifo) {
+    ImuSample s;
+    while (fifo.read(cursor, s)) process(s);
+  }
+};
+
+ImuGestures imuGestures = {};
+
+#endif // IMU_GESTURES_H
@@ -0,0 +1,45 @@
+#ifndef IMU_STREAM_H
+#define IMU_STREAM_H
+
+#include <Arduino.h>
+#include "SensorQMI8658.hpp"
+#include "config.h"
+
+// ============================================================================
+// IMU Stream — channel selection
+// ============================================================================
+// Only channels someone asked for are read: the gyro is left powered down
+// (and off the I2C bus) unless a consumer requires it. Samples themselves
+// go through the FIFO (imu_fifo.h) into the orientation filter
+// (imu_orientation.h).
+// ============================================================================
+
+#define IMU_CH_ACCEL     0x01
+#define IMU_CH_GYRO      0x02
+
+struct ImuStream {
+  uint8_t wanted;          // IMU_CH_* consumers need
+  uint8_t enabled;         // IMU_CH_* currently powered on the chip
+
+  void begin(uint8_t channels) {
+    wanted = channels | IMU_CH_ACCEL;  // Shake/wake always need accel
+    enabled = IMU_CH_ACCEL;
+  }
+
+  void require(uint8_t channels) { wanted = channels | IMU_CH_ACCEL; }
+  bool wants(uint8_t channel) const { return (wanted & channel) != 0; }
+
+  // Power channels up/down on the chip to match what's wanted; true if
+  // anything changed (the FIFO needs setting up again)
+  bool apply(SensorQMI8658 &imu) {
+    if (wanted == enabled) return false;
+    if ((wanted & IMU_CH_GYRO) && !(enabled & IMU_CH_GYRO)) imu.enableGyroscope();
+    if (!(wanted & IMU_CH_GYRO) && (enabled & IMU_CH_GYRO)) imu.disableGyroscope();
+    enabled = wanted;
+    return true;
+  }
+};
+
+ImuStream imuStream = {};
+
+#endif // IMU_STREAM_H
@@ -9,6 +9,7 @@
 #if defined(TOUCH_ENABLED)
 
 #include <Arduino_GFX_Library.h>
+#include "touch_input.h"
 
 // LCD dimensions (must match display_lcd.h)
 #ifndef LCD_WIDTH
@@ -20,17 +21,9 @@
 #define TOUCH_I2C_ADDR 0x15
 #define TOUCH_RST_PIN 21
 
-// CST816T Register addresses
-#define TOUCH_REG_GESTURE 0x01
-#define TOUCH_REG_FINGER_NUM 0x02
-#define TOUCH_REG_XPOS_H 0x03
-#define TOUCH_REG_XPOS_L 0x04
-#define TOUCH_REG_YPOS_H 0x05
-#define TOUCH_REG_YPOS_L 0x06
-
 // Touch timing
-#define TOUCH_COOLDOWN_MS 400
 #define MENU_TIMEOUT_MS 8000  // Hide menu after 8 seconds of no touch
+#define TOUCH_BOOT_MS   50    // CST816T ready after reset
 
 // Full screen menu layout
 #define BTN_WIDTH 110        // Button width (2 per row with gap)
@@ -63,16 +56,9 @@ extern void toggleHiResMode();
 static bool touchInitialized = false;
 static uint8_t touchI2CAddr = TOUCH_I2C_ADDR;
 static unsigned long lastTouchTime = 0;
-static unsigned long lastActionTime = 0;
-static bool waitingForLift = false;
-static unsigned long touchStartTime = 0;
-static bool longPressTriggered = false;
 bool menuVisible = false;  // Not static - accessed from display_lcd.h
 static uint8_t menuPage = 0;
 
-// Long press timing
-#define LONG_PRESS_MS 600
-
 // LCD backlight brightness (0-255)
 static uint8_t lcdBrightness = 200;
 
@@ -101,63 +87,56 @@ const char* paletteNames[] = {
   "Ice", "Blood", "Vaporwave", "DeepForest", "Gold"
 };
 
-// Reset touch controller
+// Reset touch controller and wait for it to boot
 void resetTouch() {
   pinMode(TOUCH_RST_PIN, OUTPUT);
   digitalWrite(TOUCH_RST_PIN, LOW);
   delay(10);
   digitalWrite(TOUCH_RST_PIN, HIGH);
-  delay(50);
+  delay(TOUCH_BOOT_MS);
 }
 
-// Read register from touch controller
-uint8_t touchReadRegister(uint8_t reg) {
-  Wire.beginTransmission(touchI2CAddr);
-  Wire.write(reg);
-  if (Wire.endTransmission(false) != 0) {
-    return 0;
+// Look for the controller at its known addresses (one address-only write each)
+bool probeTouch() {
+  static const uint8_t addresses[] = {0x15, 0x5A, 0x38};
+  for (uint8_t i = 0; i < sizeof(addresses); i++) {
+    if (i2cBus.probe(I2C_DEV_TOUCH, addresses[i])) {
+      touchI2CAddr = addresses[i];
+      return true;
+    }
   }
-  Wire.requestFrom(touchI2CAddr, (uint8_t)1);
-  return Wire.available() ? Wire.read() : 0;
+  return false;
 }
 
 // Initialize touch controller
 bool initTouch() {
   resetTouch();
-  delay(100);
-
-  uint8_t addresses[] = {0x15, 0x5A, 0x38};
-  for (int i = 0; i < 3; i++) {
-    Wire.beginTransmission(addresses[i]);
-    if (Wire.endTransmission() == 0) {
-      touchI2CAddr = addresses[i];
-      touchInitialized = true;
-      DBG("Touch OK at 0x");
-      DBGLN(touchI2CAddr, HEX);
-      return true;
-    }
+  if (probeTouch()) {
+    touchInitialized = true;
+    touchInput.begin(touchI2CAddr, TOUCH_INT_PIN);
+    DBG("Touch OK at 0x");
+    DBGLN(touchI2CAddr, HEX);
+    return true;
   }
 
+  // Try alternate reset pins
   uint8_t rstPins[] = {16, 9, 13};
   for (int p = 0; p < 3; p++) {
     pinMode(rstPins[p], OUTPUT);
     digitalWrite(rstPins[p], LOW);
     delay(10);
     digitalWrite(rstPins[p], HIGH);
-    delay(100);
-
-    for (int i = 0; i < 3; i++) {
-      Wire.beginTransmission(addresses[i]);
-      if (Wire.endTransmission() == 0) {
-        touchI2CAddr = addresses[i];
-        touchInitialized = true;
-        DBG("Touch OK at 0x");
-        DBG(touchI2CAddr, HEX);
-        DBG(" (RST pin ");
-        DBG(rstPins[p]);
-        DBGLN(")");
-        return true;
-      }
+    delay(TOUCH_BOOT_MS);
+
+    if (probeTouch()) {
+      touchInitialized = true;
+      touchInput.begin(touchI2CAddr, TOUCH_INT_PIN);
+      DBG("Touch OK at 0x");
+      DBG(touchI2CAddr, HEX);
+      DBG(" (RST pin ");
+      DBG(rstPins[p]);
+      DBGLN(")");
+      return true;
     }
   }
 
@@ -165,24 +144,6 @@ bool initTouch() {
   return false;
 }
 
-// Read touch coordinates
-bool readTouch(uint16_t &x, uint16_t &y) {
-  if (!touchInitialized) return false;
-
-  uint8_t fingerNum = touchReadRegister(TOUCH_REG_FINGER_NUM);
-  if (fingerNum == 0) return false;
-
-  uint8_t xh = touchReadRegister(TOUCH_REG_XPOS_H);
-  uint8_t xl = touchReadRegister(TOUCH_REG_XPOS_L);
-  uint8_t yh = touchReadRegister(TOUCH_REG_YPOS_H);
-  uint8_t yl = touchReadRegister(TOUCH_REG_YPOS_L);
-
-  x = ((xh & 0x0F) << 8) | xl;
-  y = ((yh & 0x0F) << 8) | yl;
-
-  return true;
-}
-
 // Draw a solid button with centered text
 void drawButton(int16_t x, int16_t y, int16_t w, int16_t h, const char* label, uint16_t bgColor, bool selected = false) {
   gfx->fillRect(x, y, w, h, bgColor);
@@ -238,6 +199,7 @@ void drawMenuHeader() {
 // Draw full-screen menu
 void drawMenu() {
   if (gfx == nullptr) return;
+  botFlushWait();  // Don't race the bot flush task for the panel
 
   gfx->fillScreen(0x0000);
   drawMenuHeader();
@@ -298,9 +260,11 @@ void drawMenu() {
 void hideMenu() {
   if (gfx == nullptr) return;
   DBGLN("Closing menu");
+  botFlushWait();
   gfx->fillScreen(0x0000);
   menuVisible = false;
   menuPage = 0;
+  botInvalidateFrame();
 }
 
 // Action functions
@@ -386,74 +350,54 @@ bool processMenuTouch(uint16_t x, uint16_t y) {
   return false;
 }
 
-// Main touch handler - call in loop()
+// Main touch handler - call in loop(). The I2C bus task reads the controller
+// when it signals a report (touch_input.h); this acts on the queued events.
 void handleTouch() {
   if (!touchInitialized) return;
 
   unsigned long now = millis();
-  uint16_t x, y;
-
-  bool touching = readTouch(x, y);
-
-  // If waiting for finger lift, check if lifted
-  if (waitingForLift) {
-    if (!touching) {
-      waitingForLift = false;
-      touchStartTime = 0;
-      longPressTriggered = false;
-    }
-    return;
-  }
 
-  if (touching) {
+  TouchEvent ev;
+  while (touchInput.pop(ev)) {
     lastTouchTime = now;
 
-    // Menu not visible - check for long press to open
-    if (!menuVisible) {
-      if (touchStartTime == 0) {
-        touchStartTime = now;
-        longPressTriggered = false;
+    // Menu open: each new finger-down presses one button
+    if (menuVisible) {
+      if (ev.type != TOUCH_DOWN) continue;
+      DBG("Touch X=");
+      DBG(ev.x);
+      DBG(" Y=");
+      DBGLN(ev.y);
+      if (processMenuTouch(ev.x, ev.y)) {
+        hideMenu();
+      } else {
+        drawMenu();  // Redraw to update status
       }
+      continue;
+    }
 
-      if (!longPressTriggered && (now - touchStartTime >= LONG_PRESS_MS)) {
+    switch (ev.type) {
+      case TOUCH_LONG_PRESS:
         DBGLN("Long press - opening menu");
-        longPressTriggered = true;
-        lastActionTime = now;
         drawMenu();
-        waitingForLift = true;
-      }
-      return;
-    }
-
-    // Menu is visible - handle button presses
-    if (now - lastActionTime < TOUCH_COOLDOWN_MS) {
-      return;
-    }
-    lastActionTime = now;
-
-    bool shouldClose = processMenuTouch(x, y);
-
-    if (shouldClose) {
-      hideMenu();
-      waitingForLift = true;
-    } else {
-      drawMenu();
-      waitingForLift = true;
-    }
-  } else {
-    // Finger lifted - short tap triggers bot reaction
-    if (touchStartTime > 0 && !longPressTriggered && !menuVisible &&
-        (now - touchStartTime < LONG_PRESS_MS)) {
-      botMode.onTap();
-      DBGLN("Bot tap reaction");
+        break;
+      case TOUCH_TAP:
+        botMode.onTap();
+        botRequestFrame();  // Show the reaction this pass
+        DBG("Bot tap reaction, latency us: ");
+        DBGLN(micros() - ev.us);
+        break;
+      case TOUCH_DOUBLE_TAP:
+        botMode.onDoubleTap();
+        botRequestFrame();
+        break;
+      default:
+        break;
     }
-
-    touchStartTime = 0;
-    longPressTriggered = false;
   }
 
   // Hide menu after timeout
-  if (menuVisible && !touching && lastTouchTime > 0) {
+  if (menuVisible && !touchInput.down && lastTouchTime > 0) {
     if (now - lastTouchTime > MENU_TIMEOUT_MS) {
       hideMenu();
     }
@@ -0,0 +1,212 @@
+#ifndef TOUCH_INPUT_H
+#define TOUCH_INPUT_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include "config.h"
+#include "i2c_bus.h"
+
+// ============================================================================
+// Touch Input — CST816T interrupt, burst reads and gesture events
+// ============================================================================
+// The CST816T pulses its INT line whenever it has a new report (finger down,
+// move, lift) or has recognized a gesture. The ISR only records the time,
+// sets a flag and wakes the I2C bus task (i2c_bus.h), which reads gesture,
+// finger count and coordinates in one 6-byte burst, turns changes into
+// TouchEvents and wakes the loop. Nothing goes on the bus while the screen
+// isn't touched.
+//
+// Down/up edges come from the finger count, so a tap is reported on lift
+// without waiting out the controller's double-tap window. Swipes and double
+// tap come from the controller's own gesture engine; long press is reported
+// after LONG_PRESS_MS of hold (or the controller's long press, whichever is
+// first).
+//
+// Boards without INT wired (TOUCH_INT_PIN < 0) poll every TOUCH_POLL_MS.
+// ============================================================================
+
+#ifndef TOUCH_INT_PIN
+#define TOUCH_INT_PIN -1
+#endif
+
+// CST816T registers
+#define TOUCH_REG_GESTURE       0x01   // Report burst: gesture, fingers, XH, XL, YH, YL
+#define TOUCH_REG_MOTION_MASK   0xEC
+#define TOUCH_REG_IRQ_CTL       0xFA
+
+#define TOUCH_MOTION_DCLICK     0x01   // Enable double-tap gesture
+#define TOUCH_IRQ_TOUCH         0x40   // INT on every report while touched
+#define TOUCH_IRQ_CHANGE        0x20   // INT on finger down/up
+
+// CST816T gesture IDs
+#define TOUCH_GESTURE_SWIPE_UP     0x01
+#define TOUCH_GESTURE_SWIPE_DOWN   0x02
+#define TOUCH_GESTURE_SWIPE_LEFT   0x03
+#define TOUCH_GESTURE_SWIPE_RIGHT  0x04
+#define TOUCH_GESTURE_DOUBLE_TAP   0x0B
+#define TOUCH_GESTURE_LONG_PRESS   0x0C
+
+#define LONG_PRESS_MS           600    // Hold this long to open the menu
+#define TOUCH_TAP_SLOP          30     // Max travel (px) for a tap
+#define TOUCH_POLL_MS           20     // Poll period without INT
+#define TOUCH_HELD_POLL_MS      100    // Safety read while a finger is down
+#define TOUCH_QUEUE_SIZE        8      // Power of two
+
+enum TouchEventType : uint8_t {
+  TOUCH_DOWN = 0,
+  TOUCH_UP,
+  TOUCH_TAP,               // Short touch, lifted without moving
+  TOUCH_LONG_PRESS,
+  TOUCH_DOUBLE_TAP,
+  TOUCH_SWIPE_UP,
+  TOUCH_SWIPE_DOWN,
+  TOUCH_SWIPE_LEFT,
+  TOUCH_SWIPE_RIGHT
+};
+
+struct TouchEvent {
+  uint8_t type;
+  uint16_t x, y;
+  uint32_t us;             // micros() of the interrupt (or poll) that reported it
+};
+
+volatile bool touchPending = false;
+volatile uint32_t touchIrqUs = 0;
+
+void IRAM_ATTR touchISR() {
+  touchPending = true;
+  touchIrqUs = micros();
+  i2cBusWakeFromISR();
+}
+
+struct TouchInput {
+  uint8_t addr;
+  int8_t intPin;           // -1 = polled
+  bool active;
+
+  // Current touch
+  bool down;
+  uint16_t x, y;           // Last reported position
+  uint16_t downX, downY;
+  uint32_t downMs;
+  bool longFired;          // Long press already reported for this touch
+  bool gestured;           // Swipe/double tap reported — no tap on lift
+  uint8_t lastGesture;
+  uint32_t lastReadMs;
+
+  // Event queue (written by service on the bus task, read by pop)
+  TouchEvent queue[TOUCH_QUEUE_SIZE];
+  volatile uint8_t qHead, qTail;
+  uint32_t dropped;
+
+  // Diagnostics
+  uint32_t reads;
+  uint32_t readErrors;
+
+  void begin(uint8_t address, int8_t pin) {
+    addr = address;
+    intPin = pin;
+    i2cBus.writeReg(I2C_DEV_TOUCH, addr, TOUCH_REG_MOTION_MASK, TOUCH_MOTION_DCLICK);
+    i2cBus.writeReg(I2C_DEV_TOUCH, addr, TOUCH_REG_IRQ_CTL, TOUCH_IRQ_TOUCH | TOUCH_IRQ_CHANGE);
+    if (intPin >= 0) {
+      pinMode(intPin, INPUT_PULLUP);
+      attachInterrupt(digitalPinToInterrupt(intPin), touchISR, FALLING);
+    }
+    active = true;
+    DBG("Touch input: "); DBGLN(intPin >= 0 ? "interrupt" : "polled");
+  }
+
+  void push(uint8_t type, uint32_t us) {
+    uint8_t next = (qHead + 1) & (TOUCH_QUEUE_SIZE - 1);
+    if (next == qTail) {
+      dropped++;
+      return;
+    }
+    queue[qHead] = { type, x, y, us };
+    qHead = next;
+  }
+
+  bool pop(TouchEvent &ev) {
+    if (qTail == qHead) return false;
+    ev = queue[qTail];
+    qTail = (qTail + 1) & (TOUCH_QUEUE_SIZE - 1);
+    return true;
+  }
+
+  // Read a report if the controller signalled one (or a poll is due) and
+  // queue whatever changed; true if events were queued. Runs with the bus
+  // held (bus task, or the loop when the task isn't running).
+  bool service() {
+    if (!active) return false;
+    uint32_t now = millis();
+    bool due = touchPending ||
+               (intPin < 0 && now - lastReadMs >= TOUCH_POLL_MS) ||
+               (down && now - lastReadMs >= TOUCH_HELD_POLL_MS);
+    if (!due) return false;
+    uint32_t stamp = touchPending ? touchIrqUs : micros();
+    touchPending = false;
+    lastReadMs = now;
+
+    // Gesture, finger count and both coordinates in one burst
+    uint8_t r[6];
+    if (!i2cBus.readRegs(I2C_DEV_TOUCH, addr, TOUCH_REG_GESTURE, r, sizeof(r))) {
+      readErrors++;  // Controller dozing between touches; the next INT wakes it
+      return false;
+    }
+    uint8_t queuedBefore = qHead;
+    reads++;
+    uint8_t gesture = r[0];
+    bool fingers = (r[1] & 0x0F) != 0;
+
+    if (fingers) {
+      x = ((r[2] & 0x0F) << 8) | r[3];
+      y = ((r[4] & 0x0F) << 8) | r[5];
+      if (!down) {
+        down = true;
+        downX = x;
+        downY = y;
+        downMs = now;
+        longFired = false;
+        gestured = false;
+        push(TOUCH_DOWN, stamp);
+      }
+      if (!longFired && now - downMs >= LONG_PRESS_MS) {
+        longFired = true;
+        push(TOUCH_LONG_PRESS, stamp);
+      }
+    }
+
+    if (gesture != lastGesture) {
+      lastGesture = gesture;
+      switch (gesture) {
+        case TOUCH_GESTURE_SWIPE_UP:    gestured = true; push(TOUCH_SWIPE_UP, stamp); break;
+        case TOUCH_GESTURE_SWIPE_DOWN:  gestured = true; push(TOUCH_SWIPE_DOWN, stamp); break;
+        case TOUCH_GESTURE_SWIPE_LEFT:  gestured = true; push(TOUCH_SWIPE_LEFT, stamp); break;
+        case TOUCH_GESTURE_SWIPE_RIGHT: gestured = true; push(TOUCH_SWIPE_RIGHT, stamp); break;
+        case TOUCH_GESTURE_DOUBLE_TAP:  gestured = true; push(TOUCH_DOUBLE_TAP, stamp); break;
+        case TOUCH_GESTURE_LONG_PRESS:
+          if (!longFired) {
+            longFired = true;
+            push(TOUCH_LONG_PRESS, stamp);
+          }
+          break;
+        default: break;  // 0 = none; single click is taken from the lift
+      }
+    }
+
+    if (!fingers && down) {
+      down = false;
+      push(TOUCH_UP, stamp);
+      uint16_t dx = abs((int16_t)x - (int16_t)downX);
+      uint16_t dy = abs((int16_t)y - (int16_t)downY);
+      if (!longFired && !gestured && dx < TOUCH_TAP_SLOP && dy < TOUCH_TAP_SLOP) {
+        push(TOUCH_TAP, stamp);
+      }
+    }
+    return qHead != queuedBefore;
+  }
+};
+
+TouchInput touchInput = {};
+
+#endif // TOUCH_INPUT_H
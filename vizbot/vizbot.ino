@@ -29,6 +29,10 @@
 #include "palettes.h"
 #include "effects_ambient.h"
 #include "display_lcd.h"
+#include "imu_fifo.h"
+#include "imu_gestures.h"
+#include "imu_orientation.h"
+#include "imu_stream.h"
 #include "bot_mode.h"
 #include "web_server.h"
 #if defined(TOUCH_ENABLED)
@@ -63,8 +67,10 @@ uint8_t paletteShufflePos = 0;
 CRGBPalette16 currentPalette;
 
 // IMU data
-float accelX = 0, accelY = 0, accelZ = 0;
+float accelX = 0, accelY = 0, accelZ = 0;   // Newest sample
 float gyroX = 0, gyroY = 0, gyroZ = 0;
+float accelPeak = 0;                        // Largest |accel| (g) in the last burst
+uint32_t imuCursor = 0;                     // Loop's read position in imuFifo
 
 // Fisher-Yates shuffle
 void shuffleArray(uint8_t* arr, uint8_t size) {
@@ -131,11 +137,43 @@ void introAnimation() {
   showDisplay();
 }
 
+// I2C bus task work (i2c_bus.h): drain the IMU FIFO and read touch reports
+// when their interrupts (or timers) say so. True when touch events were
+// queued, which wakes the loop early.
+bool serviceInputDevices() {
+  imuFifo.service(imu);
+  #if defined(TOUCH_ENABLED)
+    return touchInput.service();
+  #else
+    return false;
+  #endif
+}
+
+// Walk the IMU samples the bus task drained since the last pass: every one
+// feeds the gesture recognizer, the orientation filter and the shake peak,
+// the newest is kept in accel*/gyro*. Channels nobody needs are neither
+// powered nor read.
 void readIMU() {
-  if (imu.getDataReady()) {
-    imu.getAccelerometer(accelX, accelY, accelZ);
-    imu.getGyroscope(gyroX, gyroY, gyroZ);
+  if (imuStream.wanted != imuStream.enabled) {
+    I2cLock bus;  // Only take the bus when a channel actually switches
+    if (imuStream.apply(imu)) imuFifo.restart(imu, imuStream.enabled & IMU_CH_GYRO);
   }
+  i2cBus.poll();
+  imuGestures.update(imuFifo);
+
+  ImuSample s;
+  bool fresh = false;
+  float peak = 0;
+  while (imuFifo.read(imuCursor, s)) {
+    accelX = s.ax; accelY = s.ay; accelZ = s.az;
+    if (imuStream.wants(IMU_CH_GYRO)) {
+      gyroX = s.gx; gyroY = s.gy; gyroZ = s.gz;
+    }
+    imuOrient.feed(s, imuStream.enabled & IMU_CH_GYRO);
+    peak = max(peak, sqrtf(s.ax * s.ax + s.ay * s.ay + s.az * s.az));
+    fresh = true;
+  }
+  if (fresh) accelPeak = peak;  // Held until the next burst
 }
 
 // Start or restart the WiFi AP hotspot
@@ -200,7 +238,7 @@ void setup() {
   startWifiAP();
 
   // Initialize IMU (for shake/motion detection)
-  Wire.begin(I2C_SDA, I2C_SCL);
+  i2cBus.begin(I2C_SDA, I2C_SCL);
 
   if (imu.begin(Wire, QMI8658_L_SLAVE_ADDRESS, I2C_SDA, I2C_SCL)) {
     imu.configAccelerometer(
@@ -210,11 +248,12 @@ void setup() {
     );
     imu.configGyroscope(
       SensorQMI8658::GYR_RANGE_512DPS,
-      SensorQMI8658::GYR_ODR_896_8Hz,
+      SensorQMI8658::GYR_ODR_224_2Hz,   // 6DOF FIFO runs at the gyro ODR
       SensorQMI8658::LPF_MODE_0
     );
     imu.enableAccelerometer();
-    imu.enableGyroscope();
+    imuStream.begin(IMU_CH_ACCEL);  // Gyro stays off until something needs it
+    imuFifo.begin(imu, IMU_INT_PIN, false);
     DBGLN("IMU initialized");
   } else {
     DBGLN("IMU initialization failed");
@@ -232,8 +271,18 @@ void setup() {
   resetEffectShuffle();
   resetPaletteShuffle();
 
+  // Expression pack and sayings live on LittleFS; load them before the
+  // first expression and greeting
+  bool fsMounted = LittleFS.begin(true);
+  if (!fsMounted) DBGLN("LittleFS mount failed - built-in expressions/sayings only");
+  botPack.begin(fsMounted);
+  botSayings.begin(fsMounted);
+
   // Enter bot mode
   enterBotMode();
+
+  // IMU and touch are read off the loop from here on
+  i2cBus.start(serviceInputDevices);
 }
 
 void loop() {
@@ -243,13 +292,11 @@ void loop() {
 
   readIMU();
 
-  // Shake reaction for bot
+  // Gestures recognized in readIMU; any real movement keeps the bot awake
+  GestureEvent gesture;
+  while (imuGestures.pop(gesture)) botHandleGesture(gesture);
   if (botMode.initialized) {
-    float mag = sqrt(accelX * accelX + accelY * accelY + accelZ * accelZ);
-    if (mag > SHAKE_THRESHOLD && !botMode.shakeReacting) {
-      botMode.onShake();
-    }
-    if (mag > 1.3f) {
+    if (accelPeak > 1.3f) {
       botMode.registerInteraction();
     }
   }
@@ -273,5 +320,7 @@ void loop() {
   // Run bot mode (handles its own LCD rendering)
   runBotMode();
 
-  delay(BOT_FRAME_DELAY_MS);
+  // Sleep until the next frame/event, polling input at least every 50ms;
+  // a touch wakes the loop early
+  inputDelay(botFrameDelayMs());
 }
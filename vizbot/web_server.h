@@ -32,6 +32,12 @@ const char webpage[] PROGMEM = R"rawliteral(
   <div class="card">
     <h2>Expressions</h2>
     <div class="grid" id="botExpressions"></div>
+    <h2 style="margin-top:15px">Expression Pack</h2>
+    <div style="display:flex;gap:8px">
+      <input type="file" id="packFile" accept=".bxp" style="flex:1;color:#fff;font-size:12px">
+      <button onclick="uploadPack()" style="padding:10px 16px">Upload</button>
+    </div>
+    <div class="status" id="packStatus"></div>
   </div>
 
   <div class="card">
@@ -40,6 +46,7 @@ const char webpage[] PROGMEM = R"rawliteral(
       <input type="text" id="botSayInput" placeholder="Type a message..."
         style="flex:1;padding:10px;border-radius:8px;border:none;background:rgba(255,255,255,0.15);color:#fff;font-size:14px" maxlength="30">
       <button onclick="sendBotSay()" style="padding:10px 16px">Say</button>
+      <button onclick="keepBotSay()" style="padding:10px 16px" title="Add to idle sayings">Keep</button>
     </div>
   </div>
 
@@ -87,6 +94,36 @@ const char webpage[] PROGMEM = R"rawliteral(
     }
 
     function setBotExpr(i) { api('/bot/expression?v=' + i); }
+    async function loadPack() {
+      try {
+        const info = await (await fetch('/bot/pack')).json();
+        botExprNames.length = info.builtIn;
+        for (let i = 0; i < info.count; i += 32) {
+          const names = await (await fetch('/bot/pack/names?from=' + i)).json();
+          names.forEach(n => botExprNames.push(n));
+        }
+        document.getElementById('packStatus').textContent = info.count ? info.count + ' pack expressions' : '';
+        render();
+      } catch(e) {}
+    }
+    async function uploadPack() {
+      const file = document.getElementById('packFile').files[0];
+      if (!file) return;
+      const body = new FormData();
+      body.append('pack', file, file.name);
+      try {
+        const r = await fetch('/bot/pack', { method: 'POST', body });
+        document.getElementById('packStatus').textContent = r.ok ? 'Pack loaded' : 'Invalid pack';
+      } catch(e) {}
+      loadPack();
+    }
+    function keepBotSay() {
+      const input = document.getElementById('botSayInput');
+      if (input.value.trim()) {
+        api('/bot/sayings/add?cat=idle&text=' + encodeURIComponent(input.value.trim()));
+        input.value = '';
+      }
+    }
     function sendBotSay() {
       const input = document.getElementById('botSayInput');
       if (input.value.trim()) {
@@ -119,6 +156,7 @@ const char webpage[] PROGMEM = R"rawliteral(
 
     getState();
     render();
+    loadPack();
   </script>
 </body>
 </html>
@@ -147,7 +185,7 @@ void handleBrightness() {
 // Bot mode handlers
 void handleBotExpression() {
   if (server.hasArg("v")) {
-    uint8_t expr = constrain(server.arg("v").toInt(), 0, BOT_NUM_EXPRESSIONS - 1);
+    uint16_t expr = constrain(server.arg("v").toInt(), 0, botExpressionCount() - 1);
     setBotExpression(expr);
   }
   server.send(200, "text/plain", "OK");
@@ -189,6 +227,141 @@ void handleBotBackground() {
   server.send(200, "text/plain", "OK");
 }
 
+// Append a quoted JSON string (quotes, backslashes and control chars dropped)
+void appendJsonString(String &json, const char* text) {
+  json += "\"";
+  for (const char* c = text; *c; c++) {
+    if (*c != '"' && *c != '\\' && *c >= ' ') json += *c;
+  }
+  json += "\"";
+}
+
+// Expression pack: GET = info (?clear=1 removes it), POST = upload
+void handleBotPack() {
+  if (server.hasArg("clear")) {
+    botPack.clear();
+  }
+  String json = "{\"builtIn\":" + String(BOT_NUM_EXPRESSIONS) +
+                ",\"count\":" + String(botPack.count) +
+                ",\"reads\":" + String(botPack.reads) + "}";
+  server.send(200, "application/json", json);
+}
+
+// Streamed to flash chunk by chunk — the pack never sits in RAM
+void handleBotPackUpload() {
+  HTTPUpload &up = server.upload();
+  if (up.status == UPLOAD_FILE_START) {
+    botPack.uploadStart();
+  } else if (up.status == UPLOAD_FILE_WRITE) {
+    botPack.uploadWrite(up.buf, up.currentSize);
+  } else if (up.status == UPLOAD_FILE_END) {
+    botPack.uploadEnd();
+  } else if (up.status == UPLOAD_FILE_ABORTED) {
+    botPack.uploadAbort();
+  }
+}
+
+void handleBotPackDone() {
+  if (botPack.uploadFailed) {
+    server.send(400, "text/plain", "Invalid pack");
+  } else {
+    server.send(200, "text/plain", "OK");
+  }
+}
+
+// Sayings store: counts per category, or ?cat=name lists that category
+void handleBotSayings() {
+  String json;
+  if (server.hasArg("cat")) {
+    String name = server.arg("cat");
+    int8_t cat = BotSayingsStore::categoryByName(name.c_str(), name.length());
+    json = "[";
+    for (uint16_t i = 0; cat >= 0 && i < botSayings.categoryCount(cat); i++) {
+      if (i > 0) json += ",";
+      appendJsonString(json, botSayings.get(cat, i));
+    }
+    json += "]";
+  } else {
+    json = "{\"count\":" + String(botSayings.count()) +
+           ",\"poolUsed\":" + String(botSayings.poolUsed) +
+           ",\"poolBytes\":" + String(BOT_SAY_POOL_BYTES) + ",\"categories\":{";
+    for (uint8_t c = 0; c < SAY_CATEGORY_COUNT; c++) {
+      if (c > 0) json += ",";
+      json += "\"" + String(sayCategoryNames[c]) + "\":" + String(botSayings.categoryCount(c));
+    }
+    json += "}}";
+  }
+  server.send(200, "application/json", json);
+}
+
+// POST a phrase set in the "[category]" text format; appends, or with
+// ?replace=1 replaces the categories it names. Persisted to flash.
+void handleBotSayingsLoad() {
+  bool replace = server.hasArg("replace") && server.arg("replace").toInt() == 1;
+  uint16_t added = botSayings.loadText(server.arg("plain").c_str(), replace);
+  bool saved = botSayings.save();
+  server.send(200, "application/json", "{\"added\":" + String(added) +
+              ",\"count\":" + String(botSayings.count()) +
+              ",\"saved\":" + (saved ? "true" : "false") + "}");
+}
+
+// Add one phrase: ?cat=name&text=...
+void handleBotSayingsAdd() {
+  String name = server.arg("cat");
+  String text = server.arg("text");
+  int8_t cat = BotSayingsStore::categoryByName(name.c_str(), name.length());
+  uint8_t len = text.length() > BOT_SAY_MAX_LEN ? BOT_SAY_MAX_LEN : text.length();
+  if (cat < 0 || !botSayings.add(cat, text.c_str(), len)) {
+    server.send(400, "text/plain", "Unknown category, empty text or store full");
+    return;
+  }
+  botSayings.save();
+  server.send(200, "text/plain", "OK");
+}
+
+// Back to the built-in phrases
+void handleBotSayingsReset() {
+  botSayings.resetDefaults();
+  botSayings.save();
+  server.send(200, "text/plain", "OK");
+}
+
+// One page of pack expression names (JSON array), ?from=N
+void handleBotPackNames() {
+  uint16_t from = server.hasArg("from") ? server.arg("from").toInt() : 0;
+  String json = "[";
+  char name[BOT_PACK_NAME_LEN + 1];
+  for (uint16_t i = from; i < botPack.count && i < from + BOT_PACK_NAMES_PAGE; i++) {
+    if (!botPack.name(i, name, sizeof(name))) break;
+    if (i > from) json += ",";
+    appendJsonString(json, name);
+  }
+  json += "]";
+  server.send(200, "application/json", json);
+}
+
+// Render diagnostics (sprite cache, display list usage, I2C bus time in the
+// current report window)
+void handleBotStats() {
+  String json = "{\"spriteHitRate\":" + String(botSprites.hitRate()) +
+                ",\"spriteHits\":" + String(botSprites.hits) +
+                ",\"spriteMisses\":" + String(botSprites.misses) +
+                ",\"spriteEvictions\":" + String(botSprites.evictions) +
+                ",\"spriteBypasses\":" + String(botSprites.bypasses) +
+                ",\"spriteEntries\":" + String(botSprites.count) +
+                ",\"spriteBytes\":" + String(botSprites.used) +
+                ",\"dlPeakOps\":" + String(botDL.peakCount) +
+                ",\"dlDropped\":" + String(botDL.dropped) +
+                ",\"i2cImuUs\":" + String(i2cBus.stats[I2C_DEV_IMU].busUs) +
+                ",\"i2cImuTx\":" + String(i2cBus.stats[I2C_DEV_IMU].transactions) +
+                ",\"i2cTouchUs\":" + String(i2cBus.stats[I2C_DEV_TOUCH].busUs) +
+                ",\"i2cTouchTx\":" + String(i2cBus.stats[I2C_DEV_TOUCH].transactions) +
+                ",\"i2cErrors\":" + String(i2cBus.stats[I2C_DEV_IMU].errors +
+                                            i2cBus.stats[I2C_DEV_TOUCH].errors) +
+                ",\"i2cWindowMs\":" + String(millis() - i2cBus.lastReport) + "}";
+  server.send(200, "application/json", json);
+}
+
 void setupWebServer() {
   server.on("/", handleRoot);
   server.on("/state", handleState);
@@ -199,6 +372,14 @@ void setupWebServer() {
   server.on("/bot/say", handleBotSay);
   server.on("/bot/time", handleBotTime);
   server.on("/bot/background", handleBotBackground);
+  server.on("/bot/stats", handleBotStats);
+  server.on("/bot/pack", HTTP_GET, handleBotPack);
+  server.on("/bot/pack", HTTP_POST, handleBotPackDone, handleBotPackUpload);
+  server.on("/bot/pack/names", handleBotPackNames);
+  server.on("/bot/sayings", HTTP_GET, handleBotSayings);
+  server.on("/bot/sayings", HTTP_POST, handleBotSayingsLoad);
+  server.on("/bot/sayings/add", handleBotSayingsAdd);
+  server.on("/bot/sayings/reset", handleBotSayingsReset);
 
   server.begin();
 }
@@ -0,0 +1,163 @@
+#ifndef APP_TASKS_H
+#define APP_TASKS_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include "config.h"
+
+// ============================================================================
+// App Tasks — web server on core 0, rendering on core 1
+// ============================================================================
+// loop() (core 1) owns rendering and all render state: mode, effect,
+// palette, emoji queue, bot. The web server runs in its own task on core 0
+// next to WiFi and the I2C bus task, so a slow client or a page load never
+// holds up a frame, and requests are served while a frame is rendering.
+//
+// The two sides talk two ways:
+//  - Changes: a handler wraps anything that touches render state in
+//    onRenderThread([&] { ... }). The call goes through a queue that the
+//    loop drains at the top of each frame (and while it waits between
+//    frames); the handler blocks until it has run, so it can capture
+//    locals by reference and send its reply afterwards. The slow part of
+//    a request — the network I/O — stays on core 0.
+//  - Reads: once a frame, the loop publishes an AppSnapshot into one of
+//    two buffers and flips them; /state copies the front one without
+//    waiting on the renderer.
+//
+// Before start() (and on the render thread itself) calls run directly.
+// ============================================================================
+
+#define NET_TASK_CORE       0
+#define NET_TASK_PRIORITY   1       // Below the I2C bus and bot flush tasks
+#define NET_TASK_STACK      6144    // JSON building in handlers
+#define NET_TASK_IDLE_MS    2       // Between handleClient() polls
+#define RENDER_CALL_QUEUE   4
+
+struct RenderCall {
+  void (*fn)(void *);
+  void *ctx;
+  TaskHandle_t caller;     // Notified once fn has run
+};
+
+// What the web UI reads about the running state
+struct AppSnapshot {
+  uint8_t mode;
+  uint8_t effect;
+  uint8_t palette;
+  uint8_t brightness;
+  uint8_t speed;
+  bool autoCycle;
+  uint32_t frame;
+  uint16_t frameMs;        // Target frame period
+  uint32_t missedFrames;   // Frame deadlines missed since boot
+};
+
+struct AppTasks {
+  QueueHandle_t calls;
+  TaskHandle_t renderTask;
+  TaskHandle_t netTask;
+  void (*netWork)();       // One pass of network servicing
+  bool started;
+
+  // Double-buffered snapshot: the loop writes the back one and flips
+  AppSnapshot snaps[2];
+  volatile uint8_t front;
+  volatile uint32_t published;
+
+  // Diagnostics
+  uint32_t callsRun;
+  uint32_t maxCallWaitUs;  // Longest a handler waited for the render thread
+
+  // Call from setup() on the render thread
+  void begin() {
+    calls = xQueueCreate(RENDER_CALL_QUEUE, sizeof(RenderCall));
+    renderTask = xTaskGetCurrentTaskHandle();
+  }
+
+  static void netTaskFn(void *arg) {
+    AppTasks *self = (AppTasks *)arg;
+    for (;;) {
+      self->netWork();
+      vTaskDelay(pdMS_TO_TICKS(NET_TASK_IDLE_MS));
+    }
+  }
+
+  // Move network servicing onto core 0 (call at the end of setup)
+  void start(void (*work)()) {
+    netWork = work;
+    if (started || calls == nullptr) return;
+    started = xTaskCreatePinnedToCore(netTaskFn, "net", NET_TASK_STACK, this,
+                                      NET_TASK_PRIORITY, &netTask, NET_TASK_CORE) == pdPASS;
+    if (!started) DBGLN("Net task failed - serving from loop");
+  }
+
+  // Loop-side fallback when the net task isn't running
+  void poll() {
+    if (!started && netWork) netWork();
+  }
+
+  bool onRenderTask() const {
+    return !started || xTaskGetCurrentTaskHandle() == renderTask;
+  }
+
+  // Run fn(ctx) on the render thread and wait for it
+  void run(void (*fn)(void *), void *ctx) {
+    if (onRenderTask()) {
+      fn(ctx);
+      return;
+    }
+    uint32_t t0 = micros();
+    RenderCall call = { fn, ctx, xTaskGetCurrentTaskHandle() };
+    xQueueSend(calls, &call, portMAX_DELAY);
+    xTaskNotifyGive(renderTask);  // Cut a frame wait short
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    uint32_t waited = micros() - t0;
+    if (waited > maxCallWaitUs) maxCallWaitUs = waited;
+  }
+
+  // Render thread: run whatever the web side queued
+  void service() {
+    if (calls == nullptr) return;
+    RenderCall call;
+    while (xQueueReceive(calls, &call, 0) == pdTRUE) {
+      call.fn(call.ctx);
+      callsRun++;
+      xTaskNotifyGive(call.caller);
+    }
+  }
+
+  // Render thread, once per frame
+  void publish(const AppSnapshot &s) {
+    uint8_t back = front ^ 1;
+    snaps[back] = s;
+    __sync_synchronize();
+    front = back;
+    published = published + 1;
+  }
+
+  // Any thread: a consistent copy of the last published frame's state
+  AppSnapshot snapshot() const {
+    AppSnapshot s;
+    uint32_t seen;
+    do {
+      seen = published;
+      __sync_synchronize();
+      s = snaps[front];
+      __sync_synchronize();
+    } while (seen != published);  // A publish landed mid-copy: take the new one
+    return s;
+  }
+};
+
+AppTasks appTasks = {};
+
+// Run a lambda on the render thread (blocking); captures by reference are
+// safe because the caller waits
+template <typename F>
+void onRenderThread(F fn) {
+  appTasks.run([](void *p) { (*(F *)p)(); }, &fn);
+}
+
+#endif // APP_TASKS_H
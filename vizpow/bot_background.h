@@ -0,0 +1,241 @@
+#ifndef BOT_BACKGROUND_H
+#define BOT_BACKGROUND_H
+
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include "config.h"
+#include "bot_display_list.h"
+#include "bot_eyes.h"
+#include "effects_ambient.h"
+
+// ============================================================================
+// Bot Background — retained background layer with its own update rate
+// ============================================================================
+// The background is recorded into botDL like the rest of the frame, but the
+// recorded ops are kept and replayed on frames where the background isn't
+// due. Static styles (solid, gradient) are computed once per style change;
+// animated ones tick at their own rate underneath the 30 FPS face.
+//
+// Hi-res ambient (canvas builds only) paints pixels instead of ops, so it
+// gets its own canvas that is refreshed at the ambient rate and copied
+// under each frame.
+// ============================================================================
+
+#define BOT_BG_MAX_OPS       80    // Fill + 8x8 LED grid, or 70 gradient bands
+#define BOT_BG_BREATH_FPS    10
+#define BOT_BG_STARS_FPS     15
+#define BOT_BG_AMBIENT_FPS   12
+#define BOT_BG_STEP_MS       33    // One face frame (BOT_FRAME_DELAY_MS)
+#define BOT_BG_MAX_CATCHUP   4     // LED effect steps per update (keeps speed)
+
+uint8_t botBackgroundStyle = 0;  // 0=solid black, 1=subtle gradient, 2=breathing, 3=starfield, 4=ambient
+
+// External references for ambient background
+extern uint8_t effectIndex;
+extern bool hiResMode;
+
+// Update interval per style; 0 = static (recorded once)
+uint16_t botBackgroundIntervalMs(uint8_t style) {
+  switch (style) {
+    case 2:  return 1000 / BOT_BG_BREATH_FPS;
+    case 3:  return 1000 / BOT_BG_STARS_FPS;
+    case 4:  return 1000 / BOT_BG_AMBIENT_FPS;
+    default: return 0;
+  }
+}
+
+// Record ambient effect as blocky LED grid (one step per elapsed face frame)
+void recordBotAmbientLeds(uint8_t steps) {
+  uint8_t idx = effectIndex % NUM_AMBIENT_EFFECTS;
+  for (uint8_t i = 0; i < steps; i++) ambientLedFuncs[idx]();
+
+  botDL.fillScreen(BOT_COLOR_BG);  // Grid doesn't cover full screen
+  for (uint8_t y = 0; y < MATRIX_HEIGHT; y++) {
+    for (uint8_t x = 0; x < MATRIX_WIDTH; x++) {
+      uint16_t c565 = crgbToRgb565(leds[XY(x, y)]);
+      int16_t screenX = GRID_OFFSET_X + x * (PIXEL_SIZE + PIXEL_GAP);
+      int16_t screenY = GRID_OFFSET_Y + y * (PIXEL_SIZE + PIXEL_GAP);
+      botDL.fillRect(screenX, screenY, PIXEL_SIZE, PIXEL_SIZE, c565);
+    }
+  }
+}
+
+// Record background ops for `style`; returns the face erase color
+uint16_t recordBotBackground(uint8_t style, uint8_t steps) {
+  uint16_t bgColor = BOT_COLOR_BG;
+
+  if (style == 1) {
+    // Subtle gradient
+    for (int16_t y = 0; y < LCD_HEIGHT; y += 4) {
+      uint8_t b = (uint8_t)((1.0f - (float)y / LCD_HEIGHT) * 12);
+      uint16_t c = ((b >> 3) << 11) | ((b >> 2) << 5) | (b >> 1);
+      botDL.fillRect(0, y, LCD_WIDTH, 4, c);
+    }
+  } else if (style == 2) {
+    // Breathing
+    float breathT = (float)(millis() % 6000) / 6000.0f;
+    uint8_t intensity = (uint8_t)(sinf(breathT * TWO_PI) * 4.0f + 4.0f);
+    bgColor = ((intensity >> 3) << 11) | ((intensity >> 2) << 5) | (intensity >> 1);
+    botDL.fillScreen(bgColor);
+  } else if (style == 3) {
+    // Starfield on black
+    botDL.fillScreen(BOT_COLOR_BG);
+    for (int i = 0; i < 8; i++) {
+      int16_t sx = (i * 31 + 17) % LCD_WIDTH;
+      int16_t sy = (i * 47 + 11) % LCD_HEIGHT;
+      float twinkle = sinf((float)(millis() + i * 500) / 1500.0f);
+      if (twinkle > 0.3f) {
+        uint8_t bright = (uint8_t)(twinkle * 8);
+        uint16_t starColor = ((bright >> 3) << 11) | ((bright >> 2) << 5) | (bright >> 3);
+        botDL.fillRect(sx, sy, 2, 2, starColor);
+      }
+    }
+  } else if (style == 4) {
+    // Ambient effect as background — face renders on top
+    recordBotAmbientLeds(steps);
+    bgColor = 0x0000;
+  } else {
+    // Solid black
+    botDL.fillScreen(BOT_COLOR_BG);
+  }
+  return bgColor;
+}
+
+#if defined(HIRES_ENABLED) && !defined(BOT_BAND_RENDER)
+// Hi-res ambient draws through gfx into this canvas; nullptr until first use
+static Arduino_Canvas *botBgCanvas = nullptr;
+static bool botBgCanvasFailed = false;
+
+// Refresh the hi-res background if due and copy it into `frame`. Falls back
+// to painting `frame` directly every frame if the extra canvas won't fit.
+void renderBotHiResBackground(Arduino_Canvas *frame, bool due) {
+  uint8_t idx = effectIndex % NUM_AMBIENT_EFFECTS;
+  if (botBgCanvas == nullptr && !botBgCanvasFailed) {
+    botBgCanvas = new Arduino_Canvas(LCD_WIDTH, LCD_HEIGHT, frame);
+    if (!botBgCanvas->begin() || botBgCanvas->getFramebuffer() == nullptr) {
+      DBGLN("Bot background canvas failed - hi-res ambient at face rate");
+      delete botBgCanvas;
+      botBgCanvas = nullptr;
+      botBgCanvasFailed = true;
+    }
+    due = true;
+  }
+
+  Arduino_GFX *saved = gfx;
+  if (botBgCanvas == nullptr) {
+    gfx = frame;
+    ambientHiResFuncs[idx]();
+  } else {
+    if (due) {
+      gfx = botBgCanvas;
+      ambientHiResFuncs[idx]();
+    }
+    memcpy(frame->getFramebuffer(), botBgCanvas->getFramebuffer(),
+           LCD_WIDTH * LCD_HEIGHT * sizeof(uint16_t));
+  }
+  gfx = saved;
+}
+#endif
+
+struct BotBackgroundLayer {
+  BotDLOp ops[BOT_BG_MAX_OPS];
+  uint8_t count;
+  bool hasClear;
+  uint16_t clearColor;
+  uint16_t eraseColor;       // Face erase color returned by the style
+  uint8_t style;
+  bool hiRes;
+  bool valid;
+  unsigned long lastUpdate;
+
+  // Bumped whenever hi-res pixels change (not visible in the list hash)
+  uint32_t pixelVersion;
+
+  // Diagnostics (reset by report)
+  uint16_t updates, replays;
+
+  void invalidate() { valid = false; }
+
+  bool due(uint8_t newStyle, bool newHiRes, unsigned long now) const {
+    if (!valid || newStyle != style || newHiRes != hiRes) return true;
+    uint16_t interval = botBackgroundIntervalMs(style);
+    return interval > 0 && now - lastUpdate >= interval;
+  }
+
+  // Record (when due) or replay the background into a freshly cleared
+  // botDL. `frame` is the canvas being rendered (canvas builds), used by
+  // hi-res ambient. Returns the face erase color.
+  uint16_t render(Arduino_GFX *frame) {
+    unsigned long now = millis();
+    bool useHiRes = false;
+    #if defined(HIRES_ENABLED) && !defined(BOT_BAND_RENDER)
+    useHiRes = botBackgroundStyle == 4 && hiResMode;
+    #endif
+    bool refresh = due(botBackgroundStyle, useHiRes, now);
+
+    #if defined(HIRES_ENABLED) && !defined(BOT_BAND_RENDER)
+    if (useHiRes) {
+      // Pixels come from the background canvas; the list draws on top
+      renderBotHiResBackground((Arduino_Canvas *)frame, refresh);
+      if (refresh) {
+        markUpdated(now, 0x0000, true);
+        pixelVersion++;
+      } else {
+        replays++;
+      }
+      count = 0;
+      return 0x0000;
+    }
+    #else
+    (void)frame;
+    #endif
+
+    if (!refresh) {
+      memcpy(botDL.ops, ops, count * sizeof(BotDLOp));
+      botDL.count = count;
+      botDL.hasClear = hasClear;
+      botDL.clearColor = clearColor;
+      replays++;
+      return eraseColor;
+    }
+
+    // LED effects step once per elapsed face frame so they keep their speed
+    uint8_t steps = 1;
+    if (valid && style == botBackgroundStyle && lastUpdate != 0) {
+      steps = constrain((now - lastUpdate) / BOT_BG_STEP_MS, 1, BOT_BG_MAX_CATCHUP);
+    }
+
+    uint16_t first = botDL.count;
+    uint16_t erase = recordBotBackground(botBackgroundStyle, steps);
+    uint16_t n = botDL.count - first;
+    markUpdated(now, erase, false);
+    if (first != 0 || n > BOT_BG_MAX_OPS || botDL.poolUsed != 0) {
+      valid = false;   // Not replayable — record again next frame
+      return erase;
+    }
+    memcpy(ops, botDL.ops, n * sizeof(BotDLOp));
+    count = n;
+    hasClear = botDL.hasClear;
+    clearColor = botDL.clearColor;
+    return erase;
+  }
+
+  void markUpdated(unsigned long now, uint16_t erase, bool isHiRes) {
+    style = botBackgroundStyle;
+    hiRes = isHiRes;
+    eraseColor = erase;
+    lastUpdate = now;
+    valid = true;
+    updates++;
+  }
+
+  void report() {
+    DBG("bot background updates "); DBG(updates);
+    DBG(" replays "); DBGLN(replays);
+    updates = replays = 0;
+  }
+};
+
+BotBackgroundLayer botBackground = {};
+
+#endif // BOT_BACKGROUND_H
@@ -0,0 +1,209 @@
+#ifndef BOT_EXPR_PACK_H
+#define BOT_EXPR_PACK_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "config.h"
+#include "bot_faces.h"
+
+// ============================================================================
+// Bot Expression Packs — extra expressions paged from flash
+// ============================================================================
+// Built-in expressions stay in PROGMEM as indices 0..BOT_NUM_EXPRESSIONS-1.
+// An uploaded pack extends the index space: pack record i is expression
+// BOT_NUM_EXPRESSIONS + i. Records are fixed size, so a transition seeks
+// straight to the one record it needs — the pack is never loaded into RAM,
+// and RAM use is the same for 1 or 1000 expressions.
+//
+// File layout (little-endian, see scripts/make-expr-pack.js):
+//   header   "BXP1", uint8 version, uint8 recordSize, uint16 count
+//   records  count x BotPackRecord (pose + NUL-padded name)
+//
+// Uploads go to a temp file and replace the pack only once validated, so a
+// failed upload leaves the old pack in place.
+// ============================================================================
+
+#define BOT_PACK_PATH       "/botpack.bxp"
+#define BOT_PACK_TMP_PATH   "/botpack.tmp"
+#define BOT_PACK_VERSION    1
+#define BOT_PACK_NAME_LEN   16
+#define BOT_PACK_MAX        1000   // Keeps every index inside uint16_t
+#define BOT_PACK_NAMES_PAGE 32     // Names per /bot/pack/names request
+
+struct __attribute__((packed)) BotPackHeader {
+  char magic[4];           // "BXP1"
+  uint8_t version;
+  uint8_t recordSize;      // sizeof(BotPackRecord), guards against layout drift
+  uint16_t count;
+};
+
+// On-flash pose: BotExpression with fixed-width enums and no padding
+struct __attribute__((packed)) BotPackRecord {
+  int16_t eyeWhiteW, eyeWhiteH, eyeSpacing;
+  int16_t pupilRadius, pupilOffsetX, pupilOffsetY;
+  int16_t browOffsetY, browLength, browThickness;
+  int8_t  browAngleL, browAngleR;
+  uint8_t browVisible;
+  uint8_t mouthType;
+  int16_t mouthWidth, mouthOffsetY, mouthCurve;
+  uint8_t eyeMode;
+  uint8_t reserved;
+  uint16_t transitionMs;
+  char name[BOT_PACK_NAME_LEN];
+};
+
+static_assert(sizeof(BotPackHeader) == 8, "BotPackHeader layout");
+static_assert(sizeof(BotPackRecord) == 48, "BotPackRecord layout");
+
+struct BotExpressionPack {
+  File file;               // Kept open; records are read in place
+  uint16_t count;          // Records in the mounted pack (0 = none)
+  bool mounted;            // LittleFS is available
+  File upload;             // Temp file while an upload is in progress
+  bool uploadFailed;
+
+  // Diagnostics
+  uint32_t reads;
+
+  void begin(bool fsMounted) {
+    mounted = fsMounted;
+    open();
+  }
+
+  // Check a pack's header against the file size; returns its record count
+  static int32_t validate(File &f) {
+    BotPackHeader h;
+    if (!f || f.read((uint8_t *)&h, sizeof(h)) != sizeof(h)) return -1;
+    if (memcmp(h.magic, "BXP1", 4) != 0 || h.version != BOT_PACK_VERSION ||
+        h.recordSize != sizeof(BotPackRecord) || h.count > BOT_PACK_MAX) {
+      return -1;
+    }
+    if (f.size() < sizeof(BotPackHeader) + (size_t)h.count * sizeof(BotPackRecord)) return -1;
+    return h.count;
+  }
+
+  void close() {
+    if (file) file.close();
+    count = 0;
+  }
+
+  bool open() {
+    close();
+    if (!mounted) return false;
+    file = LittleFS.open(BOT_PACK_PATH, FILE_READ);
+    if (!file) return false;
+    int32_t n = validate(file);
+    if (n < 0) {
+      DBGLN("Expression pack invalid - ignored");
+      close();
+      return false;
+    }
+    count = (uint16_t)n;
+    DBG("Expression pack: "); DBG(count); DBGLN(" expressions");
+    return true;
+  }
+
+  // Read record i (0-based within the pack)
+  bool read(uint16_t i, BotPackRecord &rec) {
+    if (i >= count) return false;
+    if (!file.seek(sizeof(BotPackHeader) + (uint32_t)i * sizeof(BotPackRecord))) return false;
+    reads++;
+    return file.read((uint8_t *)&rec, sizeof(rec)) == sizeof(rec);
+  }
+
+  // Copy record i's name into buf (always NUL-terminated)
+  bool name(uint16_t i, char *buf, size_t bufSize) {
+    BotPackRecord rec;
+    if (bufSize == 0 || !read(i, rec)) return false;
+    size_t n = min(bufSize - 1, (size_t)BOT_PACK_NAME_LEN);
+    memcpy(buf, rec.name, n);
+    buf[n] = '\0';
+    return true;
+  }
+
+  // ---- Upload (fed chunk by chunk from the HTTP handler) ----
+
+  void uploadStart() {
+    uploadFailed = !mounted;
+    if (uploadFailed) return;
+    upload = LittleFS.open(BOT_PACK_TMP_PATH, FILE_WRITE);
+    uploadFailed = !upload;
+  }
+
+  void uploadWrite(const uint8_t *data, size_t len) {
+    if (uploadFailed) return;
+    if (upload.write(data, len) != len) uploadFailed = true;
+  }
+
+  // Validate the temp file and swap it in; false leaves the old pack
+  bool uploadEnd() {
+    if (upload) upload.close();
+    if (!uploadFailed) {
+      File f = LittleFS.open(BOT_PACK_TMP_PATH, FILE_READ);
+      uploadFailed = validate(f) < 0;
+      f.close();
+    }
+    if (uploadFailed) {
+      LittleFS.remove(BOT_PACK_TMP_PATH);
+      return false;
+    }
+    close();
+    LittleFS.remove(BOT_PACK_PATH);
+    LittleFS.rename(BOT_PACK_TMP_PATH, BOT_PACK_PATH);
+    uploadFailed = !open();
+    return !uploadFailed;
+  }
+
+  void uploadAbort() {
+    if (upload) upload.close();
+    if (mounted) LittleFS.remove(BOT_PACK_TMP_PATH);
+    uploadFailed = true;
+  }
+
+  void clear() {
+    close();
+    if (mounted) LittleFS.remove(BOT_PACK_PATH);
+  }
+};
+
+BotExpressionPack botPack = {};
+
+// Built-in plus pack expressions
+uint16_t botExpressionCount() {
+  return BOT_NUM_EXPRESSIONS + botPack.count;
+}
+
+// Load expression `index` from PROGMEM or the pack. Pack values are
+// range-checked since they come from an upload; an unreadable record
+// loads neutral.
+void botReadExpression(uint16_t index, BotExpression &out) {
+  if (index < BOT_NUM_EXPRESSIONS) {
+    memcpy_P(&out, &botExpressions[index], sizeof(BotExpression));
+    return;
+  }
+  BotPackRecord r;
+  if (!botPack.read(index - BOT_NUM_EXPRESSIONS, r)) {
+    memcpy_P(&out, &botExpressions[EXPR_NEUTRAL], sizeof(BotExpression));
+    return;
+  }
+  out.eyeWhiteW = constrain(r.eyeWhiteW, 0, 120);
+  out.eyeWhiteH = constrain(r.eyeWhiteH, 0, 140);
+  out.eyeSpacing = constrain(r.eyeSpacing, -120, 120);
+  out.pupilRadius = constrain(r.pupilRadius, 0, 60);
+  out.pupilOffsetX = constrain(r.pupilOffsetX, -60, 60);
+  out.pupilOffsetY = constrain(r.pupilOffsetY, -60, 60);
+  out.browOffsetY = constrain(r.browOffsetY, -100, 100);
+  out.browLength = constrain(r.browLength, 0, 120);
+  out.browThickness = constrain(r.browThickness, 1, 30);
+  out.browAngleL = constrain(r.browAngleL, -90, 90);
+  out.browAngleR = constrain(r.browAngleR, -90, 90);
+  out.browVisible = r.browVisible != 0;
+  out.mouthType = (BotMouthType)(r.mouthType <= MOUTH_SMIRK ? r.mouthType : (uint8_t)MOUTH_NONE);
+  out.mouthWidth = constrain(r.mouthWidth, 0, 120);
+  out.mouthOffsetY = constrain(r.mouthOffsetY, -140, 160);
+  out.mouthCurve = constrain(r.mouthCurve, -60, 60);
+  out.eyeMode = (BotEyeMode)(r.eyeMode <= EYE_CLOSED ? r.eyeMode : (uint8_t)EYE_NORMAL);
+  out.transitionMs = r.transitionMs;
+}
+
+#endif // BOT_EXPR_PACK_H
@@ -0,0 +1,724 @@
+#ifndef BOT_EYES_H
+#define BOT_EYES_H
+
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include "config.h"
+#include "bot_faces.h"
+#include "bot_display_list.h"
+#include "bot_sprites.h"
+
+// ============================================================================
+// Bot Eye Animation & Rendering Engine
+// ============================================================================
+// Handles all procedural eye drawing, blink timing, idle look-around,
+// IMU pupil tracking, and special eye modes (hearts, spirals, X-eyes, etc.)
+// Drawing is recorded into botDL (bot_display_list.h) and rasterized later.
+//
+// Art direction: Large white ellipses on black. Pupils are black circles
+// that "cut into" the white. Brows are thick arcs/bars above eyes.
+// Maximum 4 colors on screen. Bold, simple, high contrast.
+// ============================================================================
+
+// External IMU data from vizpow.ino
+extern float accelX, accelY, accelZ;
+
+// Colors (RGB565)
+#define BOT_COLOR_BG      0x0000  // Black background
+#define BOT_COLOR_WHITE   0xFFFF  // Eye whites (default)
+#define BOT_COLOR_PUPIL   0x0000  // Pupils (same as BG — cuts into white)
+#define BOT_COLOR_ACCENT  0x07FF  // Cyan accent (for effects)
+
+// Configurable face color (can be changed via palette)
+uint16_t botFaceColor = BOT_COLOR_WHITE;
+
+// Stroke thickness for face outline on ambient backgrounds
+#define BOT_STROKE_PX 5
+
+// External background style (from bot_mode.h) — used for stroke rendering
+extern uint8_t botBackgroundStyle;
+
+// ============================================================================
+// Blink System
+// ============================================================================
+
+// Blink timing is driven by the scheduler (EV_BLINK in bot_mode.h): the
+// event starts a blink, update() animates it and reports when it's over.
+
+struct BotBlinkState {
+  uint64_t blinkStartTime;
+  bool blinking;
+  bool doubleBlink;
+  uint8_t doubleBlinkPhase;   // 0 = first blink, 1 = gap, 2 = second blink
+
+  // Blink timing
+  static const uint16_t BLINK_DURATION = 150;      // ms for one blink
+  static const uint16_t DOUBLE_BLINK_GAP = 100;    // ms between double blinks
+  static const uint16_t BLINK_MIN_INTERVAL = 3000;  // Min time between blinks
+  static const uint16_t BLINK_MAX_INTERVAL = 7000;  // Max time between blinks
+
+  void init() {
+    blinking = false;
+    doubleBlink = false;
+    doubleBlinkPhase = 0;
+  }
+
+  // Delay until the next blink
+  uint32_t nextInterval() const {
+    return random(BLINK_MIN_INTERVAL, BLINK_MAX_INTERVAL);
+  }
+
+  void start(uint64_t now) {
+    blinking = true;
+    blinkStartTime = now;
+    doubleBlink = (random(100) < 15);  // 15% chance of double blink
+    doubleBlinkPhase = 0;
+  }
+
+  // Returns blink amount 0.0 (open) to 1.0 (closed); clears `blinking`
+  // once the blink is over
+  float update(uint64_t now) {
+    if (!blinking) return 0.0f;
+
+    uint32_t elapsed = (uint32_t)(now - blinkStartTime);
+
+    if (!doubleBlink) {
+      // Single blink: triangle wave over BLINK_DURATION
+      if (elapsed >= BLINK_DURATION) {
+        blinking = false;
+        return 0.0f;
+      }
+      float half = BLINK_DURATION / 2.0f;
+      float t = elapsed / half;
+      return (t < 1.0f) ? t : (2.0f - t);
+    }
+
+    // Double blink
+    uint16_t totalFirst = BLINK_DURATION;
+    uint16_t gapEnd = totalFirst + DOUBLE_BLINK_GAP;
+    uint16_t totalAll = gapEnd + BLINK_DURATION;
+
+    if (elapsed >= totalAll) {
+      blinking = false;
+      return 0.0f;
+    }
+
+    if (elapsed < totalFirst) {
+      float half = BLINK_DURATION / 2.0f;
+      float t = elapsed / half;
+      return (t < 1.0f) ? t : (2.0f - t);
+    }
+
+    if (elapsed < gapEnd) {
+      return 0.0f;  // Gap between blinks
+    }
+
+    // Second blink
+    float e2 = elapsed - gapEnd;
+    float half = BLINK_DURATION / 2.0f;
+    float t = e2 / half;
+    return (t < 1.0f) ? t : (2.0f - t);
+  }
+};
+
+// ============================================================================
+// Idle Look-Around System
+// ============================================================================
+// Like blinks, moves are started by a scheduler event (EV_LOOK); update()
+// animates the move in progress and reports when it has landed.
+
+struct BotLookAround {
+  int16_t currentX, currentY;
+  int16_t targetX, targetY;
+  uint64_t moveStartTime;
+  uint16_t moveDuration;
+  bool moving;
+
+  static const uint16_t LOOK_MIN_INTERVAL = 800;
+  static const uint16_t LOOK_MAX_INTERVAL = 2500;
+  static const int16_t LOOK_MAX_OFFSET = 20;       // Max pixel offset
+  static const uint16_t MOVE_DURATION_MIN = 200;
+  static const uint16_t MOVE_DURATION_MAX = 500;
+
+  void init() {
+    currentX = currentY = 0;
+    targetX = targetY = 0;
+    moveDuration = 400;
+    moving = false;
+  }
+
+  // Delay before the first look (short) and between looks
+  uint32_t firstInterval() const { return random(1000, 3000); }
+  uint32_t nextInterval() const { return random(LOOK_MIN_INTERVAL, LOOK_MAX_INTERVAL); }
+
+  // Start a new look
+  void start(uint64_t now) {
+    targetX = random(-LOOK_MAX_OFFSET, LOOK_MAX_OFFSET + 1);
+    targetY = random(-LOOK_MAX_OFFSET / 2, LOOK_MAX_OFFSET / 2 + 1);
+
+    // 15% chance to return to center
+    if (random(100) < 15) {
+      targetX = 0;
+      targetY = 0;
+    }
+
+    moveDuration = random(MOVE_DURATION_MIN, MOVE_DURATION_MAX);
+    moveStartTime = now;
+    moving = true;
+  }
+
+  // Animate the current move; clears `moving` once it lands
+  void update(uint64_t now, int16_t &outX, int16_t &outY) {
+    if (moving) {
+      uint32_t elapsed = (uint32_t)(now - moveStartTime);
+      if (elapsed >= moveDuration) {
+        // Move complete
+        currentX = targetX;
+        currentY = targetY;
+        moving = false;
+      } else {
+        // Ease-in-out interpolation
+        float t = (float)elapsed / moveDuration;
+        t = t * t * (3.0f - 2.0f * t);  // Smoothstep
+        currentX = (int16_t)(currentX + (targetX - currentX) * t);
+        currentY = (int16_t)(currentY + (targetY - currentY) * t);
+      }
+    }
+
+    outX = currentX;
+    outY = currentY;
+  }
+};
+
+// ============================================================================
+// IMU Pupil Tracking
+// ============================================================================
+
+// Maps the up vector from imuOrient (imu_orientation.h) to pupil offsets.
+// Filtering happens upstream; this adds a small hysteresis so sensor noise
+// around a pixel boundary doesn't make the pupils shimmer.
+
+struct BotIMUTracker {
+  int16_t offsetX, offsetY;  // Current output
+  bool moving;               // Output changed on the last update
+  static constexpr float TILT_SCALE = 35.0f;      // Pixels per g of tilt (high = sensitive)
+  static constexpr float MAX_OFFSET = 24.0f;      // Max pupil offset from IMU
+  static constexpr float DEADBAND = 0.75f;        // Pixels of hysteresis
+
+  void init() {
+    offsetX = 0;
+    offsetY = 0;
+    moving = false;
+  }
+
+  void update(float tiltX, float tiltY, int16_t &outX, int16_t &outY) {
+    // Map accelerometer tilt to pupil offset
+    // Neutral position is standing upright (90 degrees), so subtract 1g from
+    // the vertical axis to zero out gravity when the device faces the user
+    float rawX = constrain(-tiltY * TILT_SCALE, -MAX_OFFSET, MAX_OFFSET);
+    float rawY = constrain((tiltX - 1.0f) * TILT_SCALE, -MAX_OFFSET, MAX_OFFSET);
+
+    int16_t x = offsetX, y = offsetY;
+    if (fabsf(rawX - offsetX) > DEADBAND) x = (int16_t)lroundf(rawX);
+    if (fabsf(rawY - offsetY) > DEADBAND) y = (int16_t)lroundf(rawY);
+    moving = (x != offsetX || y != offsetY);
+    offsetX = x;
+    offsetY = y;
+
+    outX = offsetX;
+    outY = offsetY;
+  }
+};
+
+// ============================================================================
+// Eye Rendering Functions
+// ============================================================================
+
+// Draw a thick line (brow) from angle — one parallelogram primitive
+void drawThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t thickness, uint16_t color) {
+  botDL.drawThickLine(x0, y0, x1, y1, thickness, color);
+}
+
+// Draw a filled heart shape at given center and size
+void drawHeart(int16_t cx, int16_t cy, int16_t size, uint16_t color) {
+  // Heart from two circles and a triangle
+  int16_t r = size * 5 / 12;
+  int16_t offsetX = size / 3;
+
+  // Two bumps at top
+  botDL.fillCircle(cx - offsetX, cy - r / 3, r, color);
+  botDL.fillCircle(cx + offsetX, cy - r / 3, r, color);
+
+  // Triangle pointing down
+  botDL.fillTriangle(
+    cx - size + 2, cy,
+    cx + size - 2, cy,
+    cx, cy + size,
+    color
+  );
+}
+
+// Draw a 4-point star at given center and size
+void drawStar(int16_t cx, int16_t cy, int16_t outerR, int16_t innerR, uint16_t color) {
+  // Draw a simple 4-point star using filled triangles
+  // Top point
+  botDL.fillTriangle(cx, cy - outerR, cx - innerR, cy, cx + innerR, cy, color);
+  // Bottom point
+  botDL.fillTriangle(cx, cy + outerR, cx - innerR, cy, cx + innerR, cy, color);
+  // Left point
+  botDL.fillTriangle(cx - outerR, cy, cx, cy - innerR, cx, cy + innerR, color);
+  // Right point
+  botDL.fillTriangle(cx + outerR, cy, cx, cy - innerR, cx, cy + innerR, color);
+}
+
+// Draw spiral inside an eye (for dizzy state)
+void drawSpiral(int16_t cx, int16_t cy, int16_t radius, uint16_t color, float phase) {
+  float maxAngle = 3.0f * PI;  // ~1.5 turns
+  int steps = 40;
+  for (int i = 0; i < steps; i++) {
+    float t = (float)i / steps;
+    float angle = t * maxAngle + phase;
+    float r = t * radius;
+    int16_t x = cx + (int16_t)(cosf(angle) * r);
+    int16_t y = cy + (int16_t)(sinf(angle) * r);
+    botDL.fillCircle(x, y, 2, color);
+  }
+}
+
+// Draw an X across an eye area
+void drawXEye(int16_t cx, int16_t cy, int16_t size, uint16_t color) {
+  int16_t half = size / 2;
+  int16_t thickness = 5;
+  drawThickLine(cx - half, cy - half, cx + half, cy + half, thickness, color);
+  drawThickLine(cx - half, cy + half, cx + half, cy - half, thickness, color);
+}
+
+// Draw happy-squint eye: full-size ellipse with a curved-up arc through the middle
+void drawCaretEye(int16_t cx, int16_t cy, int16_t eyeW, int16_t eyeH, uint16_t faceColor, uint16_t bgColor) {
+  // Draw full white ellipse
+  botDL.fillEllipse(cx, cy, eyeW, eyeH, faceColor);
+  // Draw upward-curving arc through the middle (like a happy closed eye)
+  int8_t arc[2 * 60 + 1];
+  int16_t halfW = eyeW - 4;
+  int16_t n = min((int16_t)(2 * halfW + 1), (int16_t)sizeof(arc));
+  for (int16_t i = 0; i < n; i++) {
+    float t = (float)(i - halfW) / halfW;
+    arc[i] = -(int8_t)(eyeH * 0.35f * (1.0f - t * t));  // Upward parabola
+  }
+  botDL.fillCurve(cx - halfW, cy, arc, n, 2, bgColor);
+}
+
+// ============================================================================
+// Cached eye sprites
+// ============================================================================
+// Special eye shapes go through botSprites (bot_sprites.h): built from the
+// primitives above once per parameter set, then blitted as one RLE op.
+
+enum BotEyeSprite : uint8_t {
+  SPR_HEART = 1,   // a = size
+  SPR_STAR,        // a = outer radius, b = inner radius
+  SPR_SPIRAL,      // a = radius, b = phase bucket
+  SPR_X,           // a = size
+  SPR_CARET        // a = eye half-width, b = eye half-height
+};
+
+#define BOT_SPIRAL_PHASES 24  // Spiral rotation steps per turn (one cached mask each)
+
+// Builder for botSprites: ink 1 = shape, ink 2 = stroke halo / caret cut
+void buildEyeSprite(uint32_t key, int16_t cx, int16_t cy, const uint16_t *inks, void *) {
+  uint16_t ink1 = inks[0], ink2 = inks[1];
+  uint8_t kind = key >> 28;
+  uint8_t stroke = (key >> 24) & 0x0F;
+  uint8_t a = key >> 16;
+  uint8_t b = key >> 8;
+
+  switch (kind) {
+    case SPR_HEART:
+      if (stroke) drawHeart(cx, cy, a + stroke, ink2);
+      drawHeart(cx, cy, a, ink1);
+      break;
+    case SPR_STAR:
+      if (stroke) drawStar(cx, cy, a + stroke, b + stroke, ink2);
+      drawStar(cx, cy, a, b, ink1);
+      break;
+    case SPR_SPIRAL:
+      drawSpiral(cx, cy, a, ink1, b * TWO_PI / BOT_SPIRAL_PHASES);
+      break;
+    case SPR_X:
+      if (stroke) drawXEye(cx, cy, a + stroke, ink2);
+      drawXEye(cx, cy, a, ink1);
+      break;
+    case SPR_CARET:
+      drawCaretEye(cx, cy, a, b, ink1, ink2);
+      break;
+  }
+}
+
+void drawEyeSprite(uint8_t kind, uint8_t stroke, int16_t a, int16_t b,
+                   int16_t cx, int16_t cy, uint16_t ink1, uint16_t ink2) {
+  uint32_t key = botSpriteKey(kind, stroke, constrain(a, 0, 255), constrain(b, 0, 255));
+  uint16_t inks[3] = { ink1, ink2, 0 };
+  botSprites.draw(key, cx, cy, inks, buildEyeSprite);
+}
+
+// Draw closed eye: full-size ellipse with a flat horizontal line through the middle
+void drawClosedEye(int16_t cx, int16_t cy, int16_t eyeW, int16_t eyeH, uint16_t faceColor, uint16_t bgColor) {
+  // Draw full white ellipse
+  botDL.fillEllipse(cx, cy, eyeW, eyeH, faceColor);
+  // Draw horizontal line through center
+  int16_t lineHalfW = eyeW - 4;
+  drawThickLine(cx - lineHalfW, cy, cx + lineHalfW, cy, 5, bgColor);
+}
+
+// ============================================================================
+// Previous-frame tracking for flicker-free rendering
+// ============================================================================
+// Instead of clearing the whole face region each frame (which causes flicker),
+// we track where things were drawn last frame and erase only those specific
+// small areas before redrawing in the new position.
+
+struct BotPrevFrame {
+  // Previous eye bounds (for clearing when eye mode/size changes)
+  int16_t eyeW, eyeH;
+  BotEyeMode eyeMode;
+
+  // Previous pupil positions (absolute screen coords)
+  int16_t leftPupilX, leftPupilY;
+  int16_t rightPupilX, rightPupilY;
+  int16_t pupilRadius;
+
+  // Previous brow endpoints (for targeted clear)
+  int16_t browLx0, browLy0, browLx1, browLy1;
+  int16_t browRx0, browRy0, browRx1, browRy1;
+  int16_t browThickness;
+  bool browWasVisible;
+
+  // Previous mouth bounds
+  int16_t mouthTop, mouthBot, mouthLeft, mouthRight;
+  BotMouthType mouthType;
+
+  bool valid;  // false on first frame
+
+  void invalidate() { valid = false; }
+};
+
+static BotPrevFrame prevFrame = {};  // valid = false until the first frame
+
+// Erase a thick line from previous frame by overwriting with background
+void erasePrevThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t thickness, uint16_t bgColor) {
+  // Clear a bounding rect around the line — simpler and faster than redrawing
+  int16_t minX = min(x0, x1) - thickness / 2 - 1;
+  int16_t maxX = max(x0, x1) + thickness / 2 + 1;
+  int16_t minY = min(y0, y1) - thickness / 2 - 1;
+  int16_t maxY = max(y0, y1) + thickness / 2 + 1;
+  botDL.fillRect(minX, minY, maxX - minX + 1, maxY - minY + 1, bgColor);
+}
+
+// ============================================================================
+// Main Eye Render Function — flicker-free
+// ============================================================================
+
+// Render the complete face based on current BotFaceState
+void renderBotFace(BotFaceState &face, uint16_t bgColor) {
+  int16_t cx = BOT_FACE_CX;
+  int16_t cy = BOT_FACE_CY;
+
+  // Calculate final pupil positions (expression + dynamic + look)
+  int16_t finalPupilX = face.pupilOffsetX + face.dynamicPupilX;
+  int16_t finalPupilY = face.pupilOffsetY + face.dynamicPupilY;
+
+  // Eye centers
+  int16_t leftEyeCX = cx - face.eyeSpacing;
+  int16_t rightEyeCX = cx + face.eyeSpacing;
+  int16_t eyeCY = cy;
+
+  // Apply blink: reduce eye height
+  int16_t effectiveEyeH = face.eyeWhiteH;
+  if (face.blinkAmount > 0.01f) {
+    effectiveEyeH = (int16_t)(face.eyeWhiteH * (1.0f - face.blinkAmount));
+    if (effectiveEyeH < 2) effectiveEyeH = 2;
+  }
+
+  // ---- Erase previous frame's elements that moved/changed ----
+  if (prevFrame.valid) {
+    // If eye mode changed or eyes shrank, clear old eye areas
+    if (prevFrame.eyeMode != face.eyeMode ||
+        prevFrame.eyeW > face.eyeWhiteW + 2 ||
+        prevFrame.eyeH > effectiveEyeH + 2) {
+      // Clear old eye bounding boxes
+      botDL.fillRect(leftEyeCX - prevFrame.eyeW - 2, eyeCY - prevFrame.eyeH - 2,
+                     prevFrame.eyeW * 2 + 4, prevFrame.eyeH * 2 + 4, bgColor);
+      botDL.fillRect(rightEyeCX - prevFrame.eyeW - 2, eyeCY - prevFrame.eyeH - 2,
+                     prevFrame.eyeW * 2 + 4, prevFrame.eyeH * 2 + 4, bgColor);
+    }
+
+    // Erase old brows if they were visible
+    if (prevFrame.browWasVisible) {
+      erasePrevThickLine(prevFrame.browLx0, prevFrame.browLy0,
+                         prevFrame.browLx1, prevFrame.browLy1,
+                         prevFrame.browThickness, bgColor);
+      erasePrevThickLine(prevFrame.browRx0, prevFrame.browRy0,
+                         prevFrame.browRx1, prevFrame.browRy1,
+                         prevFrame.browThickness, bgColor);
+    }
+
+    // Erase old mouth area
+    if (prevFrame.mouthType != MOUTH_NONE) {
+      botDL.fillRect(prevFrame.mouthLeft - 1, prevFrame.mouthTop - 1,
+                     prevFrame.mouthRight - prevFrame.mouthLeft + 2,
+                     prevFrame.mouthBot - prevFrame.mouthTop + 2, bgColor);
+    }
+  }
+
+  // ---- Black stroke behind face elements (only on ambient background) ----
+  bool drawStroke = (botBackgroundStyle == 4);
+  // Sprites and arc mouths paint their outline halo in the same op as the fill
+  uint8_t stroke = drawStroke ? BOT_STROKE_PX : 0;
+
+  // ---- Draw eyes ----
+  // Eye whites are drawn every frame — they naturally cover old pupils
+  switch (face.eyeMode) {
+    case EYE_NORMAL: {
+      // Black stroke outlines (drawn first, slightly larger)
+      if (drawStroke) {
+        botDL.fillEllipse(leftEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, effectiveEyeH + BOT_STROKE_PX, BOT_COLOR_BG);
+        botDL.fillEllipse(rightEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, effectiveEyeH + BOT_STROKE_PX, BOT_COLOR_BG);
+      }
+      // Large white ellipses
+      botDL.fillEllipse(leftEyeCX, eyeCY, face.eyeWhiteW, effectiveEyeH, botFaceColor);
+      botDL.fillEllipse(rightEyeCX, eyeCY, face.eyeWhiteW, effectiveEyeH, botFaceColor);
+
+      // Pupils (only if eyes are reasonably open)
+      if (effectiveEyeH > 8) {
+        int16_t maxPupilX = face.eyeWhiteW - face.pupilRadius - 4;
+        int16_t maxPupilY = effectiveEyeH - face.pupilRadius - 4;
+        int16_t pX = constrain(finalPupilX, -maxPupilX, maxPupilX);
+        int16_t pY = constrain(finalPupilY, -maxPupilY, maxPupilY);
+
+        botDL.fillCircle(leftEyeCX + pX, eyeCY + pY, face.pupilRadius, BOT_COLOR_PUPIL);
+        botDL.fillCircle(rightEyeCX + pX, eyeCY + pY, face.pupilRadius, BOT_COLOR_PUPIL);
+
+        // Track pupil positions
+        prevFrame.leftPupilX = leftEyeCX + pX;
+        prevFrame.leftPupilY = eyeCY + pY;
+        prevFrame.rightPupilX = rightEyeCX + pX;
+        prevFrame.rightPupilY = eyeCY + pY;
+        prevFrame.pupilRadius = face.pupilRadius;
+      }
+      break;
+    }
+
+    case EYE_CARET: {
+      if (drawStroke) {
+        botDL.fillEllipse(leftEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, face.eyeWhiteH + BOT_STROKE_PX, BOT_COLOR_BG);
+        botDL.fillEllipse(rightEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, face.eyeWhiteH + BOT_STROKE_PX, BOT_COLOR_BG);
+      }
+      drawEyeSprite(SPR_CARET, 0, face.eyeWhiteW, face.eyeWhiteH, leftEyeCX, eyeCY, botFaceColor, bgColor);
+      drawEyeSprite(SPR_CARET, 0, face.eyeWhiteW, face.eyeWhiteH, rightEyeCX, eyeCY, botFaceColor, bgColor);
+      break;
+    }
+
+    case EYE_HEART: {
+      int16_t heartSize = min(face.eyeWhiteW, face.eyeWhiteH) * 3 / 4;
+      drawEyeSprite(SPR_HEART, stroke, heartSize, 0, leftEyeCX, eyeCY, botFaceColor, BOT_COLOR_BG);
+      drawEyeSprite(SPR_HEART, stroke, heartSize, 0, rightEyeCX, eyeCY, botFaceColor, BOT_COLOR_BG);
+      break;
+    }
+
+    case EYE_X: {
+      int16_t xSize = min(face.eyeWhiteW, face.eyeWhiteH) * 2 / 3;
+      drawEyeSprite(SPR_X, stroke, xSize, 0, leftEyeCX, eyeCY, botFaceColor, BOT_COLOR_BG);
+      drawEyeSprite(SPR_X, stroke, xSize, 0, rightEyeCX, eyeCY, botFaceColor, BOT_COLOR_BG);
+      break;
+    }
+
+    case EYE_SPIRAL: {
+      if (drawStroke) {
+        botDL.fillEllipse(leftEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, effectiveEyeH + BOT_STROKE_PX, BOT_COLOR_BG);
+        botDL.fillEllipse(rightEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, effectiveEyeH + BOT_STROKE_PX, BOT_COLOR_BG);
+      }
+      botDL.fillEllipse(leftEyeCX, eyeCY, face.eyeWhiteW, effectiveEyeH, botFaceColor);
+      botDL.fillEllipse(rightEyeCX, eyeCY, face.eyeWhiteW, effectiveEyeH, botFaceColor);
+      // Right eye spins the other way: phase -p is bucket N - b
+      uint8_t bucket = (millis() % 2000) * BOT_SPIRAL_PHASES / 2000;
+      int16_t spiralR = min(face.eyeWhiteW, effectiveEyeH) - 6;
+      drawEyeSprite(SPR_SPIRAL, 0, spiralR, bucket, leftEyeCX, eyeCY, BOT_COLOR_PUPIL, 0);
+      drawEyeSprite(SPR_SPIRAL, 0, spiralR, (BOT_SPIRAL_PHASES - bucket) % BOT_SPIRAL_PHASES,
+                    rightEyeCX, eyeCY, BOT_COLOR_PUPIL, 0);
+      break;
+    }
+
+    case EYE_STAR: {
+      int16_t starOuter = min(face.eyeWhiteW, face.eyeWhiteH) * 3 / 4;
+      int16_t starInner = starOuter * 2 / 5;
+      drawEyeSprite(SPR_STAR, stroke, starOuter, starInner, leftEyeCX, eyeCY, botFaceColor, BOT_COLOR_BG);
+      drawEyeSprite(SPR_STAR, stroke, starOuter, starInner, rightEyeCX, eyeCY, botFaceColor, BOT_COLOR_BG);
+      break;
+    }
+
+    case EYE_CLOSED: {
+      if (drawStroke) {
+        botDL.fillEllipse(leftEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, face.eyeWhiteH + BOT_STROKE_PX, BOT_COLOR_BG);
+        botDL.fillEllipse(rightEyeCX, eyeCY, face.eyeWhiteW + BOT_STROKE_PX, face.eyeWhiteH + BOT_STROKE_PX, BOT_COLOR_BG);
+      }
+      drawClosedEye(leftEyeCX, eyeCY, face.eyeWhiteW, face.eyeWhiteH, botFaceColor, bgColor);
+      drawClosedEye(rightEyeCX, eyeCY, face.eyeWhiteW, face.eyeWhiteH, botFaceColor, bgColor);
+      break;
+    }
+  }
+
+  // Track eye state for next frame
+  prevFrame.eyeW = face.eyeWhiteW;
+  prevFrame.eyeH = effectiveEyeH;
+  prevFrame.eyeMode = face.eyeMode;
+
+  // ---- Eyebrows ----
+  if (face.browVisible && face.blinkAmount < 0.8f) {
+    int16_t browY = eyeCY - effectiveEyeH + face.browOffsetY;
+
+    float radL = face.browAngleL * PI / 180.0f;
+    int16_t lbx0 = leftEyeCX - face.browLength;
+    int16_t lbx1 = leftEyeCX + face.browLength;
+    int16_t lby0 = browY + (int16_t)(sinf(-radL) * face.browLength);
+    int16_t lby1 = browY + (int16_t)(sinf(radL) * face.browLength);
+    if (drawStroke) {
+      drawThickLine(lbx0, lby0, lbx1, lby1, face.browThickness + BOT_STROKE_PX * 2, BOT_COLOR_BG);
+    }
+    drawThickLine(lbx0, lby0, lbx1, lby1, face.browThickness, botFaceColor);
+
+    float radR = face.browAngleR * PI / 180.0f;
+    int16_t rbx0 = rightEyeCX - face.browLength;
+    int16_t rbx1 = rightEyeCX + face.browLength;
+    int16_t rby0 = browY + (int16_t)(sinf(radR) * face.browLength);
+    int16_t rby1 = browY + (int16_t)(sinf(-radR) * face.browLength);
+    if (drawStroke) {
+      drawThickLine(rbx0, rby0, rbx1, rby1, face.browThickness + BOT_STROKE_PX * 2, BOT_COLOR_BG);
+    }
+    drawThickLine(rbx0, rby0, rbx1, rby1, face.browThickness, botFaceColor);
+
+    // Track brow positions
+    prevFrame.browLx0 = lbx0; prevFrame.browLy0 = lby0;
+    prevFrame.browLx1 = lbx1; prevFrame.browLy1 = lby1;
+    prevFrame.browRx0 = rbx0; prevFrame.browRy0 = rby0;
+    prevFrame.browRx1 = rbx1; prevFrame.browRy1 = rby1;
+    prevFrame.browThickness = face.browThickness;
+    prevFrame.browWasVisible = true;
+  } else {
+    prevFrame.browWasVisible = false;
+  }
+
+  // ---- Mouth ----
+  int16_t mouthCX = cx;
+  int16_t mouthCY = cy + face.mouthOffsetY;
+
+  // Track mouth bounds as we draw
+  int16_t mTop = mouthCY, mBot = mouthCY, mLeft = mouthCX, mRight = mouthCX;
+
+  // Talking: an open ellipse flaps in place of the expression's mouth
+  BotMouthType mouthType = face.mouthType;
+  if (face.talkOpen > 0 && mouthType != MOUTH_NONE) {
+    int16_t rx = max((int16_t)6, (int16_t)(face.mouthWidth / 2));
+    int16_t ry = face.talkOpen;
+    if (drawStroke) {
+      botDL.fillEllipse(mouthCX, mouthCY, rx + BOT_STROKE_PX, ry + BOT_STROKE_PX, BOT_COLOR_BG);
+    }
+    botDL.fillEllipse(mouthCX, mouthCY, rx, ry, botFaceColor);
+    if (ry > 3) botDL.fillEllipse(mouthCX, mouthCY, rx - 3, ry - 3, BOT_COLOR_BG);
+    mLeft = mouthCX - rx - 1; mRight = mouthCX + rx + 1;
+    mTop = mouthCY - ry - 1; mBot = mouthCY + ry + 1;
+    mouthType = MOUTH_NONE;
+  }
+
+  switch (mouthType) {
+    case MOUTH_NONE:
+      break;
+
+    case MOUTH_LINE: {
+      if (drawStroke) {
+        drawThickLine(mouthCX - face.mouthWidth, mouthCY,
+                       mouthCX + face.mouthWidth, mouthCY, 3 + BOT_STROKE_PX * 2, BOT_COLOR_BG);
+      }
+      drawThickLine(mouthCX - face.mouthWidth, mouthCY,
+                     mouthCX + face.mouthWidth, mouthCY, 3, botFaceColor);
+      mLeft = mouthCX - face.mouthWidth; mRight = mouthCX + face.mouthWidth;
+      mTop = mouthCY - 2; mBot = mouthCY + 2;
+      break;
+    }
+
+    case MOUTH_SMILE: {
+      botDL.fillArc(mouthCX * 2, mouthCY, face.mouthCurve * 16, face.mouthWidth * 2,
+                    mouthCX - face.mouthWidth, mouthCX + face.mouthWidth,
+                    2, botFaceColor, stroke, BOT_COLOR_BG);
+      mLeft = mouthCX - face.mouthWidth - 2; mRight = mouthCX + face.mouthWidth + 2;
+      mTop = mouthCY - 2; mBot = mouthCY + face.mouthCurve + 2;
+      break;
+    }
+
+    case MOUTH_FROWN: {
+      botDL.fillArc(mouthCX * 2, mouthCY, -face.mouthCurve * 16, face.mouthWidth * 2,
+                    mouthCX - face.mouthWidth, mouthCX + face.mouthWidth,
+                    2, botFaceColor, stroke, BOT_COLOR_BG);
+      mLeft = mouthCX - face.mouthWidth - 2; mRight = mouthCX + face.mouthWidth + 2;
+      mTop = mouthCY - face.mouthCurve - 2; mBot = mouthCY + 2;
+      break;
+    }
+
+    case MOUTH_OPEN_O: {
+      if (drawStroke) {
+        botDL.fillCircle(mouthCX, mouthCY, face.mouthCurve + BOT_STROKE_PX, BOT_COLOR_BG);
+      }
+      botDL.fillCircle(mouthCX, mouthCY, face.mouthCurve, botFaceColor);
+      botDL.fillCircle(mouthCX, mouthCY, face.mouthCurve - 3, BOT_COLOR_BG);
+      mLeft = mouthCX - face.mouthCurve - 1; mRight = mouthCX + face.mouthCurve + 1;
+      mTop = mouthCY - face.mouthCurve - 1; mBot = mouthCY + face.mouthCurve + 1;
+      break;
+    }
+
+    case MOUTH_GRIN: {
+      botDL.fillArc(mouthCX * 2, mouthCY, face.mouthCurve * 16, face.mouthWidth * 2,
+                    mouthCX - face.mouthWidth, mouthCX + face.mouthWidth,
+                    2, botFaceColor, stroke, BOT_COLOR_BG);
+      drawThickLine(mouthCX - face.mouthWidth + 4, mouthCY + 2,
+                     mouthCX + face.mouthWidth - 4, mouthCY + 2, 2, BOT_COLOR_BG);
+      mLeft = mouthCX - face.mouthWidth - 2; mRight = mouthCX + face.mouthWidth + 2;
+      mTop = mouthCY - 2; mBot = mouthCY + face.mouthCurve + 2;
+      break;
+    }
+
+    case MOUTH_WAVY: {
+      int8_t wave[2 * 60 + 1];
+      int16_t n = min((int16_t)(2 * face.mouthWidth + 1), (int16_t)sizeof(wave));
+      for (int16_t i = 0; i < n; i++) {
+        float t = (float)(i - face.mouthWidth) / face.mouthWidth;
+        wave[i] = (int8_t)(sinf(t * PI * 3.0f) * face.mouthCurve);
+      }
+      botDL.fillCurve(mouthCX - face.mouthWidth, mouthCY, wave, n,
+                      2, botFaceColor, stroke, BOT_COLOR_BG);
+      mLeft = mouthCX - face.mouthWidth - 2; mRight = mouthCX + face.mouthWidth + 2;
+      mTop = mouthCY - face.mouthCurve - 2; mBot = mouthCY + face.mouthCurve + 2;
+      break;
+    }
+
+    case MOUTH_SMIRK: {
+      // Right half of a parabola whose vertex sits at the left corner
+      botDL.fillArc((mouthCX - face.mouthWidth) * 2, mouthCY - face.mouthCurve / 3,
+                    face.mouthCurve * 16, face.mouthWidth * 4,
+                    mouthCX - face.mouthWidth, mouthCX + face.mouthWidth,
+                    2, botFaceColor, stroke, BOT_COLOR_BG);
+      mLeft = mouthCX - face.mouthWidth - 2; mRight = mouthCX + face.mouthWidth + 2;
+      mTop = mouthCY - face.mouthCurve / 3 - 2; mBot = mouthCY + face.mouthCurve + 2;
+      break;
+    }
+  }
+
+  // Store mouth bounds for next-frame erase
+  prevFrame.mouthLeft = mLeft;
+  prevFrame.mouthRight = mRight;
+  prevFrame.mouthTop = mTop;
+  prevFrame.mouthBot = mBot;
+  prevFrame.mouthType = face.mouthType;
+
+  prevFrame.valid = true;
+}
+
+#endif // BOT_EYES_H
@@ -0,0 +1,674 @@
+#ifndef BOT_FACES_H
+#define BOT_FACES_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// Bot Face Expression System
+// ============================================================================
+// Each expression is a struct of numeric parameters that define the face.
+// Transitions between expressions are done by lerping all parameters along
+// an easing curve; timelines chain several transitions with holds.
+// Rendering uses TFT drawing primitives only — no sprites.
+//
+// Eye style: large white ellipses (overlapping at center), dark pupils,
+// thick arc eyebrows. Matches cartoon eye reference sheet aesthetic.
+// ============================================================================
+
+// Special eye modes (override normal ellipse rendering)
+enum BotEyeMode : uint8_t {
+  EYE_NORMAL = 0,    // Standard ellipse whites + circle pupils
+  EYE_CARET,         // Happy squint — full-size eyes with upward arc line
+  EYE_HEART,         // Heart-shaped eyes
+  EYE_X,             // X X dead/angry eyes
+  EYE_SPIRAL,        // Spiral dizzy eyes (animated)
+  EYE_STAR,          // Star/sparkle eyes
+  EYE_CLOSED         // Full-size eyes with horizontal line (sleeping)
+};
+
+// Mouth shape types
+enum BotMouthType : uint8_t {
+  MOUTH_NONE = 0,    // No mouth drawn
+  MOUTH_LINE,        // Flat horizontal line
+  MOUTH_SMILE,       // Upward arc
+  MOUTH_FROWN,       // Downward arc
+  MOUTH_OPEN_O,      // Circle/O shape (surprise)
+  MOUTH_GRIN,        // Wide smile with teeth line
+  MOUTH_WAVY,        // Wavy line (dizzy/confused)
+  MOUTH_SMIRK        // Asymmetric half-smile
+};
+
+// Expression parameter struct — defines a complete face pose
+struct BotExpression {
+  // Eye shape (ellipse radii for normal mode)
+  int16_t eyeWhiteW;       // Eye white ellipse horizontal radius (half-width)
+  int16_t eyeWhiteH;       // Eye white ellipse vertical radius (half-height)
+  int16_t eyeSpacing;      // Horizontal distance between eye centers (from screen center)
+
+  // Pupil
+  int16_t pupilRadius;     // Pupil circle radius
+  int16_t pupilOffsetX;    // Base pupil X offset from eye center (for look direction)
+  int16_t pupilOffsetY;    // Base pupil Y offset from eye center
+
+  // Eyebrows
+  int16_t browOffsetY;     // Brow Y position relative to eye top (-= higher)
+  int16_t browLength;      // Brow arc/bar length (half-width)
+  int16_t browThickness;   // Brow thickness in pixels
+  int8_t  browAngleL;      // Left brow angle (-= inner down, += inner up) in degrees
+  int8_t  browAngleR;      // Right brow angle (mirrored)
+  bool    browVisible;     // Whether to draw eyebrows
+
+  // Mouth
+  BotMouthType mouthType;
+  int16_t mouthWidth;      // Mouth width (half-width from center)
+  int16_t mouthOffsetY;    // Mouth Y position below eye center
+  int16_t mouthCurve;      // Curve amount for smile/frown (arc height)
+
+  // Special modes
+  BotEyeMode eyeMode;
+
+  // Animation hints
+  uint16_t transitionMs;   // Default transition time to this expression
+};
+
+// ============================================================================
+// Expression Definitions
+// ============================================================================
+// Screen: 240x280. Face centered around (120, 125) — slightly above center
+// to leave room for mouth and speech bubbles below.
+//
+// Eye whites: ~48-55px radius horizontally, overlapping at center.
+// Pupils: ~12-14px radius. Brows: thick arcs above eyes.
+// ============================================================================
+
+// Face center coordinates
+#define BOT_FACE_CX 120
+#define BOT_FACE_CY 118
+
+// Number of defined expressions
+#define BOT_NUM_EXPRESSIONS 20
+
+// Expression indices
+#define EXPR_NEUTRAL    0
+#define EXPR_HAPPY      1
+#define EXPR_SAD        2
+#define EXPR_SURPRISED  3
+#define EXPR_SLEEPY     4
+#define EXPR_ANGRY      5
+#define EXPR_LOVE       6
+#define EXPR_DIZZY      7
+#define EXPR_THINKING   8
+#define EXPR_EXCITED    9
+#define EXPR_MISCHIEF   10
+#define EXPR_DEAD       11
+#define EXPR_SKEPTICAL  12
+#define EXPR_WORRIED    13
+#define EXPR_CONFUSED   14
+#define EXPR_PROUD      15
+#define EXPR_SHY        16
+#define EXPR_ANNOYED    17
+#define EXPR_BLISS      18
+#define EXPR_FOCUSED    19
+
+// Expression parameter table (stored in PROGMEM)
+const BotExpression botExpressions[BOT_NUM_EXPRESSIONS] PROGMEM = {
+  // 0: NEUTRAL — relaxed, default idle state
+  // Large round eyes, centered pupils, relaxed brows, slight smile
+  {
+    .eyeWhiteW = 50, .eyeWhiteH = 45, .eyeSpacing = 44,
+    .pupilRadius = 13, .pupilOffsetX = 0, .pupilOffsetY = 0,
+    .browOffsetY = -12, .browLength = 30, .browThickness = 6,
+    .browAngleL = 0, .browAngleR = 0, .browVisible = true,
+    .mouthType = MOUTH_SMILE, .mouthWidth = 18, .mouthOffsetY = 62, .mouthCurve = 6,
+    .eyeMode = EYE_NORMAL,
+    .transitionMs = 300
+  },
+
+  // 1: HAPPY — upward arc eyes (^ ^), big smile
+  {
+    .eyeWhiteW = 50, .eyeWhiteH = 45, .eyeSpacing = 44,
+    .pupilRadius = 13, .pupilOffsetX = 0, .pupilOffsetY = 0,
+    .browOffsetY = -16, .browLength = 28, .browThickness = 5,
+    .browAngleL = 10, .browAngleR = 10, .browVisible = false,
+    .mouthType = MOUTH_GRIN, .mouthWidth = 24, .mouthOffsetY = 58, .mouthCurve = 12,
+    .eyeMode = EYE_CARET,
+    .transitionMs = 250
+  },
+
+  // 2: SAD — droopy eyes, down-looking pupils, frown
+  {
+    .eyeWhiteW = 48, .eyeWhiteH = 40, .eyeSpacing = 44,
+    .pupilRadius = 14, .pupilOffsetX = 0, .pupilOffsetY = 8,
+    .browOffsetY = -10, .browLength = 28, .browThickness = 6,
+    .browAngleL = -18, .browAngleR = -18, .browVisible = true,
+    .mouthType = MOUTH_FROWN, .mouthWidth = 16, .mouthOffsetY = 65, .mouthCurve = 8,
+    .eyeMode = EYE_NORMAL,
+    .transitionMs = 400
+  },
+
+  // 3: SURPRISED — wide eyes, small pupils, O mouth
+  {
+    .eyeWhiteW = 55, .eyeWhiteH = 55, .eyeSpacing = 46,
+    .pupilRadius = 9, .pupilOffsetX = 0, .pupilOffsetY = 0,
+    .browOffsetY = -20, .browLength = 26, .browThickness = 5,
+    .browAngleL = 12, .browAngleR = 12, .browVisible = true,
+    .mouthType = MOUTH_OPEN_O, .mouthWidth = 14, .mouthOffsetY = 62, .mouthCurve = 14,
+    .eyeMode = EYE_NORMAL,
+    .transitionMs = 150
+  },
+
+  // 4: SLEEPY — half-lidded eyes (vertically squished), slight open mouth
+  {
+    .eyeWhiteW = 50, .eyeWhiteH = 22, .eyeSpacing = 44,
+    .pupilRadius = 12, .pupilOffsetX = 0, .pupilOffsetY = 4,
+    .browOffsetY = -6, .browLength = 30, .browThickness = 6,
+    .browAngleL = -5, .browAngleR = -5, .browVisible = true,
+    .mouthType = MOUTH_OPEN_O, .mouthWidth = 8, .mouthOffsetY = 58, .mouthCurve = 6,
+    .eyeMode = EYE_NORMAL,
+    .transitionMs = 500
+  },
+
+  // 5: ANGRY — narrowed sharp eyes, V-brows, gritting mouth
+  {
+    .eyeWhiteW = 52, .eyeWhiteH = 32, .eyeSpacing = 44,
+    .pupilRadius = 12, .pupilOffsetX = 0, .pupilOffsetY = 2,
+    .browOffsetY = -6, .browLength = 32, .browThickness = 7,
+    .browAngleL = 22, .browAngleR = 22, .browVisible = true,
+    .mouthType = MOUTH_LINE, .mouthWidth = 20, .mouthOffsetY = 62, .mouthCurve = 0,
+    .eyeMode = EYE_NORMAL,
+    .transitionMs = 200
+  },
+
+  // 6: LOVE — heart-shaped eyes, smile
+  {
+    .eyeWhiteW = 50, .eyeWhiteH = 45, .eyeSpacing = 46,
+    .pupilRadius = 13, .pupilOffsetX = 0, .pupilOffsetY = 0,
+    .browOffsetY = -14, .browLength = 28, .browThickness = 5,
+    .browAngleL = 8, .browAngleR = 8, .browVisible = false,
+    .mouthType = MOUTH_SMILE, .mouthWidth = 20, .mouthOffsetY = 60, .mouthCurve = 10,
+    .eyeMode = EYE_HEART,
+    .transitionMs = 300
+  },
+
+  // 7: DIZZY — spiral eyes, wavy mouth (post-shake)
+  {
+    .eyeWhiteW = 50, .eyeWhiteH = 45, .eyeSpacing = 44,
+    .pupilRadius = 13, .pupilOffsetX = 0, .pupilOffsetY = 0,
+    .browOffsetY = -10, .browLength = 26, .browThickness = 5,
+    .browAngleL = -8, .browAngleR = 12, .browVisible = true,
+    .mouthType = MOUTH_WAVY, .mouthWidth = 18, .mouthOffsetY = 62, .mouthCurve = 6,
+    .eyeMode = EYE_SPIRAL,
+    .transitionMs = 200
+  },
+
+  // 8: THINKING — looking up-right, one raised brow, slight pucker
+  {
+    .eyeWhiteW = 50, .eyeWhiteH = 45, .eyeSpacing = 44,
+    .pupilRadius = 12, .pupilOffsetX = 10, .pupilOffsetY = -10,
+    .browOffsetY = -14, .browLength = 28, .browThickness = 6,
+    .browAngleL = 0, .browAngleR = 15, .browVisible = true,
+    .mouthType = MOUTH_LINE, .mouthWidth = 10, .mouthOffsetY = 62, .mouthCurve = 0,
+    .eyeMode = EYE_NORMAL,
+    .transitionMs = 350
+  },
+
+  // 9: EXCITED — star/sparkle eyes, big grin
+  {
+    .eyeWhiteW = 52, .eyeWhiteH = 48, .eyeSpacing = 46,
+    .pupilRadius = 14, .pupilOffsetX = 0, .pupilOffsetY = 0,
+    .browOffsetY = -18, .browLength = 26, .browThickness = 5,
+    .browAngleL = 12, .browAngleR = 12, .browVisible = false,
+    .mouthType = MOUTH_GRIN, .mouthWidth = 26, .mouthOffsetY = 56, .mouthCurve = 14,
+    .eyeMode = EYE_STAR,
+    .transitionMs = 200
+  },
+
+  // 10: MISCHIEVOUS — side-glance, one eye narrowed, smirk
+  {
+    .eyeWhiteW = 50, .eyeWhiteH = 45, .eyeSpacing = 44,
+    .pupilRadius = 13, .pupilOffsetX = 12, .pupilOffsetY = 2,
+    .browOffsetY = -12, .browLength = 28, .browThickness = 6,
+    .browAngleL = -6, .browAngleR = 14, .browVisible = true,
+    .mouthType = MOUTH_SMIRK, .mouthWidth = 18, .mouthOffsetY = 62, .mouthCurve = 8,
+    .eyeMode = EYE_NORMAL,
+    .transitionMs = 300
+  },
+
+  // 11: DEAD — X eyes, flat line mouth
+  {
+    .eyeWhiteW = 48, .eyeWhiteH = 42, .eyeSpacing = 44,
+    .pupilRadius = 13, .pupilOffsetX = 0, .pupilOffsetY = 0,
+    .browOffsetY = -10, .browLength = 28, .browThickness = 5,
+    .browAngleL = 0, .browAngleR = 0, .browVisible = false,
+    .mouthType = MOUTH_LINE, .mouthWidth = 18, .mouthOffsetY = 62, .mouthCurve = 0,
+    .eyeMode = EYE_X,
+    .transitionMs = 150
+  },
+
+  // 12: SKEPTICAL — one eye narrowed, one normal, flat mouth
+  {
+    .eyeWhiteW = 50, .eyeWhiteH = 45, .eyeSpacing = 44,
+    .pupilRadius = 13, .pupilOffsetX = 6, .pupilOffsetY = 2,
+    .browOffsetY = -12, .browLength = 28, .browThickness = 6,
+    .browAngleL = -10, .browAngleR = 18, .browVisible = true,
+    .mouthType = MOUTH_LINE, .mouthWidth = 14, .mouthOffsetY = 62, .mouthCurve = 0,
+    .eyeMode = EYE_NORMAL,
+    .transitionMs = 300
+  },
+
+  // 13: WORRIED — wide eyes, brows angled inward-up, frown
+  {
+    .eyeWhiteW = 52, .eyeWhiteH = 50, .eyeSpacing = 44,
+    .pupilRadius = 11, .pupilOffsetX = 0, .pupilOffsetY = 4,
+    .browOffsetY = -16, .browLength = 26, .browThickness = 5,
+    .browAngleL = -14, .browAngleR = -14, .browVisible = true,
+    .mouthType = MOUTH_FROWN, .mouthWidth = 12, .mouthOffsetY = 64, .mouthCurve = 6,
+    .eyeMode = EYE_NORMAL,
+    .transitionMs = 350
+  },
+
+  // 14: CONFUSED — looking sideways, asymmetric brows, wavy mouth
+  {
+    .eyeWhiteW = 50, .eyeWhiteH = 45, .eyeSpacing = 44,
+    .pupilRadius = 12, .pupilOffsetX = -8, .pupilOffsetY = -4,
+    .browOffsetY = -12, .browLength = 26, .browThickness = 5,
+    .browAngleL = 10, .browAngleR = -8, .browVisible = true,
+    .mouthType = MOUTH_WAVY, .mouthWidth = 14, .mouthOffsetY = 62, .mouthCurve = 4,
+    .eyeMode = EYE_NORMAL,
+    .transitionMs = 350
+  },
+
+  // 15: PROUD — eyes slightly closed, chin-up look, big smile
+  {
+    .eyeWhiteW = 50, .eyeWhiteH = 35, .eyeSpacing = 44,
+    .pupilRadius = 12, .pupilOffsetX = 0, .pupilOffsetY = -4,
+    .browOffsetY = -10, .browLength = 30, .browThickness = 6,
+    .browAngleL = 6, .browAngleR = 6, .browVisible = true,
+    .mouthType = MOUTH_SMILE, .mouthWidth = 22, .mouthOffsetY = 60, .mouthCurve = 10,
+    .eyeMode = EYE_NORMAL,
+    .transitionMs = 350
+  },
+
+  // 16: SHY — looking down-left, small pupils, slight smile
+  {
+    .eyeWhiteW = 48, .eyeWhiteH = 42, .eyeSpacing = 44,
+    .pupilRadius = 10, .pupilOffsetX = -10, .pupilOffsetY = 8,
+    .browOffsetY = -10, .browLength = 24, .browThickness = 5,
+    .browAngleL = -4, .browAngleR = 4, .browVisible = true,
+    .mouthType = MOUTH_SMILE, .mouthWidth = 12, .mouthOffsetY = 62, .mouthCurve = 4,
+    .eyeMode = EYE_NORMAL,
+    .transitionMs = 400
+  },
+
+  // 17: ANNOYED — half-lidded, side-looking, flat mouth
+  {
+    .eyeWhiteW = 52, .eyeWhiteH = 28, .eyeSpacing = 44,
+    .pupilRadius = 12, .pupilOffsetX = 8, .pupilOffsetY = 2,
+    .browOffsetY = -4, .browLength = 30, .browThickness = 7,
+    .browAngleL = 10, .browAngleR = 10, .browVisible = true,
+    .mouthType = MOUTH_LINE, .mouthWidth = 16, .mouthOffsetY = 60, .mouthCurve = 0,
+    .eyeMode = EYE_NORMAL,
+    .transitionMs = 250
+  },
+
+  // 18: BLISS — caret eyes but relaxed, big content smile
+  {
+    .eyeWhiteW = 48, .eyeWhiteH = 40, .eyeSpacing = 44,
+    .pupilRadius = 13, .pupilOffsetX = 0, .pupilOffsetY = 0,
+    .browOffsetY = -14, .browLength = 26, .browThickness = 5,
+    .browAngleL = 8, .browAngleR = 8, .browVisible = false,
+    .mouthType = MOUTH_SMILE, .mouthWidth = 20, .mouthOffsetY = 58, .mouthCurve = 10,
+    .eyeMode = EYE_CARET,
+    .transitionMs = 400
+  },
+
+  // 19: FOCUSED — normal eyes looking straight, slight squint, no mouth
+  {
+    .eyeWhiteW = 48, .eyeWhiteH = 38, .eyeSpacing = 44,
+    .pupilRadius = 14, .pupilOffsetX = 0, .pupilOffsetY = 0,
+    .browOffsetY = -8, .browLength = 28, .browThickness = 6,
+    .browAngleL = 4, .browAngleR = 4, .browVisible = true,
+    .mouthType = MOUTH_NONE, .mouthWidth = 0, .mouthOffsetY = 62, .mouthCurve = 0,
+    .eyeMode = EYE_NORMAL,
+    .transitionMs = 300
+  }
+};
+
+// ============================================================================
+// Easing curves
+// ============================================================================
+// Progress in and out is 0-256 (256 = target reached). Overshoot and spring
+// go past 256 before settling, so eased lerps can leave the [from, to] range.
+// Curves are 17-point tables in flash, linearly interpolated.
+
+enum BotEase : uint8_t {
+  EASE_LINEAR = 0,
+  EASE_IN_OUT,       // Smoothstep
+  EASE_OUT,          // Cubic — fast start, soft landing
+  EASE_OVERSHOOT,    // Back-out, ~10% past the target
+  EASE_SPRING,       // Damped oscillation, ~20% past the target
+  BOT_NUM_EASES
+};
+
+#define BOT_EASE_STEPS 16
+
+const int16_t botEaseCurves[BOT_NUM_EASES][BOT_EASE_STEPS + 1] PROGMEM = {
+  { 0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240, 256 },
+  { 0, 3, 11, 24, 40, 59, 81, 104, 128, 152, 175, 197, 216, 232, 245, 253, 256 },
+  { 0, 45, 84, 119, 148, 173, 194, 210, 224, 235, 242, 248, 252, 254, 256, 256, 256 },
+  { 0, 69, 126, 173, 209, 237, 257, 271, 278, 281, 281, 277, 272, 267, 261, 258, 256 },
+  { 0, 100, 204, 276, 308, 309, 292, 272, 256, 247, 246, 248, 252, 255, 257, 258, 256 },
+};
+
+// Eased progress for linear progress t (0-256)
+inline int16_t botEase(uint8_t ease, uint16_t t) {
+  if (ease >= BOT_NUM_EASES) ease = EASE_LINEAR;
+  if (t >= 256) return 256;
+  uint8_t i = t >> 4;
+  int16_t a = (int16_t)pgm_read_word(&botEaseCurves[ease][i]);
+  int16_t b = (int16_t)pgm_read_word(&botEaseCurves[ease][i + 1]);
+  return a + (((b - a) * (int16_t)(t & 15)) >> 4);
+}
+
+// ============================================================================
+// Expression timelines
+// ============================================================================
+// A timeline chains keyframes: blend to an expression with an easing curve,
+// then hold it before moving on. Keyframes live in one flash array and each
+// timeline is a (first, count) slice of it, so adding timelines or
+// expressions costs flash only.
+
+struct BotKeyframe {
+  uint8_t expr;
+  uint8_t ease;
+  uint8_t snap;          // Blend point (0-255) where eye mode/mouth/brows switch
+  uint16_t durationMs;   // 0 = the expression's default transition time
+  uint16_t holdMs;       // Time to hold after arriving
+};
+
+struct BotTimeline {
+  uint8_t first;
+  uint8_t count;
+};
+
+#define TL_WAKE_UP      0   // Startled awake, happy to see you, settle
+#define TL_DIZZY        1   // Shaken: spin out, confused, recover
+#define TL_GIGGLE       2   // Bouncy happy/bliss/happy
+#define TL_DOUBLE_TAKE  3   // Confused, surprised, skeptical
+#define BOT_NUM_TIMELINES 4
+#define BOT_NO_TIMELINE 0xFF
+
+const BotKeyframe botKeyframes[] PROGMEM = {
+  // TL_WAKE_UP
+  { EXPR_SURPRISED, EASE_OVERSHOOT, 48,  180, 500 },
+  { EXPR_HAPPY,     EASE_OUT,       128, 300, 900 },
+  { EXPR_NEUTRAL,   EASE_IN_OUT,    128, 500, 0 },
+  // TL_DIZZY
+  { EXPR_DIZZY,     EASE_SPRING,    32,  150, 1800 },
+  { EXPR_CONFUSED,  EASE_OUT,       128, 400, 600 },
+  { EXPR_NEUTRAL,   EASE_IN_OUT,    128, 500, 0 },
+  // TL_GIGGLE
+  { EXPR_HAPPY,     EASE_SPRING,    64,  250, 300 },
+  { EXPR_BLISS,     EASE_OUT,       128, 250, 400 },
+  { EXPR_HAPPY,     EASE_SPRING,    64,  250, 600 },
+  { EXPR_NEUTRAL,   EASE_IN_OUT,    128, 500, 0 },
+  // TL_DOUBLE_TAKE
+  { EXPR_CONFUSED,  EASE_OUT,       128, 300, 500 },
+  { EXPR_SURPRISED, EASE_OVERSHOOT, 32,  120, 400 },
+  { EXPR_SKEPTICAL, EASE_OUT,       128, 350, 1200 },
+  { EXPR_NEUTRAL,   EASE_IN_OUT,    128, 500, 0 },
+};
+
+const BotTimeline botTimelines[BOT_NUM_TIMELINES] PROGMEM = {
+  { 0, 3 },    // TL_WAKE_UP
+  { 3, 3 },    // TL_DIZZY
+  { 6, 4 },    // TL_GIGGLE
+  { 10, 4 },   // TL_DOUBLE_TAKE
+};
+
+// ============================================================================
+// Expression interpolation helpers
+// ============================================================================
+
+// Lerp with eased progress (0-256, may overshoot either end)
+inline int16_t lerpEased(int16_t a, int16_t b, int16_t e) {
+  return a + (((int32_t)(b - a) * e) >> 8);
+}
+
+// Expression lookup across built-ins and the uploaded pack (bot_expr_pack.h)
+uint16_t botExpressionCount();
+void botReadExpression(uint16_t index, BotExpression &out);
+
+// Runtime expression state (interpolated values — not in PROGMEM)
+struct BotFaceState {
+  // Interpolated parameters
+  int16_t eyeWhiteW, eyeWhiteH, eyeSpacing;
+  int16_t pupilRadius, pupilOffsetX, pupilOffsetY;
+  int16_t browOffsetY, browLength, browThickness;
+  int8_t  browAngleL, browAngleR;
+  bool    browVisible;
+  BotMouthType mouthType;
+  int16_t mouthWidth, mouthOffsetY, mouthCurve;
+  BotEyeMode eyeMode;
+
+  // Dynamic offsets (from IMU, look-around, etc.)
+  int16_t dynamicPupilX;   // Added to pupilOffsetX for final pupil position
+  int16_t dynamicPupilY;   // Added to pupilOffsetY
+
+  // Blink state
+  float blinkAmount;       // 0.0 = open, 1.0 = fully closed
+
+  // Talking (set while a speech bubble types out)
+  uint8_t talkOpen;        // Open mouth height in px; 0 = expression mouth
+
+  // Transition state
+  uint16_t currentExpr;    // Expression index (built-in or pack)
+  uint16_t targetExpr;
+  uint8_t blendT;          // 0-255 linear blend progress
+  unsigned long transitionStart;
+  uint16_t transitionDuration;
+  bool transitioning;
+
+  // Blend sources, cached in RAM when a transition starts
+  BotExpression from, to;
+  uint8_t ease;
+  uint8_t snap;
+
+  // Timeline playback
+  uint8_t timeline;        // BOT_NO_TIMELINE when not playing
+  uint8_t keyIndex;
+  uint16_t holdMs;         // Hold for the current keyframe
+  unsigned long arrivedAt;
+
+  // Copy a pose into the live parameters
+  void apply(const BotExpression &e) {
+    eyeWhiteW = e.eyeWhiteW;
+    eyeWhiteH = e.eyeWhiteH;
+    eyeSpacing = e.eyeSpacing;
+    pupilRadius = e.pupilRadius;
+    pupilOffsetX = e.pupilOffsetX;
+    pupilOffsetY = e.pupilOffsetY;
+    browOffsetY = e.browOffsetY;
+    browLength = e.browLength;
+    browThickness = e.browThickness;
+    browAngleL = e.browAngleL;
+    browAngleR = e.browAngleR;
+    browVisible = e.browVisible;
+    mouthType = e.mouthType;
+    mouthWidth = e.mouthWidth;
+    mouthOffsetY = e.mouthOffsetY;
+    mouthCurve = e.mouthCurve;
+    eyeMode = e.eyeMode;
+  }
+
+  // Snapshot the live parameters (interrupted transitions start from here)
+  void capture(BotExpression &e) const {
+    e.eyeWhiteW = eyeWhiteW;
+    e.eyeWhiteH = eyeWhiteH;
+    e.eyeSpacing = eyeSpacing;
+    e.pupilRadius = pupilRadius;
+    e.pupilOffsetX = pupilOffsetX;
+    e.pupilOffsetY = pupilOffsetY;
+    e.browOffsetY = browOffsetY;
+    e.browLength = browLength;
+    e.browThickness = browThickness;
+    e.browAngleL = browAngleL;
+    e.browAngleR = browAngleR;
+    e.browVisible = browVisible;
+    e.mouthType = mouthType;
+    e.mouthWidth = mouthWidth;
+    e.mouthOffsetY = mouthOffsetY;
+    e.mouthCurve = mouthCurve;
+    e.eyeMode = eyeMode;
+    e.transitionMs = 0;
+  }
+
+  // Load expression (PROGMEM or pack)
+  void loadExpression(uint16_t index) {
+    if (index >= botExpressionCount()) index = EXPR_NEUTRAL;
+    botReadExpression(index, to);
+    from = to;
+    apply(to);
+
+    currentExpr = index;
+    targetExpr = index;
+    blendT = 255;
+    transitioning = false;
+  }
+
+  // Begin blending from the live pose to `index`
+  void startBlend(uint16_t index, uint16_t durationMs, uint8_t easeType, uint8_t snapAt) {
+    if (index >= botExpressionCount()) index = EXPR_NEUTRAL;
+    capture(from);
+    botReadExpression(index, to);
+
+    // Use target's default transition time if none specified
+    if (durationMs == 0) durationMs = to.transitionMs;
+
+    currentExpr = targetExpr;
+    targetExpr = index;
+    blendT = 0;
+    ease = easeType;
+    snap = snapAt;
+    transitionStart = millis();
+    transitionDuration = max(durationMs, (uint16_t)1);
+    transitioning = true;
+  }
+
+  // Start transitioning to a new expression (stops any timeline)
+  void transitionTo(uint16_t index, uint16_t durationMs = 0, uint8_t easeType = EASE_OUT) {
+    if (index >= botExpressionCount()) index = EXPR_NEUTRAL;
+    if (index == targetExpr && !transitioning && timeline == BOT_NO_TIMELINE) return;
+    timeline = BOT_NO_TIMELINE;
+    startBlend(index, durationMs, easeType, 128);
+  }
+
+  // ---- Timelines ----
+
+  void startKeyframe() {
+    BotTimeline tl;
+    BotKeyframe k;
+    memcpy_P(&tl, &botTimelines[timeline], sizeof(BotTimeline));
+    memcpy_P(&k, &botKeyframes[tl.first + keyIndex], sizeof(BotKeyframe));
+    holdMs = k.holdMs;
+    startBlend(k.expr, k.durationMs, k.ease, k.snap);
+  }
+
+  void playTimeline(uint8_t id) {
+    if (id >= BOT_NUM_TIMELINES) return;
+    timeline = id;
+    keyIndex = 0;
+    startKeyframe();
+  }
+
+  bool playingTimeline() const { return timeline != BOT_NO_TIMELINE; }
+
+  // Total play time of a timeline in ms
+  uint32_t timelineDurationMs(uint8_t id) const {
+    if (id >= BOT_NUM_TIMELINES) return 0;
+    BotTimeline tl;
+    memcpy_P(&tl, &botTimelines[id], sizeof(BotTimeline));
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < tl.count; i++) {
+      BotKeyframe k;
+      memcpy_P(&k, &botKeyframes[tl.first + i], sizeof(BotKeyframe));
+      uint16_t d = k.durationMs;
+      if (d == 0) d = pgm_read_word(&botExpressions[k.expr].transitionMs);
+      total += d + k.holdMs;
+    }
+    return total;
+  }
+
+  // Update transition and timeline (call each frame)
+  void update() {
+    unsigned long now = millis();
+
+    if (transitioning) {
+      unsigned long elapsed = now - transitionStart;
+      if (elapsed >= transitionDuration) {
+        // Transition complete
+        apply(to);
+        currentExpr = targetExpr;
+        blendT = 255;
+        transitioning = false;
+        arrivedAt = now;
+      } else {
+        blendFrame((uint16_t)((elapsed * 256UL) / transitionDuration));
+        return;
+      }
+    }
+
+    // Advance the timeline once the current keyframe's hold is over
+    if (timeline != BOT_NO_TIMELINE && now - arrivedAt >= holdMs) {
+      BotTimeline tl;
+      memcpy_P(&tl, &botTimelines[timeline], sizeof(BotTimeline));
+      if (++keyIndex < tl.count) {
+        startKeyframe();
+      } else {
+        timeline = BOT_NO_TIMELINE;
+      }
+    }
+  }
+
+  // Interpolate the cached blend sources at linear progress t (0-255)
+  void blendFrame(uint16_t t) {
+    blendT = (uint8_t)min(t, (uint16_t)255);
+    int16_t e = botEase(ease, t);
+
+    // Lerp all numeric parameters; sizes can't go negative on overshoot
+    eyeWhiteW = max(lerpEased(from.eyeWhiteW, to.eyeWhiteW, e), (int16_t)0);
+    eyeWhiteH = max(lerpEased(from.eyeWhiteH, to.eyeWhiteH, e), (int16_t)0);
+    eyeSpacing = lerpEased(from.eyeSpacing, to.eyeSpacing, e);
+    pupilRadius = max(lerpEased(from.pupilRadius, to.pupilRadius, e), (int16_t)0);
+    pupilOffsetX = lerpEased(from.pupilOffsetX, to.pupilOffsetX, e);
+    pupilOffsetY = lerpEased(from.pupilOffsetY, to.pupilOffsetY, e);
+    browOffsetY = lerpEased(from.browOffsetY, to.browOffsetY, e);
+    browLength = max(lerpEased(from.browLength, to.browLength, e), (int16_t)0);
+    browThickness = max(lerpEased(from.browThickness, to.browThickness, e), (int16_t)1);
+    browAngleL = (int8_t)constrain(lerpEased(from.browAngleL, to.browAngleL, e), -90, 90);
+    browAngleR = (int8_t)constrain(lerpEased(from.browAngleR, to.browAngleR, e), -90, 90);
+
+    mouthWidth = max(lerpEased(from.mouthWidth, to.mouthWidth, e), (int16_t)0);
+    mouthOffsetY = lerpEased(from.mouthOffsetY, to.mouthOffsetY, e);
+    mouthCurve = lerpEased(from.mouthCurve, to.mouthCurve, e);
+
+    // Discrete parameters switch at the keyframe's snap point
+    bool pastSnap = (blendT >= snap);
+    browVisible = pastSnap ? to.browVisible : from.browVisible;
+    mouthType = pastSnap ? to.mouthType : from.mouthType;
+    eyeMode = pastSnap ? to.eyeMode : from.eyeMode;
+  }
+
+  // Initialize to neutral
+  void init() {
+    dynamicPupilX = 0;
+    dynamicPupilY = 0;
+    blinkAmount = 0.0f;
+    talkOpen = 0;
+    transitioning = false;
+    timeline = BOT_NO_TIMELINE;
+    loadExpression(EXPR_NEUTRAL);
+  }
+};
+
+#endif // BOT_FACES_H
@@ -0,0 +1,146 @@
+#ifndef BOT_FONT_H
+#define BOT_FONT_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// Bot Font — classic 5x7 GLCD glyphs (ASCII 32-126) as a span atlas
+// ============================================================================
+// Same glyph shapes as the built-in Arduino_GFX font, so text rendered by the
+// bot's own rasterizer matches what gfx->print() used to produce.
+//
+// Stored row-major for the span rasterizer: one byte per glyph row, bit 0 =
+// leftmost column, 8 rows per glyph (row 7 holds descenders). Each 5-bit row
+// pattern maps through botRowRuns[] to at most 3 horizontal runs, so a glyph
+// row at any text size is 0-3 spans with endpoints scaled by a multiply —
+// no per-pixel or per-column work.
+// Cells are 6x8 (one blank column after each glyph), scaled by text size.
+// ============================================================================
+
+#define BOT_FONT_FIRST   32
+#define BOT_FONT_LAST    126
+#define BOT_FONT_ROWS    8
+#define BOT_FONT_CELL_W  6
+#define BOT_FONT_CELL_H  8
+
+const uint8_t botFontRows[(BOT_FONT_LAST - BOT_FONT_FIRST + 1) * BOT_FONT_ROWS] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ' '
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x00,  // '!'
+  0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,  // '"'
+  0x0A, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A, 0x0A, 0x00,  // '#'
+  0x04, 0x1E, 0x05, 0x0E, 0x14, 0x0F, 0x04, 0x00,  // '$'
+  0x03, 0x13, 0x08, 0x04, 0x02, 0x19, 0x18, 0x00,  // '%'
+  0x02, 0x05, 0x05, 0x02, 0x15, 0x09, 0x16, 0x00,  // '&'
+  0x0C, 0x0C, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00,  // '''
+  0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08, 0x00,  // '('
+  0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02, 0x00,  // ')'
+  0x04, 0x15, 0x0E, 0x1F, 0x0E, 0x15, 0x04, 0x00,  // '*'
+  0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00, 0x00,  // '+'
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x04, 0x02,  // ','
+  0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,  // '-'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00,  // '.'
+  0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00,  // '/'
+  0x0E, 0x11, 0x19, 0x15, 0x13, 0x11, 0x0E, 0x00,  // '0'
+  0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x0E, 0x00,  // '1'
+  0x0E, 0x11, 0x10, 0x0E, 0x01, 0x01, 0x1F, 0x00,  // '2'
+  0x1F, 0x10, 0x08, 0x0C, 0x10, 0x11, 0x0E, 0x00,  // '3'
+  0x08, 0x0C, 0x0A, 0x09, 0x1F, 0x08, 0x08, 0x00,  // '4'
+  0x1F, 0x01, 0x0F, 0x10, 0x10, 0x11, 0x0E, 0x00,  // '5'
+  0x1C, 0x02, 0x01, 0x0F, 0x11, 0x11, 0x0E, 0x00,  // '6'
+  0x1F, 0x10, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00,  // '7'
+  0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E, 0x00,  // '8'
+  0x0E, 0x11, 0x11, 0x1E, 0x10, 0x08, 0x07, 0x00,  // '9'
+  0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,  // ':'
+  0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x02, 0x00,  // ';'
+  0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10, 0x00,  // '<'
+  0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00,  // '='
+  0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02, 0x00,  // '>'
+  0x0E, 0x11, 0x10, 0x0C, 0x04, 0x00, 0x04, 0x00,  // '?'
+  0x0E, 0x11, 0x15, 0x1D, 0x0D, 0x01, 0x1E, 0x00,  // '@'
+  0x04, 0x0A, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x00,  // 'A'
+  0x0F, 0x11, 0x11, 0x0F, 0x11, 0x11, 0x0F, 0x00,  // 'B'
+  0x0E, 0x11, 0x01, 0x01, 0x01, 0x11, 0x0E, 0x00,  // 'C'
+  0x0F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0F, 0x00,  // 'D'
+  0x1F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x1F, 0x00,  // 'E'
+  0x1F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x01, 0x00,  // 'F'
+  0x1E, 0x11, 0x01, 0x01, 0x19, 0x11, 0x1E, 0x00,  // 'G'
+  0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11, 0x00,  // 'H'
+  0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E, 0x00,  // 'I'
+  0x1C, 0x08, 0x08, 0x08, 0x08, 0x09, 0x06, 0x00,  // 'J'
+  0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x00,  // 'K'
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1F, 0x00,  // 'L'
+  0x11, 0x1B, 0x15, 0x15, 0x15, 0x11, 0x11, 0x00,  // 'M'
+  0x11, 0x11, 0x13, 0x15, 0x19, 0x11, 0x11, 0x00,  // 'N'
+  0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00,  // 'O'
+  0x0F, 0x11, 0x11, 0x0F, 0x01, 0x01, 0x01, 0x00,  // 'P'
+  0x0E, 0x11, 0x11, 0x11, 0x15, 0x09, 0x16, 0x00,  // 'Q'
+  0x0F, 0x11, 0x11, 0x0F, 0x05, 0x09, 0x11, 0x00,  // 'R'
+  0x0E, 0x11, 0x01, 0x0E, 0x10, 0x11, 0x0E, 0x00,  // 'S'
+  0x1F, 0x15, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00,  // 'T'
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00,  // 'U'
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04, 0x00,  // 'V'
+  0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A, 0x00,  // 'W'
+  0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11, 0x00,  // 'X'
+  0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x00,  // 'Y'
+  0x1F, 0x10, 0x08, 0x0E, 0x02, 0x01, 0x1F, 0x00,  // 'Z'
+  0x1E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x1E, 0x00,  // '['
+  0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00,  // '\'
+  0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x00,  // ']'
+  0x04, 0x0A, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,  // '^'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,  // '_'
+  0x06, 0x06, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00,  // '`'
+  0x00, 0x00, 0x06, 0x08, 0x0E, 0x09, 0x1E, 0x00,  // 'a'
+  0x01, 0x01, 0x0D, 0x13, 0x11, 0x13, 0x0D, 0x00,  // 'b'
+  0x00, 0x00, 0x0E, 0x11, 0x01, 0x11, 0x0E, 0x00,  // 'c'
+  0x10, 0x10, 0x16, 0x19, 0x11, 0x19, 0x16, 0x00,  // 'd'
+  0x00, 0x00, 0x0E, 0x11, 0x1F, 0x01, 0x0E, 0x00,  // 'e'
+  0x08, 0x14, 0x04, 0x0E, 0x04, 0x04, 0x04, 0x00,  // 'f'
+  0x00, 0x00, 0x0E, 0x19, 0x19, 0x16, 0x10, 0x0E,  // 'g'
+  0x01, 0x01, 0x0D, 0x13, 0x11, 0x11, 0x11, 0x00,  // 'h'
+  0x04, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0E, 0x00,  // 'i'
+  0x08, 0x00, 0x08, 0x08, 0x08, 0x09, 0x06, 0x00,  // 'j'
+  0x01, 0x01, 0x09, 0x05, 0x03, 0x05, 0x09, 0x00,  // 'k'
+  0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E, 0x00,  // 'l'
+  0x00, 0x00, 0x0B, 0x15, 0x15, 0x15, 0x15, 0x00,  // 'm'
+  0x00, 0x00, 0x0D, 0x13, 0x11, 0x11, 0x11, 0x00,  // 'n'
+  0x00, 0x00, 0x0E, 0x11, 0x11, 0x11, 0x0E, 0x00,  // 'o'
+  0x00, 0x00, 0x0D, 0x13, 0x13, 0x0D, 0x01, 0x01,  // 'p'
+  0x00, 0x00, 0x16, 0x19, 0x19, 0x16, 0x10, 0x10,  // 'q'
+  0x00, 0x00, 0x0D, 0x13, 0x01, 0x01, 0x01, 0x00,  // 'r'
+  0x00, 0x00, 0x1E, 0x01, 0x0E, 0x10, 0x0F, 0x00,  // 's'
+  0x04, 0x04, 0x1F, 0x04, 0x04, 0x14, 0x08, 0x00,  // 't'
+  0x00, 0x00, 0x11, 0x11, 0x11, 0x19, 0x16, 0x00,  // 'u'
+  0x00, 0x00, 0x11, 0x11, 0x11, 0x0A, 0x04, 0x00,  // 'v'
+  0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0A, 0x00,  // 'w'
+  0x00, 0x00, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x00,  // 'x'
+  0x00, 0x00, 0x11, 0x11, 0x1E, 0x10, 0x11, 0x0E,  // 'y'
+  0x00, 0x00, 0x1F, 0x08, 0x04, 0x02, 0x1F, 0x00,  // 'z'
+  0x08, 0x04, 0x04, 0x02, 0x04, 0x04, 0x08, 0x00,  // '{'
+  0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x00,  // '|'
+  0x02, 0x04, 0x04, 0x08, 0x04, 0x04, 0x02, 0x00,  // '}'
+  0x02, 0x15, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00   // '~'
+};
+
+// Runs for each 5-bit row pattern. Bits 0-1: run count; then per run
+// 6 bits: start column (3) | length (3).
+const uint32_t botRowRuns[32] PROGMEM = {
+  0x00000, 0x00021, 0x00025, 0x00041, 0x00029, 0x00A22, 0x00045, 0x00061,
+  0x0002D, 0x00B22, 0x00B26, 0x00B42, 0x00049, 0x01222, 0x00065, 0x00081,
+  0x00031, 0x00C22, 0x00C26, 0x00C42, 0x00C2A, 0x30A23, 0x00C46, 0x00C62,
+  0x0004D, 0x01322, 0x01326, 0x01342, 0x00069, 0x01A22, 0x00085, 0x000A1
+};
+
+// Row pattern of a glyph (unknown characters render as '?')
+inline uint8_t botGlyphRow(char c, uint8_t row) {
+  if (c < BOT_FONT_FIRST || c > BOT_FONT_LAST) c = '?';
+  return pgm_read_byte(&botFontRows[(c - BOT_FONT_FIRST) * BOT_FONT_ROWS + row]);
+}
+
+// Ink width of a single-line string in pixels (no trailing cell gap)
+inline int16_t botTextWidth(const char *text, uint8_t size) {
+  size_t len = strlen(text);
+  if (len == 0) return 0;
+  return (int16_t)(len * BOT_FONT_CELL_W - 1) * size;
+}
+
+#endif // BOT_FONT_H
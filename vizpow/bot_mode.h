@@ -0,0 +1,859 @@
+#ifndef BOT_MODE_H
+#define BOT_MODE_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "bot_faces.h"
+#include "bot_expr_pack.h"
+#include "bot_eyes.h"
+#include "bot_sayings.h"
+#include "bot_overlays.h"
+#include "bot_background.h"
+#include "bot_scheduler.h"
+#include "i2c_bus.h"
+#include "imu_orientation.h"
+#include "imu_gestures.h"
+#include "bot_present.h"
+
+// ============================================================================
+// Bot Mode — Main State Machine & Render Pipeline
+// ============================================================================
+// Bot Mode is the 4th display mode for TARGET_LCD. It renders an animated
+// desktop companion character on the 240x280 LCD using procedural geometry.
+//
+// States: ACTIVE -> IDLE -> SLEEPY -> SLEEPING
+// Any interaction (touch, shake, motion) wakes the bot.
+// ============================================================================
+
+#if defined(DISPLAY_LCD_ONLY) || defined(DISPLAY_DUAL)
+
+// External references
+extern Arduino_GFX *gfx;
+extern float accelPeak;  // Largest |accel| in the last IMU burst
+extern bool menuVisible;
+
+// Bot activity states
+enum BotState : uint8_t {
+  BOT_ACTIVE = 0,    // Normal active state — expressions, look-around, reactions
+  BOT_IDLE,          // Reduced movement after period of no interaction
+  BOT_SLEEPY,        // Transitioning to sleep (half-lidded, yawns)
+  BOT_SLEEPING       // Asleep (eyes closed, Zzz animation)
+};
+
+// ============================================================================
+// Bot Mode Configuration
+// ============================================================================
+
+#define BOT_WAKE_THRESHOLD     1.8f      // Acceleration magnitude to wake from sleep
+#define BOT_FRAME_DELAY_MS     33        // ~30 FPS target
+#define BOT_FPS_IDLE           10        // Idle and sleepy (short animations still get full rate)
+#define BOT_FPS_SLEEPING       4         // Only the Zzz drift moves
+#define BOT_INPUT_POLL_MS      50        // Longest loop sleep — IMU/touch are polled at least this often
+
+// ============================================================================
+// Personality Presets
+// ============================================================================
+// Each personality adjusts idle behavior, saying frequency, and expression
+// distribution. Configurable via web UI.
+
+#define BOT_NUM_PERSONALITIES 4
+#define PERSONALITY_CHILL   0
+#define PERSONALITY_HYPER   1
+#define PERSONALITY_GRUMPY  2
+#define PERSONALITY_SLEEPY  3
+
+struct BotPersonality {
+  const char* name;
+  uint32_t idleTimeoutMs;       // Time before idle state
+  uint32_t sleepyTimeoutMs;     // Time before sleepy state
+  uint32_t sleepTimeoutMs;      // Time before sleeping state
+  uint32_t exprMinMs;           // Min time between random expressions
+  uint32_t exprMaxMs;           // Max time between random expressions
+  uint32_t sayMinMs;            // Min time between idle sayings
+  uint32_t sayMaxMs;            // Max time between idle sayings
+  uint8_t  sayChancePercent;    // % chance of saying on reaction
+  uint8_t  favoriteExprs[5];    // Weighted idle expression pool
+};
+
+const BotPersonality botPersonalities[BOT_NUM_PERSONALITIES] = {
+  // CHILL: lively and expressive, default behavior
+  { "Chill", 90000, 240000, 360000, 4000, 10000, 8000, 20000, 55,
+    { EXPR_NEUTRAL, EXPR_HAPPY, EXPR_THINKING, EXPR_MISCHIEF, EXPR_BLISS } },
+
+  // HYPER: energetic, constant expressions and sayings
+  { "Hyper", 180000, 360000, 600000, 2000, 6000, 4000, 12000, 80,
+    { EXPR_HAPPY, EXPR_EXCITED, EXPR_SURPRISED, EXPR_LOVE, EXPR_PROUD } },
+
+  // GRUMPY: annoyed but still chatty and expressive
+  { "Grumpy", 45000, 120000, 240000, 6000, 18000, 10000, 30000, 60,
+    { EXPR_ANGRY, EXPR_ANNOYED, EXPR_MISCHIEF, EXPR_SKEPTICAL, EXPR_ANGRY } },
+
+  // SLEEPY: drowsy but still talks a bit
+  { "Sleepy", 30000, 60000, 120000, 10000, 25000, 15000, 40000, 30,
+    { EXPR_SLEEPY, EXPR_BLISS, EXPR_NEUTRAL, EXPR_THINKING, EXPR_SHY } },
+};
+
+// ============================================================================
+// Bot Mode State
+// ============================================================================
+
+struct BotModeState {
+  BotState state;
+  BotFaceState face;
+  BotBlinkState blink;
+  BotLookAround lookAround;
+  BotIMUTracker imuTracker;
+
+  // Overlays
+  BotSpeechBubble speechBubble;
+  BotNotification notification;
+  BotTimeOverlay timeOverlay;
+  BotWeatherOverlay weatherOverlay;
+
+  // Timing (botNowMs — idle expressions, sayings and timeouts are
+  // scheduler events, see bot_scheduler.h)
+  uint64_t lastInteraction;          // Last touch/shake event
+  uint64_t stateEnteredTime;         // When current state was entered
+
+  // Sleeping animation
+  float sleepBreathPhase;            // Breathing animation phase
+  unsigned long lastZzzTime;         // Zzz particle timing
+
+  // Shake reaction (ended by EV_REACT_END)
+  bool shakeReacting;
+
+  // Personality
+  uint8_t personalityIndex;
+  const BotPersonality* personality;
+
+  // Custom saying from web
+  char customSaying[32];
+  bool hasCustomSaying;
+
+  bool initialized;
+
+  void init() {
+    state = BOT_ACTIVE;
+    face.init();
+    blink.init();
+    lookAround.init();
+    imuTracker.init();
+    speechBubble.init();
+    notification.init();
+    timeOverlay.init();
+    weatherOverlay.init();
+    personalityIndex = PERSONALITY_CHILL;
+    personality = &botPersonalities[PERSONALITY_CHILL];
+    lastInteraction = botNowMs();
+    stateEnteredTime = lastInteraction;
+    botScheduler.clear();
+    botScheduler.schedule(EV_BLINK, blink.nextInterval());
+    botScheduler.schedule(EV_LOOK, lookAround.firstInterval());
+    scheduleIdleBehavior();
+    scheduleStateTimeout();
+    sleepBreathPhase = 0;
+    lastZzzTime = 0;
+    shakeReacting = false;
+    hasCustomSaying = false;
+    customSaying[0] = '\0';
+    initialized = true;
+  }
+
+  // Next idle expression change and idle saying (personality-driven)
+  void scheduleIdleBehavior() {
+    botScheduler.schedule(EV_IDLE_EXPR, random(personality->exprMinMs, personality->exprMaxMs));
+    botScheduler.schedule(EV_IDLE_SAYING, random(personality->sayMinMs, personality->sayMaxMs));
+  }
+
+  // Next activity-state check, measured from the last interaction
+  void scheduleStateTimeout() {
+    uint32_t timeoutMs;
+    switch (state) {
+      case BOT_ACTIVE: timeoutMs = personality->idleTimeoutMs; break;
+      case BOT_IDLE:   timeoutMs = personality->sleepyTimeoutMs; break;
+      case BOT_SLEEPY: timeoutMs = personality->sleepTimeoutMs; break;
+      default:
+        botScheduler.cancel(EV_STATE_TIMEOUT);  // Sleeping: woken by motion
+        return;
+    }
+    botScheduler.scheduleAt(EV_STATE_TIMEOUT, lastInteraction + timeoutMs + 1);
+  }
+
+  // Hold a reaction expression, then return to neutral
+  void react(uint32_t durationMs) {
+    shakeReacting = true;
+    botScheduler.schedule(EV_REACT_END, durationMs);
+  }
+
+  void enterState(BotState newState) {
+    state = newState;
+    stateEnteredTime = botNowMs();
+    scheduleStateTimeout();
+  }
+
+  // Register an interaction (resets idle timers)
+  void registerInteraction() {
+    lastInteraction = botNowMs();
+    if (state != BOT_ACTIVE) {
+      wake();
+    } else {
+      scheduleStateTimeout();
+    }
+  }
+
+  // Wake from any sleep/idle state
+  void wake() {
+    if (state == BOT_SLEEPING || state == BOT_SLEEPY) {
+      // Wake-up: startled, happy, then settle back to neutral
+      face.playTimeline(TL_WAKE_UP);
+      react(face.timelineDurationMs(TL_WAKE_UP));
+
+      // Show wake-up saying
+      char buf[32];
+      getRandomSayingText(SAY_WAKE, buf, sizeof(buf));
+      speechBubble.show(buf, 2000);
+    }
+    lastInteraction = botNowMs();
+    enterState(BOT_ACTIVE);
+    scheduleIdleBehavior();
+  }
+
+  // Called when bot receives a tap
+  void onTap() {
+    registerInteraction();
+
+    // Pick a random reaction: a snappy expression or a short timeline
+    uint8_t reactions[] = { EXPR_SURPRISED, EXPR_HAPPY, EXPR_EXCITED, EXPR_MISCHIEF, EXPR_LOVE, EXPR_SHY, EXPR_CONFUSED, EXPR_PROUD };
+    uint8_t pick = random(0, 10);
+    uint32_t reactMs = 2000;
+    if (pick < 8) {
+      face.transitionTo(reactions[pick], 150, EASE_OVERSHOOT);
+    } else {
+      uint8_t tl = (pick == 8) ? TL_GIGGLE : TL_DOUBLE_TAKE;
+      face.playTimeline(tl);
+      reactMs = face.timelineDurationMs(tl);
+    }
+
+    // Maybe show a tap saying
+    if (random(100) < personality->sayChancePercent) {
+      char buf[32];
+      getRandomSayingText(SAY_REACT_TAP, buf, sizeof(buf));
+      speechBubble.show(buf, 2500);
+    }
+
+    // Schedule return to neutral
+    react(reactMs);
+  }
+
+  // Called on a double tap on the screen (after the first tap's reaction)
+  void onDoubleTap() {
+    registerInteraction();
+    face.playTimeline(TL_GIGGLE);
+    react(face.timelineDurationMs(TL_GIGGLE));
+  }
+
+  // Fall asleep right away (placed face down)
+  void sleep() {
+    if (state == BOT_SLEEPING) return;
+    face.transitionTo(EXPR_SLEEPY, 600);
+    enterState(BOT_SLEEPING);
+  }
+
+  // Called on strong shake
+  void onShake() {
+    registerInteraction();
+    face.playTimeline(TL_DIZZY);
+
+    // Show shake saying
+    char buf[32];
+    getRandomSayingText(SAY_REACT_SHAKE, buf, sizeof(buf));
+    speechBubble.show(buf, 2500);
+
+    react(face.timelineDurationMs(TL_DIZZY));
+  }
+
+  // Set expression from external source (web UI, etc.)
+  void setExpression(uint16_t exprIndex, uint16_t duration = 0) {
+    registerInteraction();
+    face.transitionTo(exprIndex, duration);
+    shakeReacting = false;
+  }
+
+  // Show a custom saying (from web UI)
+  void showSaying(const char* text, uint16_t durationMs = 4000) {
+    registerInteraction();
+    speechBubble.show(text, durationMs);
+  }
+
+  // Show a notification banner
+  void showNotification(const char* text, uint16_t durationMs = 2500) {
+    notification.show(text, durationMs);
+  }
+};
+
+// Global bot mode state
+BotModeState botMode;
+
+// ============================================================================
+// IMU gestures (imu_gestures.h)
+// ============================================================================
+// A shake stroke makes the bot dizzy and a knock-knock (double tap) counts as
+// a tap. Single IMU taps only register interaction — touching the screen
+// produces them too. Face down puts the bot to sleep, face up wakes it.
+
+void botHandleGesture(const GestureEvent &ev) {
+  if (!botMode.initialized) return;
+  switch (ev.type) {
+    case GEST_SHAKE:
+      if (!botMode.shakeReacting) botMode.onShake();
+      break;
+    case GEST_DOUBLE_TAP:
+      botMode.onTap();
+      break;
+    case GEST_TAP:
+      botMode.registerInteraction();
+      break;
+    case GEST_FACE_DOWN:
+      botMode.sleep();
+      break;
+    case GEST_FACE_UP:
+      botMode.wake();
+      break;
+    default:
+      break;
+  }
+}
+
+// ============================================================================
+// Bot Mode Update (called each frame when in Bot Mode)
+// ============================================================================
+
+// Activity-state timeout: step ACTIVE -> IDLE -> SLEEPY -> SLEEPING
+void onBotStateTimeout(uint64_t now) {
+  uint64_t timeSinceInteraction = now - botMode.lastInteraction;
+  const BotPersonality* p = botMode.personality;
+  switch (botMode.state) {
+    case BOT_ACTIVE:
+    case BOT_IDLE:
+      if (timeSinceInteraction > p->sleepyTimeoutMs) {
+        botMode.enterState(BOT_SLEEPY);
+        botMode.face.transitionTo(EXPR_SLEEPY, 1000);
+
+        char buf[32];
+        getRandomSayingText(SAY_SLEEP, buf, sizeof(buf));
+        botMode.speechBubble.show(buf, 3000);
+      } else if (timeSinceInteraction > p->idleTimeoutMs && botMode.state != BOT_IDLE) {
+        botMode.enterState(BOT_IDLE);
+      } else {
+        botMode.scheduleStateTimeout();
+      }
+      break;
+
+    case BOT_SLEEPY:
+      if (timeSinceInteraction > p->sleepTimeoutMs) {
+        botMode.enterState(BOT_SLEEPING);
+      } else {
+        botMode.scheduleStateTimeout();
+      }
+      break;
+
+    case BOT_SLEEPING:
+      break;
+  }
+}
+
+// Handle one due behavior event
+void handleBotEvent(uint8_t id, uint64_t now) {
+  const BotPersonality* p = botMode.personality;
+  switch (id) {
+    case EV_STATE_TIMEOUT:
+      onBotStateTimeout(now);
+      break;
+
+    case EV_REACT_END:
+      // Reaction over — return to neutral
+      botMode.shakeReacting = false;
+      if (botMode.state == BOT_ACTIVE) {
+        botMode.face.transitionTo(EXPR_NEUTRAL, 400);
+      }
+      break;
+
+    case EV_IDLE_EXPR:
+      if (botMode.state != BOT_ACTIVE || botMode.shakeReacting) {
+        botScheduler.schedule(EV_IDLE_EXPR, BOT_EVENT_RETRY_MS);
+        break;
+      }
+      {
+        uint16_t pick;
+        if (random(100) < 35) {
+          // 35% chance: pick from full expression range (incl. pack) for variety
+          pick = random(0, botExpressionCount());
+        } else {
+          // 65% chance: pick from personality favorites
+          pick = p->favoriteExprs[random(0, 5)];
+        }
+        botMode.face.transitionTo(pick, 500);
+      }
+      botScheduler.schedule(EV_IDLE_EXPR, random(p->exprMinMs, p->exprMaxMs));
+      break;
+
+    case EV_IDLE_SAYING:
+      if ((botMode.state != BOT_ACTIVE && botMode.state != BOT_IDLE) ||
+          botMode.speechBubble.active) {
+        botScheduler.schedule(EV_IDLE_SAYING, BOT_EVENT_RETRY_MS);
+        break;
+      }
+      {
+        char buf[32];
+        getRandomSayingText(SAY_IDLE, buf, sizeof(buf));
+        botMode.speechBubble.show(buf, 3500);
+      }
+      botScheduler.schedule(EV_IDLE_SAYING, random(p->sayMinMs, p->sayMaxMs));
+      break;
+
+    case EV_BLINK:
+      // Next one is scheduled when this blink finishes
+      if (botMode.state != BOT_SLEEPING && botMode.face.eyeMode == EYE_NORMAL) {
+        botMode.blink.start(now);
+      } else {
+        botScheduler.schedule(EV_BLINK, BOT_EVENT_RETRY_MS);
+      }
+      break;
+
+    case EV_LOOK:
+      if ((botMode.state == BOT_ACTIVE || botMode.state == BOT_IDLE) &&
+          !botMode.shakeReacting) {
+        botMode.lookAround.start(now);
+      } else {
+        botScheduler.schedule(EV_LOOK, BOT_EVENT_RETRY_MS);
+      }
+      break;
+  }
+}
+
+void updateBotMode() {
+  if (!botMode.initialized) {
+    botMode.init();
+  }
+
+  uint64_t now = botNowMs();
+
+  // Skip if menu is visible
+  if (menuVisible) return;
+
+  // ---- Behavior events that are due (nothing else is polled) ----
+  int16_t ev;
+  while ((ev = botScheduler.popDue(now)) >= 0) {
+    handleBotEvent(ev, now);
+  }
+
+  // ---- Sleeping: wake-up via motion ----
+  if (botMode.state == BOT_SLEEPING) {
+    if (accelPeak > BOT_WAKE_THRESHOLD) {
+      botMode.wake();
+    }
+  }
+
+  // ---- Update animation systems ----
+
+  // Blink (not while sleeping or during special eye modes)
+  if (botMode.state != BOT_SLEEPING &&
+      botMode.face.eyeMode == EYE_NORMAL) {
+    bool wasBlinking = botMode.blink.blinking;
+    botMode.face.blinkAmount = botMode.blink.update(now);
+    if (wasBlinking && !botMode.blink.blinking) {
+      botScheduler.schedule(EV_BLINK, botMode.blink.nextInterval());
+    }
+  } else if (botMode.state == BOT_SLEEPING) {
+    botMode.face.blinkAmount = 0.0f;  // Don't squish — EYE_CLOSED handles it
+    botMode.face.eyeMode = EYE_CLOSED;
+  }
+
+  // Look-around (only when active or idle, and not reacting)
+  int16_t lookX = 0, lookY = 0;
+  if ((botMode.state == BOT_ACTIVE || botMode.state == BOT_IDLE) &&
+      !botMode.shakeReacting) {
+    bool wasMoving = botMode.lookAround.moving;
+    botMode.lookAround.update(now, lookX, lookY);
+    if (wasMoving && !botMode.lookAround.moving) {
+      botScheduler.schedule(EV_LOOK, botMode.lookAround.nextInterval());
+    }
+  }
+
+  // IMU tilt tracking (shared orientation estimate, sampled at frame time)
+  int16_t tiltX = 0, tiltY = 0;
+  if (botMode.state != BOT_SLEEPING && imuOrient.primed) {
+    botMode.imuTracker.update(imuOrient.upX(), imuOrient.upY(), tiltX, tiltY);
+  }
+
+  // Dynamic pupil offsets — look-around plus tilt
+  const int16_t maxOffset = (int16_t)BotIMUTracker::MAX_OFFSET;
+  botMode.face.dynamicPupilX = constrain(lookX + tiltX, -maxOffset, maxOffset);
+  botMode.face.dynamicPupilY = constrain(lookY + tiltY, -maxOffset, maxOffset);
+
+  // Update expression transition
+  botMode.face.update();
+
+  // Update overlays
+  botMode.speechBubble.update();
+  botMode.notification.update();
+  botMode.weatherOverlay.update();
+
+  // Mouth flaps while the bubble types out
+  botMode.face.talkOpen = (botMode.state == BOT_SLEEPING) ? 0 : botMode.speechBubble.talkOpen();
+}
+
+// ============================================================================
+// Bot Mode Render (called each frame after update)
+// ============================================================================
+
+// ============================================================================
+// Frame composition — eliminates ALL flicker
+// ============================================================================
+// Instead of drawing directly to the screen (which flickers when elements are
+// erased then redrawn), each frame is recorded into botDL and every pixel is
+// written to the panel exactly once:
+//  - BOT_BAND_RENDER: the list is rasterized into 20-row bands (~28KB RAM),
+//    and only bands whose ops changed since the last push are sent.
+//  - Otherwise: the list is rasterized into a full-screen Arduino_Canvas
+//    (134KB each). Needed for hi-res ambient.
+// Both paths double-buffer: botPresenter flushes one buffer on the other core
+// while the next one is rendered (see bot_present.h).
+
+#if !defined(BOT_BAND_RENDER)
+static Arduino_Canvas *botCanvas[2] = { nullptr, nullptr };
+#endif
+static Arduino_GFX *gfxReal = nullptr;   // The actual hardware display
+static bool botFirstFrame = true;        // Panel was cleared/overdrawn — flush next frame
+static bool botFrameRequested = false;   // Render on the next pass regardless of rate
+static uint32_t botLastFrameHash = 0;    // Hash of the frame on the panel
+static uint64_t botLastRender = 0;       // botNowMs of the last rendered frame
+
+// Hash of the recorded frame, including things the list only references
+uint32_t botFrameHash() {
+  uint32_t h = botSprites.frameStamp(botDL.hash());
+  h = (h ^ botBackground.pixelVersion) * 16777619UL;
+  return h;
+}
+
+void renderBotMode() {
+  if (gfx == nullptr) return;
+  if (menuVisible) return;
+
+  #if !defined(BOT_BAND_RENDER)
+  // ---- Initialize canvases on first use (framebuffers go to PSRAM if present) ----
+  if (botCanvas[0] == nullptr) {
+    gfxReal = gfx;  // Save the real display pointer
+    for (uint8_t i = 0; i < 2; i++) {
+      botCanvas[i] = new Arduino_Canvas(LCD_WIDTH, LCD_HEIGHT, gfxReal);
+      botCanvas[i]->begin();
+    }
+    botPresenter.begin(gfxReal, botCanvas[0]->getFramebuffer(), botCanvas[1]->getFramebuffer());
+  }
+
+  // Wait for the back canvas to finish flushing, then swap gfx to it —
+  // hi-res ambient effects draw to the offscreen buffer
+  botPresenter.acquire();
+  Arduino_Canvas *canvas = botCanvas[botPresenter.back];
+  gfx = canvas;
+  #endif
+
+  uint32_t recordStart = micros();
+  botDL.clear();
+  botSprites.beginFrame();
+
+  // ---- Background layer (replayed unless due at its own rate) ----
+  #if defined(BOT_BAND_RENDER)
+  uint16_t bgColor = botBackground.render(nullptr);
+  #else
+  uint16_t bgColor = botBackground.render(canvas);
+  #endif
+
+  // Since we redraw everything fresh each frame, skip the old targeted-erase logic
+  prevFrame.invalidate();
+
+  // ---- Render the face ----
+  renderBotFace(botMode.face, bgColor);
+
+  // ---- Sleeping: draw Zzz animation ----
+  if (botMode.state == BOT_SLEEPING) {
+    unsigned long now = millis();
+    float t = (float)(now % 3000) / 3000.0f;
+
+    int16_t zBaseX = BOT_FACE_CX + 50;
+    int16_t zBaseY = BOT_FACE_CY - 40;
+
+    botDL.setTextColor(botFaceColor);
+
+    for (int i = 0; i < 3; i++) {
+      float phase = fmodf(t + i * 0.33f, 1.0f);
+      int16_t zx = zBaseX + i * 12 + (int16_t)(sinf(phase * PI * 2) * 4);
+      int16_t zy = zBaseY - (int16_t)(phase * 50);
+
+      if (phase < 0.8f) {
+        botDL.setCursor(zx, zy);
+        botDL.setTextSize(1 + i);
+        botDL.print("Z");
+      }
+    }
+  }
+
+  // ---- Sleepy: slow blink animation ----
+  if (botMode.state == BOT_SLEEPY) {
+    float t = (float)(millis() % 4000) / 4000.0f;
+    botMode.face.blinkAmount = 0.3f + 0.4f * (sinf(t * TWO_PI) * 0.5f + 0.5f);
+  }
+
+  // ---- Render overlays (on top of face) ----
+  botMode.speechBubble.render();
+  botMode.notification.render();
+  botMode.timeOverlay.render();
+  botMode.weatherOverlay.render();
+
+  botPresenter.stats.recordUs += micros() - recordStart;
+
+  // ---- Identical to what's on the panel: skip raster and flush ----
+  uint32_t frameHash = botFrameHash();
+  if (!botFirstFrame && frameHash == botLastFrameHash) {
+    #if !defined(BOT_BAND_RENDER)
+    botPresenter.release();
+    gfx = gfxReal;
+    #endif
+    botPresenter.stats.skipped++;
+    if (botPresenter.stats.report()) {
+      botSprites.report();
+      botBackground.report();
+      i2cBus.report();
+    }
+    return;
+  }
+  botLastFrameHash = frameHash;
+
+  // ---- Write every changed pixel once — zero flicker ----
+  #if defined(BOT_BAND_RENDER)
+  botPresentBands(gfx, botFirstFrame);
+  #else
+  uint32_t rasterStart = micros();
+  botDL.rasterize(canvas->getFramebuffer(), 0, LCD_HEIGHT);
+  botPresenter.stats.rasterUs += micros() - rasterStart;
+  for (int16_t y = 0; y < LCD_HEIGHT; y += BOT_BAND_ROWS) {
+    int16_t rows = min((int16_t)BOT_BAND_ROWS, (int16_t)(LCD_HEIGHT - y));
+    botHashBand(canvas->getFramebuffer() + (uint32_t)y * LCD_WIDTH, y, rows);
+  }
+  botPresenter.submit(0, LCD_HEIGHT);
+
+  // Restore real display pointer
+  gfx = gfxReal;
+  #endif
+  botFirstFrame = false;
+
+  botPresenter.stats.frames++;
+  if (botPresenter.stats.report()) {
+    botSprites.report();
+    botBackground.report();
+    i2cBus.report();
+  }
+}
+
+// ============================================================================
+// Bot Mode Entry/Exit
+// ============================================================================
+
+void enterBotMode() {
+  botFirstFrame = true;
+  prevFrame.invalidate();
+  botBackground.invalidate();
+
+  if (!botMode.initialized) {
+    botMode.init();
+
+    // Show greeting on first entry
+    char buf[32];
+    getRandomSayingText(SAY_GREETING, buf, sizeof(buf));
+    botMode.speechBubble.show(buf, 2500);
+  } else {
+    // Re-entering bot mode: reset to active
+    botMode.lastInteraction = botNowMs();
+    botMode.enterState(BOT_ACTIVE);
+    botMode.face.transitionTo(EXPR_HAPPY, 300);
+    botMode.react(1500);
+
+    char buf[32];
+    getRandomSayingText(SAY_GREETING, buf, sizeof(buf));
+    botMode.speechBubble.show(buf, 2000);
+  }
+
+  // Clear the actual screen (use real display, not canvas)
+  botFlushWait();
+  Arduino_GFX *screen = (gfxReal != nullptr) ? gfxReal : gfx;
+  if (screen != nullptr) {
+    screen->fillScreen(BOT_COLOR_BG);
+  }
+}
+
+void exitBotMode() {
+  // Let the last frame land, then restore gfx to real display
+  botFlushWait();
+  if (gfxReal != nullptr) {
+    gfx = gfxReal;
+  }
+  if (gfx != nullptr) {
+    gfx->fillScreen(BOT_COLOR_BG);
+  }
+}
+
+// ============================================================================
+// Combined Bot Mode loop function (update + render)
+// ============================================================================
+
+// Render interval by activity state. Short animations (transitions,
+// blinks, looks, tilt tracking, overlays) always get the full rate so they
+// stay smooth.
+uint32_t botFrameIntervalMs() {
+  const BotFaceState &f = botMode.face;
+  if (f.transitioning || f.playingTimeline() || botMode.blink.blinking ||
+      botMode.lookAround.moving || botMode.imuTracker.moving ||
+      botMode.speechBubble.active ||
+      botMode.notification.active) {
+    return BOT_FRAME_DELAY_MS;
+  }
+  switch (botMode.state) {
+    case BOT_IDLE:
+    case BOT_SLEEPY:    return 1000 / BOT_FPS_IDLE;
+    case BOT_SLEEPING:  return 1000 / BOT_FPS_SLEEPING;
+    default:            return BOT_FRAME_DELAY_MS;
+  }
+}
+
+// Force the next frame to be flushed (panel was drawn over, e.g. menu)
+void botInvalidateFrame() {
+  botFirstFrame = true;
+}
+
+// Render on the next pass instead of waiting for the frame interval, so a
+// reaction to input shows up immediately
+void botRequestFrame() {
+  botFrameRequested = true;
+}
+
+// A frame was requested and should be drawn without waiting out the rate
+bool botFramePending() {
+  return botFrameRequested;
+}
+
+// Behavior runs every loop pass (it's event-driven and cheap); frames are
+// rendered at the state's rate. An interaction switches the state back to
+// ACTIVE, so the same pass renders at full rate again.
+void runBotMode() {
+  uint32_t t0 = micros();
+  updateBotMode();
+  botPresenter.stats.updateUs += micros() - t0;
+
+  uint64_t now = botNowMs();
+  if (!botFirstFrame && !botFrameRequested && now - botLastRender < botFrameIntervalMs()) return;
+  botFrameRequested = false;
+  botLastRender = now;
+  renderBotMode();
+}
+
+// Loop delay: until the next frame or behavior event, but never longer
+// than one input poll
+uint32_t botFrameDelayMs() {
+  if (!botMode.initialized || menuVisible) return BOT_FRAME_DELAY_MS;
+  uint64_t now = botNowMs();
+  uint32_t interval = botFrameIntervalMs();
+  uint64_t sinceRender = now - botLastRender;
+  uint32_t untilFrame = sinceRender >= interval ? 0 : (uint32_t)(interval - sinceRender);
+  uint32_t wait = min(untilFrame, botScheduler.msUntilNext(now, BOT_INPUT_POLL_MS));
+  return max(wait, (uint32_t)1);  // Always yield to the idle task
+}
+
+// ============================================================================
+// Bot Mode accessors for web/touch control
+// ============================================================================
+
+uint16_t getBotExpression() {
+  return botMode.face.targetExpr;
+}
+
+uint8_t getBotState() {
+  return (uint8_t)botMode.state;
+}
+
+void setBotExpression(uint16_t index) {
+  botMode.setExpression(index);
+}
+
+void setBotFaceColor(uint16_t color) {
+  botFaceColor = color;
+}
+
+void setBotBackgroundStyle(uint8_t style) {
+  botBackgroundStyle = style;
+}
+
+uint8_t getBotBackgroundStyle() {
+  return botBackgroundStyle;
+}
+
+void showBotSaying(const char* text, uint16_t durationMs) {
+  botMode.showSaying(text, durationMs);
+}
+
+void toggleBotTimeOverlay() {
+  botMode.timeOverlay.enabled = !botMode.timeOverlay.enabled;
+}
+
+bool isBotTimeOverlayEnabled() {
+  return botMode.timeOverlay.enabled;
+}
+
+void setBotPersonality(uint8_t index) {
+  if (index >= BOT_NUM_PERSONALITIES) index = 0;
+  botMode.personalityIndex = index;
+  botMode.personality = &botPersonalities[index];
+  botMode.registerInteraction();
+
+  // Show notification
+  char buf[32];
+  snprintf(buf, sizeof(buf), "Personality: %s", botMode.personality->name);
+  botMode.showNotification(buf, 2000);
+}
+
+uint8_t getBotPersonality() {
+  return botMode.personalityIndex;
+}
+
+void setBotWeatherEnabled(bool enabled) {
+  botMode.weatherOverlay.enabled = enabled;
+}
+
+void setBotWeatherLocation(float lat, float lon) {
+  botMode.weatherOverlay.setLocation(lat, lon);
+}
+
+#else
+
+// Stubs when LCD is not available
+inline void runBotMode() {}
+inline uint32_t botFrameDelayMs() { return 33; }
+inline void botInvalidateFrame() {}
+inline void botRequestFrame() {}
+inline bool botFramePending() { return false; }
+inline void enterBotMode() {}
+inline void exitBotMode() {}
+inline void setBotExpression(uint16_t index) {}
+inline void setBotFaceColor(uint16_t color) {}
+inline void showBotSaying(const char* text, uint16_t durationMs) {}
+inline void toggleBotTimeOverlay() {}
+inline bool isBotTimeOverlayEnabled() { return false; }
+inline void setBotPersonality(uint8_t index) {}
+inline uint8_t getBotPersonality() { return 0; }
+inline void setBotWeatherEnabled(bool enabled) {}
+inline void setBotWeatherLocation(float lat, float lon) {}
+inline void setBotBackgroundStyle(uint8_t style) {}
+inline uint8_t getBotBackgroundStyle() { return 0; }
+
+#endif // DISPLAY_LCD_ONLY || DISPLAY_DUAL
+
+#endif // BOT_MODE_H
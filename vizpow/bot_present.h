@@ -0,0 +1,250 @@
+#ifndef BOT_PRESENT_H
+#define BOT_PRESENT_H
+
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include "config.h"
+#include "bot_display_list.h"
+
+// ============================================================================
+// Bot Present — double-buffered, cross-core flush
+// ============================================================================
+// The main loop fills one buffer while a flush task pinned to the other
+// core pushes the previous buffer over SPI. Each buffer has a "free"
+// semaphore that acts as the fence: the renderer takes it before touching
+// the buffer, the flush task gives it back once the transfer is done.
+//
+// What overlaps the flush depends on the build:
+//  - Band builds double-buffer 20-row bands. There is one botDL, so update
+//    and record run before any band of the frame is pushed; only rasterizing
+//    band N overlaps the transfer of band N-1 (and the last band's transfer
+//    overlaps the next update). Frame time is about
+//    update + record + max(raster, flush).
+//  - Canvas builds double-buffer two full-screen canvases (one of them may
+//    live in PSRAM), so the whole next frame — update, record and raster —
+//    overlaps the transfer: about max(update + record + raster, flush).
+//
+// Anything else drawing straight to the panel (menu, mode exit) must call
+// botPresenter.waitIdle() first so it doesn't race the flush task.
+// ============================================================================
+
+#define BOT_FLUSH_CORE        0     // Arduino loop() runs on core 1
+#define BOT_FLUSH_PRIORITY    2
+#define BOT_FLUSH_STACK       3072
+#define BOT_STATS_INTERVAL_MS 5000  // Stage timing report period (DEBUG_SERIAL)
+
+struct BotFlushJob {
+  uint8_t slot;
+  int16_t y;
+  int16_t rows;
+};
+
+// Per-stage timings, accumulated in microseconds and reported as averages.
+// "wait" is time the renderer stalled on a fence, i.e. flush time the
+// overlapping stages didn't hide. "est" is the frame time the overlap above
+// predicts, to compare against fps.
+struct BotFrameStats {
+  uint32_t frames;
+  uint32_t updateUs;
+  uint32_t recordUs;
+  uint32_t rasterUs;
+  uint32_t waitUs;       // Renderer stalled on the fence
+  uint32_t flushTotalUs; // Running total, stored only by the flusher
+  uint32_t flushBaseUs;  // flushTotalUs at the last reset
+  uint32_t skipped;      // Frames identical to the panel, not flushed
+  uint32_t bands;        // Bands pushed (band builds skip unchanged ones)
+  unsigned long lastReport;
+
+  // The flush task never sees a reset: it keeps its own total and
+  // publishes it with one store, and reset() moves the baseline instead
+  void publishFlush(uint32_t total) {
+    __atomic_store_n(&flushTotalUs, total, __ATOMIC_RELAXED);
+  }
+
+  uint32_t flushUs() const {
+    return __atomic_load_n(&flushTotalUs, __ATOMIC_RELAXED) - flushBaseUs;
+  }
+
+  void reset() {
+    frames = updateUs = recordUs = rasterUs = waitUs = skipped = bands = 0;
+    flushBaseUs = __atomic_load_n(&flushTotalUs, __ATOMIC_RELAXED);
+  }
+
+  // Print averages once per interval; true when a report was printed
+  bool report() {
+    unsigned long now = millis();
+    if (now - lastReport < BOT_STATS_INTERVAL_MS) return false;
+    if (frames > 0 || skipped > 0) {
+      uint32_t n = frames > 0 ? frames : 1;
+      (void)n;  // Only read by DBG
+      DBG("bot us/frame upd "); DBG(updateUs / n);
+      DBG(" rec "); DBG(recordUs / n);
+      DBG(" ras "); DBG(rasterUs / n);
+      DBG(" wait "); DBG(waitUs / n);
+      DBG(" flush "); DBG(flushUs() / n);
+      #if defined(BOT_BAND_RENDER)
+      DBG(" est "); DBG((updateUs + recordUs + max(rasterUs, flushUs())) / n);
+      #else
+      DBG(" est "); DBG(max(updateUs + recordUs + rasterUs, flushUs()) / n);
+      #endif
+      DBG(" fps "); DBG(frames * 1000UL / (now - lastReport));
+      #if defined(BOT_BAND_RENDER)
+      DBG(" bands "); DBG(bands / n);
+      #endif
+      DBG(" skip "); DBGLN(skipped);
+    }
+    reset();
+    lastReport = now;
+    return true;
+  }
+};
+
+struct BotPresenter {
+  Arduino_GFX *screen;
+  uint16_t *buf[2];
+  SemaphoreHandle_t freeSem[2];
+  QueueHandle_t jobs;
+  TaskHandle_t task;
+  uint8_t back;          // Buffer the renderer fills next
+  bool started;
+  BotFrameStats stats;
+
+  static void flushTask(void *arg) {
+    BotPresenter *self = (BotPresenter *)arg;
+    BotFlushJob job;
+    uint32_t flushed = self->stats.flushTotalUs;  // Picks up inline flushes
+    for (;;) {
+      if (xQueueReceive(self->jobs, &job, portMAX_DELAY) != pdTRUE) continue;
+      uint32_t t0 = micros();
+      const uint16_t *src = self->buf[job.slot];
+      self->screen->draw16bitRGBBitmap(0, job.y, (uint16_t *)src, LCD_WIDTH, job.rows);
+      flushed += micros() - t0;
+      self->stats.publishFlush(flushed);
+      xSemaphoreGive(self->freeSem[job.slot]);
+    }
+  }
+
+  // Start the flush task. Falls back to synchronous flushes on failure.
+  void begin(Arduino_GFX *out, uint16_t *buf0, uint16_t *buf1) {
+    screen = out;
+    buf[0] = buf0;
+    buf[1] = buf1;
+    back = 0;
+    stats.reset();
+    stats.lastReport = millis();
+    if (started) return;
+
+    jobs = xQueueCreate(2, sizeof(BotFlushJob));
+    freeSem[0] = xSemaphoreCreateBinary();
+    freeSem[1] = xSemaphoreCreateBinary();
+    if (jobs == nullptr || freeSem[0] == nullptr || freeSem[1] == nullptr) return;
+    xSemaphoreGive(freeSem[0]);
+    xSemaphoreGive(freeSem[1]);
+    started = xTaskCreatePinnedToCore(flushTask, "botFlush", BOT_FLUSH_STACK, this,
+                                      BOT_FLUSH_PRIORITY, &task, BOT_FLUSH_CORE) == pdPASS;
+    if (!started) DBGLN("Bot flush task failed - flushing inline");
+  }
+
+  // Wait until the back buffer has been flushed, then hand it out
+  uint16_t *acquire() {
+    if (started) {
+      uint32_t t0 = micros();
+      xSemaphoreTake(freeSem[back], portMAX_DELAY);
+      stats.waitUs += micros() - t0;
+    }
+    return buf[back];
+  }
+
+  // Queue the back buffer for transfer and flip to the other one
+  void submit(int16_t y, int16_t rows) {
+    if (started) {
+      BotFlushJob job = { back, y, rows };
+      xQueueSend(jobs, &job, portMAX_DELAY);
+    } else {
+      uint32_t t0 = micros();
+      screen->draw16bitRGBBitmap(0, y, buf[back], LCD_WIDTH, rows);
+      stats.publishFlush(stats.flushTotalUs + (micros() - t0));  // No task yet
+    }
+    back ^= 1;
+  }
+
+  // Give back an acquired buffer without flushing it (skipped frame)
+  void release() {
+    if (started) xSemaphoreGive(freeSem[back]);
+  }
+
+  // Fence: block until both buffers are back from the flush task
+  void waitIdle() {
+    if (!started) return;
+    for (uint8_t i = 0; i < 2; i++) xSemaphoreTake(freeSem[i], portMAX_DELAY);
+    for (uint8_t i = 0; i < 2; i++) xSemaphoreGive(freeSem[i]);
+  }
+};
+
+BotPresenter botPresenter = {};
+
+// Called before direct panel drawing outside bot rendering (menu, exits)
+void botFlushWait() {
+  botPresenter.waitIdle();
+}
+
+#define BOT_BANDS ((LCD_HEIGHT + BOT_BAND_ROWS - 1) / BOT_BAND_ROWS)
+
+// Pixel hash of each band as last pushed, so an input trace can check bot
+// frames the way it checks leds[]. Kept only while botHashBands is set
+// (trace recording or replay): hashing costs about as much as rasterizing.
+bool botHashBands = false;
+static uint32_t botPanelBands[BOT_BANDS];
+
+void botHashBand(const uint16_t *px, int16_t y, int16_t rows) {
+  if (!botHashBands) return;
+  const uint8_t *bytes = (const uint8_t *)px;
+  uint32_t h = 2166136261UL;
+  for (uint32_t i = 0; i < (uint32_t)LCD_WIDTH * rows * 2; i++) h = (h ^ bytes[i]) * 16777619UL;
+  botPanelBands[y / BOT_BAND_ROWS] = h;
+}
+
+// Hash of what's on the panel, from the band hashes above
+uint32_t botPanelHash() {
+  uint32_t h = 2166136261UL;
+  for (uint8_t b = 0; b < BOT_BANDS; b++) h = (h ^ botPanelBands[b]) * 16777619UL;
+  return h;
+}
+
+#if defined(BOT_BAND_RENDER)
+// Two band buffers: one being rasterized, one in flight
+static uint16_t botBandBuf[2][LCD_WIDTH * BOT_BAND_ROWS];
+static uint32_t botBandHash[BOT_BANDS];  // bandHash() of each band on the panel
+
+// Rasterize the list band by band; each band overlaps the previous transfer.
+// Bands that would come out the same as what's on the panel are skipped
+// (all of them are pushed when `full`: panel cleared or drawn over).
+void botPresentBands(Arduino_GFX *screen, bool full) {
+  if (botPresenter.screen != screen) {
+    botPresenter.begin(screen, botBandBuf[0], botBandBuf[1]);
+  }
+  for (int16_t y = 0; y < LCD_HEIGHT; y += BOT_BAND_ROWS) {
+    int16_t rows = min((int16_t)BOT_BAND_ROWS, (int16_t)(LCD_HEIGHT - y));
+    uint32_t t0 = micros();
+    uint32_t h = botDL.bandHash(y, rows);
+    uint32_t &onPanel = botBandHash[y / BOT_BAND_ROWS];
+    bool changed = full || h != onPanel;
+    botPresenter.stats.rasterUs += micros() - t0;
+    if (!changed) continue;
+    onPanel = h;
+    uint16_t *band = botPresenter.acquire();
+    t0 = micros();
+    botDL.rasterize(band, y, rows);
+    botPresenter.stats.rasterUs += micros() - t0;
+    botHashBand(band, y, rows);
+    botPresenter.submit(y, rows);
+    botPresenter.stats.bands++;
+  }
+}
+#endif
+
+#endif // BOT_PRESENT_H
@@ -0,0 +1,377 @@
+#ifndef BOT_SAYINGS_H
+#define BOT_SAYINGS_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "config.h"
+
+// ============================================================================
+// Bot Sayings — Categorized Phrase Store
+// ============================================================================
+// Short text phrases displayed in speech bubbles, categorized by context:
+// greetings, idle chatter, reactions, time-based.
+//
+// All phrases live back to back in one NUL-separated string pool. An offset
+// table holds one entry per phrase, grouped by category, and catStart[]
+// marks where each category's run begins — picking a phrase is an indexed
+// lookup and a single copy into the caller's buffer.
+//
+// The store is seeded from the built-in defaults below and can be replaced
+// or appended to at runtime (web API); changes persist to LittleFS, so
+// phrase sets can be pushed to units without a firmware build.
+//
+// Text format (defaults, uploads): a "[category]" line starts a section,
+// every other non-empty line is one phrase in that section.
+// ============================================================================
+
+// Saying categories
+enum SayingCategory : uint8_t {
+  SAY_GREETING = 0,
+  SAY_IDLE,
+  SAY_REACT_SHAKE,
+  SAY_REACT_TAP,
+  SAY_TIME_MORNING,
+  SAY_TIME_AFTERNOON,
+  SAY_TIME_EVENING,
+  SAY_TIME_NIGHT,
+  SAY_STATUS,
+  SAY_WAKE,
+  SAY_SLEEP,
+  SAY_CATEGORY_COUNT
+};
+
+// Section names used in the text format, in SayingCategory order
+const char* const sayCategoryNames[SAY_CATEGORY_COUNT] = {
+  "greeting", "idle", "shake", "tap", "morning", "afternoon",
+  "evening", "night", "status", "wake", "sleep"
+};
+
+#define BOT_SAY_POOL_BYTES  2048   // String pool (defaults use ~900)
+#define BOT_SAY_MAX         160    // Phrases across all categories
+#define BOT_SAY_MAX_LEN     31     // Fits the 32-byte bubble buffers
+#define BOT_SAY_PATH        "/sayings.bin"
+#define BOT_SAY_VERSION     1
+
+// ============================================================================
+// Built-in defaults (PROGMEM)
+// ============================================================================
+
+const char sayDefaults[] PROGMEM =
+  // Greetings
+  "[greeting]\n"
+  "Hey!\n"
+  "Yo!\n"
+  "Sup?\n"
+  "Hiii~\n"
+  "Hello!\n"
+  "Hi there!\n"
+  ":)\n"
+  "Howdy!\n"
+
+  // Idle chatter
+  "[idle]\n"
+  "I'm bored...\n"
+  "Whatcha doing?\n"
+  "*yawn*\n"
+  "This is fine.\n"
+  "...\n"
+  "Hmm...\n"
+  "La la la~\n"
+  "Hello? Anyone?\n"
+  "*whistles*\n"
+  "Thinking...\n"
+  "*taps foot*\n"
+  "So quiet...\n"
+  "Beep boop\n"
+  "I like this!\n"
+  "Boop beep\n"
+  "What if...\n"
+  "*hums*\n"
+  "I wonder...\n"
+  "Hey hey!\n"
+  "Look at me!\n"
+  "*dances*\n"
+  "So shiny~\n"
+  "Ooh!\n"
+  "Heh heh\n"
+  "Fun times!\n"
+  "*bounces*\n"
+  "Nice day!\n"
+  ":D\n"
+  "Vibin~\n"
+  "*spins*\n"
+
+  // Shake reactions
+  "[shake]\n"
+  "Whoa!\n"
+  "Easy!\n"
+  "AHHH!\n"
+  "I felt that.\n"
+  "Dizzy...\n"
+  "Stop it!\n"
+  "Earthquake?!\n"
+  "*wobble*\n"
+  "Not again!\n"
+  "My head...\n"
+
+  // Tap reactions
+  "[tap]\n"
+  "Ow!\n"
+  "Hehe\n"
+  "That tickles\n"
+  "Poke.\n"
+  "Hey!\n"
+  "What?\n"
+  "Boop!\n"
+  "*squish*\n"
+  "Again?\n"
+  "I see you!\n"
+
+  // Time-based: Morning
+  "[morning]\n"
+  "Good morning!\n"
+  "Rise & shine!\n"
+  "Coffee time?\n"
+  "New day!\n"
+
+  // Time-based: Afternoon
+  "[afternoon]\n"
+  "Lunch time?\n"
+  "Half way!\n"
+  "Afternoon~\n"
+  "Keep going!\n"
+
+  // Time-based: Evening
+  "[evening]\n"
+  "Getting late...\n"
+  "Dinner time!\n"
+  "Evening~\n"
+  "Winding down\n"
+
+  // Time-based: Night
+  "[night]\n"
+  "Zzz...\n"
+  "Sleepy time\n"
+  "Night owl?\n"
+  "So late...\n"
+
+  // Status messages
+  "[status]\n"
+  "WiFi OK\n"
+  "Ready!\n"
+  "Mode changed\n"
+  "All good!\n"
+
+  // Wake-up sayings
+  "[wake]\n"
+  "I'm up!\n"
+  "Huh? What?\n"
+  "Morning...?\n"
+  "*stretches*\n"
+  "Oh! Hi!\n"
+
+  // Sleep sayings
+  "[sleep]\n"
+  "Sleepy...\n"
+  "*yawns*\n"
+  "Goodnight~\n"
+  "So tired...\n"
+  "Zzz...\n";
+
+// ============================================================================
+// Phrase store
+// ============================================================================
+
+// Persisted layout: header, catStart[], offsets[count], pool[poolUsed]
+struct __attribute__((packed)) BotSayFileHeader {
+  char magic[4];           // "BSY1"
+  uint8_t version;
+  uint8_t categories;      // SAY_CATEGORY_COUNT when written
+  uint16_t count;
+  uint16_t poolUsed;
+};
+
+struct BotSayingsStore {
+  char pool[BOT_SAY_POOL_BYTES];              // NUL-terminated phrases, back to back
+  uint16_t poolUsed;
+  uint16_t offsets[BOT_SAY_MAX];              // Pool offset per phrase, grouped by category
+  uint16_t catStart[SAY_CATEGORY_COUNT + 1];  // Category c = offsets[catStart[c]..catStart[c+1])
+  bool mounted;                               // LittleFS available for persistence
+
+  uint16_t count() const { return catStart[SAY_CATEGORY_COUNT]; }
+
+  uint16_t categoryCount(uint8_t cat) const {
+    if (cat >= SAY_CATEGORY_COUNT) return 0;
+    return catStart[cat + 1] - catStart[cat];
+  }
+
+  // Phrase i of a category (i < categoryCount)
+  const char* get(uint8_t cat, uint16_t i) const {
+    return &pool[offsets[catStart[cat] + i]];
+  }
+
+  void clearAll() {
+    poolUsed = 0;
+    memset(catStart, 0, sizeof(catStart));
+  }
+
+  // Append a phrase to a category; false if the store is full
+  bool add(uint8_t cat, const char* text, uint8_t len) {
+    if (cat >= SAY_CATEGORY_COUNT || len == 0 || len > BOT_SAY_MAX_LEN) return false;
+    if (count() >= BOT_SAY_MAX || poolUsed + len + 1 > BOT_SAY_POOL_BYTES) return false;
+
+    // Open a slot at the end of the category's run
+    uint16_t slot = catStart[cat + 1];
+    memmove(&offsets[slot + 1], &offsets[slot], (count() - slot) * sizeof(uint16_t));
+    for (uint8_t c = cat + 1; c <= SAY_CATEGORY_COUNT; c++) catStart[c]++;
+
+    offsets[slot] = poolUsed;
+    memcpy(&pool[poolUsed], text, len);
+    pool[poolUsed + len] = '\0';
+    poolUsed += len + 1;
+    return true;
+  }
+
+  // Drop a category's phrases and close the holes in the pool
+  void clearCategory(uint8_t cat) {
+    if (cat >= SAY_CATEGORY_COUNT) return;
+    uint16_t first = catStart[cat], n = categoryCount(cat);
+    if (n == 0) return;
+    memmove(&offsets[first], &offsets[first + n], (count() - first - n) * sizeof(uint16_t));
+    for (uint8_t c = cat + 1; c <= SAY_CATEGORY_COUNT; c++) catStart[c] -= n;
+    compact();
+  }
+
+  // Slide live phrases down over freed space, in pool order
+  void compact() {
+    uint16_t out = 0;
+    uint16_t n = count();
+    for (;;) {
+      int16_t next = -1;
+      for (uint16_t i = 0; i < n; i++) {
+        if (offsets[i] >= out && (next < 0 || offsets[i] < offsets[next])) next = i;
+      }
+      if (next < 0) break;
+      uint16_t len = strlen(&pool[offsets[next]]) + 1;
+      memmove(&pool[out], &pool[offsets[next]], len);
+      offsets[next] = out;
+      out += len;
+    }
+    poolUsed = out;
+  }
+
+  static int8_t categoryByName(const char* name, uint8_t len) {
+    for (uint8_t c = 0; c < SAY_CATEGORY_COUNT; c++) {
+      if (strlen(sayCategoryNames[c]) == len && strncmp(sayCategoryNames[c], name, len) == 0) return c;
+    }
+    return -1;
+  }
+
+  // Parse the text format (RAM or PROGMEM). With `replace`, each category
+  // named in the text is emptied first. Returns phrases added.
+  uint16_t loadText(const char* text, bool replace) {
+    char line[BOT_SAY_MAX_LEN + 2];
+    int8_t cat = -1;
+    uint16_t added = 0;
+    const char* p = text;
+    for (;;) {
+      // Read one line (overlong lines are truncated)
+      uint8_t len = 0;
+      char ch;
+      while ((ch = (char)pgm_read_byte(p)) != '\0' && ch != '\n') {
+        if (ch != '\r' && len < sizeof(line) - 1) line[len++] = ch;
+        p++;
+      }
+      line[len] = '\0';
+
+      if (len > 1 && line[0] == '[' && line[len - 1] == ']') {
+        cat = categoryByName(&line[1], len - 2);
+        if (cat >= 0 && replace) clearCategory(cat);
+      } else if (len > 0 && cat >= 0) {
+        if (add(cat, line, min(len, (uint8_t)BOT_SAY_MAX_LEN))) added++;
+      }
+
+      if (ch == '\0') break;
+      p++;
+    }
+    return added;
+  }
+
+  void resetDefaults() {
+    clearAll();
+    loadText(sayDefaults, false);
+  }
+
+  // ---- Persistence ----
+
+  bool save() {
+    if (!mounted) return false;
+    File f = LittleFS.open(BOT_SAY_PATH, FILE_WRITE);
+    if (!f) return false;
+    BotSayFileHeader h = { { 'B', 'S', 'Y', '1' }, BOT_SAY_VERSION, SAY_CATEGORY_COUNT, count(), poolUsed };
+    bool ok = f.write((const uint8_t*)&h, sizeof(h)) == sizeof(h) &&
+              f.write((const uint8_t*)catStart, sizeof(catStart)) == sizeof(catStart) &&
+              f.write((const uint8_t*)offsets, count() * sizeof(uint16_t)) == count() * sizeof(uint16_t) &&
+              f.write((const uint8_t*)pool, poolUsed) == poolUsed;
+    f.close();
+    return ok;
+  }
+
+  // Load the persisted store; false (store untouched) if missing or invalid
+  bool loadFile() {
+    if (!mounted) return false;
+    File f = LittleFS.open(BOT_SAY_PATH, FILE_READ);
+    if (!f) return false;
+    BotSayFileHeader h;
+    uint16_t starts[SAY_CATEGORY_COUNT + 1];
+    bool ok = f.read((uint8_t*)&h, sizeof(h)) == sizeof(h) &&
+              memcmp(h.magic, "BSY1", 4) == 0 && h.version == BOT_SAY_VERSION &&
+              h.categories == SAY_CATEGORY_COUNT && h.count <= BOT_SAY_MAX &&
+              h.poolUsed <= BOT_SAY_POOL_BYTES &&
+              f.read((uint8_t*)starts, sizeof(starts)) == sizeof(starts) &&
+              starts[0] == 0 && starts[SAY_CATEGORY_COUNT] == h.count;
+    for (uint8_t c = 0; ok && c < SAY_CATEGORY_COUNT; c++) ok = starts[c] <= starts[c + 1];
+    if (ok) {
+      ok = f.read((uint8_t*)offsets, h.count * sizeof(uint16_t)) == h.count * sizeof(uint16_t) &&
+           f.read((uint8_t*)pool, h.poolUsed) == h.poolUsed &&
+           (h.poolUsed == 0 || pool[h.poolUsed - 1] == '\0');
+    }
+    for (uint16_t i = 0; ok && i < h.count; i++) ok = offsets[i] < h.poolUsed;
+    f.close();
+    if (!ok) {
+      DBGLN("Sayings file invalid - using defaults");
+      resetDefaults();
+      return false;
+    }
+    memcpy(catStart, starts, sizeof(catStart));
+    poolUsed = h.poolUsed;
+    return true;
+  }
+
+  void begin(bool fsMounted) {
+    mounted = fsMounted;
+    if (!loadFile()) resetDefaults();
+  }
+};
+
+BotSayingsStore botSayings = {};
+
+// ============================================================================
+// Selection helpers
+// ============================================================================
+
+// Copy a random saying from a category into buffer; returns its length.
+// Empty categories fall back to idle chatter.
+uint8_t getRandomSayingText(SayingCategory category, char* buffer, uint8_t bufSize) {
+  uint16_t n = botSayings.categoryCount(category);
+  if (n == 0 && category != SAY_IDLE) return getRandomSayingText(SAY_IDLE, buffer, bufSize);
+  if (n == 0 || bufSize == 0) {
+    if (bufSize > 0) buffer[0] = '\0';
+    return 0;
+  }
+  strncpy(buffer, botSayings.get(category, random(0, n)), bufSize - 1);
+  buffer[bufSize - 1] = '\0';
+  return strlen(buffer);
+}
+
+#endif // BOT_SAYINGS_H
@@ -0,0 +1,131 @@
+#ifndef BOT_SCHEDULER_H
+#define BOT_SCHEDULER_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include "config.h"
+
+// ============================================================================
+// Bot Scheduler — behavior events on a 64-bit monotonic clock
+// ============================================================================
+// Blinks, look-arounds, idle expressions/sayings, reaction timeouts and
+// activity-state timeouts are one-shot events in a small min-heap keyed by
+// due time. The frame loop pops only what is due, so behavior that isn't
+// due costs nothing, and the time to the next event tells the loop how
+// long it may sleep while the face is static.
+//
+// Times come from esp_timer (microseconds since boot, 64-bit), so deadlines
+// never wrap — millis() wraps after ~49 days of uptime.
+// ============================================================================
+
+#define BOT_MAX_EVENTS     12
+#define BOT_EVENT_RETRY_MS 1000   // Re-check delay for events that weren't eligible
+
+// 64-bit monotonic milliseconds since boot
+inline uint64_t botNowMs() {
+  return (uint64_t)(esp_timer_get_time() / 1000);
+}
+
+// One pending entry per id — scheduling an id again replaces it
+enum BotEventId : uint8_t {
+  EV_BLINK = 0,        // Start a blink
+  EV_LOOK,             // Start a look-around move
+  EV_IDLE_EXPR,        // Random idle expression change
+  EV_IDLE_SAYING,      // Random idle saying
+  EV_REACT_END,        // Reaction over — return to neutral
+  EV_STATE_TIMEOUT,    // Activity state may have timed out (idle/sleepy/sleep)
+  BOT_NUM_EVENT_IDS
+};
+
+struct BotEvent {
+  uint64_t due;
+  uint8_t id;
+};
+
+struct BotScheduler {
+  BotEvent heap[BOT_MAX_EVENTS];
+  uint8_t count;
+
+  void clear() { count = 0; }
+
+  void swap(uint8_t a, uint8_t b) {
+    BotEvent t = heap[a];
+    heap[a] = heap[b];
+    heap[b] = t;
+  }
+
+  void siftUp(uint8_t i) {
+    while (i > 0) {
+      uint8_t parent = (i - 1) / 2;
+      if (heap[parent].due <= heap[i].due) break;
+      swap(i, parent);
+      i = parent;
+    }
+  }
+
+  void siftDown(uint8_t i) {
+    for (;;) {
+      uint8_t l = i * 2 + 1, r = l + 1, m = i;
+      if (l < count && heap[l].due < heap[m].due) m = l;
+      if (r < count && heap[r].due < heap[m].due) m = r;
+      if (m == i) break;
+      swap(i, m);
+      i = m;
+    }
+  }
+
+  int8_t indexOf(uint8_t id) const {
+    for (uint8_t i = 0; i < count; i++) {
+      if (heap[i].id == id) return i;
+    }
+    return -1;
+  }
+
+  void removeAt(uint8_t i) {
+    count--;
+    if (i == count) return;
+    heap[i] = heap[count];
+    siftDown(i);
+    siftUp(i);
+  }
+
+  // Schedule `id` at an absolute time, replacing any pending one
+  void scheduleAt(uint8_t id, uint64_t due) {
+    int8_t i = indexOf(id);
+    if (i >= 0) removeAt(i);
+    if (count >= BOT_MAX_EVENTS) return;
+    heap[count] = { due, id };
+    siftUp(count++);
+  }
+
+  void schedule(uint8_t id, uint32_t delayMs) {
+    scheduleAt(id, botNowMs() + delayMs);
+  }
+
+  void cancel(uint8_t id) {
+    int8_t i = indexOf(id);
+    if (i >= 0) removeAt(i);
+  }
+
+  bool pending(uint8_t id) const { return indexOf(id) >= 0; }
+
+  // Pop the earliest event due at `now`; -1 when nothing is due
+  int16_t popDue(uint64_t now) {
+    if (count == 0 || heap[0].due > now) return -1;
+    uint8_t id = heap[0].id;
+    removeAt(0);
+    return id;
+  }
+
+  // Milliseconds until the next event (capped at `cap`)
+  uint32_t msUntilNext(uint64_t now, uint32_t cap) const {
+    if (count == 0) return cap;
+    if (heap[0].due <= now) return 0;
+    uint64_t wait = heap[0].due - now;
+    return wait < cap ? (uint32_t)wait : cap;
+  }
+};
+
+BotScheduler botScheduler = {};
+
+#endif // BOT_SCHEDULER_H
@@ -0,0 +1,281 @@
+#ifndef BOT_SPRITES_H
+#define BOT_SPRITES_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "bot_display_list.h"
+
+// ============================================================================
+// Bot Sprite Cache — pre-rasterized RLE masks for special eye shapes
+// ============================================================================
+// Hearts, stars, spirals, X-eyes and carets are built from many primitives
+// but only depend on a few parameters (size, stroke, spiral phase bucket).
+// The first time a shape is needed it is recorded into botDL, rasterized
+// row by row into a run-length mask and stored here; after that it costs
+// one DL_SPRITE op that blits the runs in a single pass.
+//
+// Masks are color-free: each run is ink 1, 2 or 3, resolved to real colors
+// by the op, so the same mask serves every face color. Overlay layers
+// (bot_overlays.h) use the same cache with a version stamp in the key.
+//
+// Storage is one fixed arena with LRU eviction. Entries used by the frame
+// being recorded are pinned; if nothing can be evicted the shape is simply
+// drawn from primitives (counted as a bypass).
+//
+// Entry data layout:
+//   uint16_t rowOffset[h]              — from entry start
+//   per row: uint8_t n, n x { uint8_t x, uint8_t len | ink << 6 }
+// ============================================================================
+
+#define BOT_SPRITE_BUDGET       12288   // Arena bytes for all cached masks
+#define BOT_SPRITE_MAX_ENTRIES  48
+#define BOT_SPRITE_MAX_ROWS     160     // Tallest mask that will be cached
+#define BOT_SPRITE_RUN_MAX      63      // Longer runs are split
+
+// Cache key: kind | stroke | two shape parameters | extra (phase bucket)
+inline uint32_t botSpriteKey(uint8_t kind, uint8_t stroke, uint8_t a, uint8_t b, uint8_t c = 0) {
+  return ((uint32_t)(kind & 0x0F) << 28) | ((uint32_t)(stroke & 0x0F) << 24) |
+         ((uint32_t)a << 16) | ((uint32_t)b << 8) | c;
+}
+
+// Records the shape for `key` anchored at (x, y) using inks[0..2]. ctx is
+// passed through from draw() for builders that need more than the key.
+typedef void (*BotSpriteBuilder)(uint32_t key, int16_t x, int16_t y, const uint16_t *inks, void *ctx);
+
+struct BotSpriteEntry {
+  uint32_t key;
+  uint16_t offset;       // Into arena
+  uint16_t bytes;
+  uint16_t lastUse;      // Frame number, for LRU and pinning
+  uint8_t w, h;
+  int16_t dx, dy;        // Top-left relative to the anchor
+  bool live;
+};
+
+struct BotSpriteCache {
+  uint8_t arena[BOT_SPRITE_BUDGET];
+  uint16_t used;
+  BotSpriteEntry entries[BOT_SPRITE_MAX_ENTRIES];  // Index is stable while live
+  uint8_t count;         // Live entries
+  uint16_t frame;
+
+  // Diagnostics (cumulative)
+  uint32_t hits, misses, evictions, bypasses;
+
+  void beginFrame() { frame++; }
+
+  uint8_t hitRate() const {
+    uint32_t total = hits + misses + bypasses;
+    return total ? (uint8_t)(hits * 100 / total) : 0;
+  }
+
+  int16_t find(uint32_t key) const {
+    for (uint8_t i = 0; i < BOT_SPRITE_MAX_ENTRIES; i++) {
+      if (entries[i].live && entries[i].key == key) return i;
+    }
+    return -1;
+  }
+
+  int16_t freeSlot() const {
+    for (uint8_t i = 0; i < BOT_SPRITE_MAX_ENTRIES; i++) {
+      if (!entries[i].live) return i;
+    }
+    return -1;
+  }
+
+  // Drop an entry and slide later data down (keeps the arena packed).
+  // Other entries keep their index, so ops already recorded stay valid.
+  void evict(uint8_t idx) {
+    BotSpriteEntry &e = entries[idx];
+    uint16_t end = e.offset + e.bytes;
+    memmove(&arena[e.offset], &arena[end], used - end);
+    used -= e.bytes;
+    for (uint8_t i = 0; i < BOT_SPRITE_MAX_ENTRIES; i++) {
+      if (entries[i].live && entries[i].offset > e.offset) entries[i].offset -= e.bytes;
+    }
+    e.live = false;
+    count--;
+    evictions++;
+  }
+
+  // Evict least-recently-used entries not pinned by this frame until `need`
+  // bytes and one entry slot are free
+  bool makeRoom(uint16_t need) {
+    while (used + need > BOT_SPRITE_BUDGET || count >= BOT_SPRITE_MAX_ENTRIES) {
+      int16_t lru = -1;
+      uint16_t oldest = 0;
+      for (uint8_t i = 0; i < BOT_SPRITE_MAX_ENTRIES; i++) {
+        if (!entries[i].live || entries[i].lastUse == frame) continue;
+        uint16_t age = frame - entries[i].lastUse;
+        if (lru < 0 || age > oldest) {
+          lru = i;
+          oldest = age;
+        }
+      }
+      if (lru < 0) return false;
+      evict(lru);
+    }
+    return true;
+  }
+
+  // Encode rows [y0, y1] of the scratch ops into the arena at `out`
+  // (nullptr = just measure). Returns encoded bytes.
+  uint16_t encode(uint16_t first, int16_t y0, int16_t y1, int16_t x0, uint8_t *out) {
+    uint16_t scratch[LCD_WIDTH];
+    uint16_t h = y1 - y0 + 1;
+    uint16_t pos = h * 2;
+    for (int16_t y = y0; y <= y1; y++) {
+      if (out) {
+        uint16_t rowOff = pos;
+        memcpy(&out[(y - y0) * 2], &rowOff, 2);
+      }
+      memset(scratch, 0, sizeof(scratch));
+      for (uint16_t i = first; i < botDL.count; i++) {
+        const BotDLOp &op = botDL.ops[i];
+        if (y >= op.yTop && y <= op.yBot) botDL.rasterizeRow(op, y, scratch);
+      }
+      uint16_t nPos = pos++;
+      uint8_t n = 0;
+      int16_t x = 0;
+      while (x < LCD_WIDTH) {
+        uint16_t ink = scratch[x];
+        if (ink == 0) { x++; continue; }
+        int16_t start = x;
+        while (x < LCD_WIDTH && scratch[x] == ink && x - start < BOT_SPRITE_RUN_MAX) x++;
+        if (out) {
+          out[pos] = start - x0;
+          out[pos + 1] = (x - start) | (ink << 6);
+        }
+        pos += 2;
+        n++;
+      }
+      if (out) out[nPos] = n;
+    }
+    return pos;
+  }
+
+  // Rasterize the shape once into a new entry, recorded with its anchor at
+  // (ox, oy) — a spot where the whole shape is on screen. Returns entry
+  // index or -1.
+  int16_t build(uint32_t key, BotSpriteBuilder builder, void *ctx, int16_t ox, int16_t oy) {
+    static const uint16_t inkIds[3] = { 1, 2, 3 };
+    uint16_t first = botDL.count;
+    uint16_t poolMark = botDL.poolUsed;
+    uint16_t droppedMark = botDL.dropped;
+    builder(key, ox, oy, inkIds, ctx);
+
+    int16_t idx = -1;
+    if (botDL.count > first && botDL.dropped == droppedMark) {
+      // Bounding box of the recorded ops
+      int16_t y0 = LCD_HEIGHT, y1 = -1;
+      for (uint16_t i = first; i < botDL.count; i++) {
+        y0 = min(y0, botDL.ops[i].yTop);
+        y1 = max(y1, botDL.ops[i].yBot);
+      }
+      int16_t x0 = LCD_WIDTH, x1 = -1;
+      uint16_t scratch[LCD_WIDTH];
+      for (int16_t y = y0; y <= y1; y++) {
+        memset(scratch, 0, sizeof(scratch));
+        for (uint16_t i = first; i < botDL.count; i++) {
+          const BotDLOp &op = botDL.ops[i];
+          if (y >= op.yTop && y <= op.yBot) botDL.rasterizeRow(op, y, scratch);
+        }
+        for (int16_t x = 0; x < LCD_WIDTH; x++) {
+          if (scratch[x]) {
+            x0 = min(x0, x);
+            x1 = max(x1, x);
+          }
+        }
+      }
+
+      // Run offsets are uint8
+      if (x1 >= x0 && x1 - x0 < 255 && y1 - y0 < BOT_SPRITE_MAX_ROWS) {
+        uint16_t bytes = encode(first, y0, y1, x0, nullptr);
+        if (bytes <= BOT_SPRITE_BUDGET && makeRoom(bytes)) {
+          encode(first, y0, y1, x0, &arena[used]);
+          idx = freeSlot();
+          BotSpriteEntry &e = entries[idx];
+          e.key = key;
+          e.offset = used;
+          e.bytes = bytes;
+          e.lastUse = frame;
+          e.w = x1 - x0 + 1;
+          e.h = y1 - y0 + 1;
+          e.dx = x0 - ox;
+          e.dy = y0 - oy;
+          e.live = true;
+          used += bytes;
+          count++;
+        }
+      }
+    }
+
+    botDL.count = first;
+    botDL.poolUsed = poolMark;
+    return idx;
+  }
+
+  // Draw the shape for `key` anchored at (x, y): a cached blit when
+  // possible, otherwise the builder's primitives with real colors.
+  // (ox, oy) is where the anchor goes while building (default: screen center).
+  void draw(uint32_t key, int16_t x, int16_t y, const uint16_t *inks,
+            BotSpriteBuilder builder, void *ctx = nullptr,
+            int16_t ox = LCD_WIDTH / 2, int16_t oy = LCD_HEIGHT / 2) {
+    int16_t idx = find(key);
+    if (idx >= 0) {
+      hits++;
+    } else {
+      idx = build(key, builder, ctx, ox, oy);
+      if (idx < 0) {
+        bypasses++;
+        builder(key, x, y, inks, ctx);
+        return;
+      }
+      misses++;
+    }
+    BotSpriteEntry &e = entries[idx];
+    e.lastUse = frame;
+    botDL.drawSprite(idx, x + e.dx, y + e.dy, e.h, inks);
+  }
+
+  // Mix the keys of entries used this frame into `h`, so a frame hash
+  // changes if a slot it references was rebuilt with a different shape
+  uint32_t frameStamp(uint32_t h) const {
+    for (uint8_t i = 0; i < BOT_SPRITE_MAX_ENTRIES; i++) {
+      if (entries[i].live && entries[i].lastUse == frame) {
+        h = (h ^ i) * 16777619UL;
+        h = (h ^ entries[i].key) * 16777619UL;
+      }
+    }
+    return h;
+  }
+
+  const uint8_t *row(uint8_t idx, int16_t r) const {
+    const uint8_t *base = &arena[entries[idx].offset];
+    uint16_t off;
+    memcpy(&off, &base[r * 2], 2);
+    return base + off;
+  }
+
+  void report() {
+    DBG("bot sprites hit "); DBG(hitRate());
+    DBG("% entries "); DBG(count);
+    DBG(" bytes "); DBG(used);
+    DBG(" evict "); DBG(evictions);
+    DBG(" bypass "); DBGLN(bypasses);
+  }
+};
+
+BotSpriteCache botSprites = {};
+
+// Row data for DL_SPRITE ops (declared in bot_display_list.h)
+const uint8_t *botSpriteRow(uint8_t slot, int16_t row) {
+  return botSprites.row(slot, row);
+}
+
+// Shape in a DL_SPRITE op's slot, for per-band hashes
+uint32_t botSpriteSlotKey(uint8_t slot) {
+  return botSprites.entries[slot].key;
+}
+
+#endif // BOT_SPRITES_H
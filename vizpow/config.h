@@ -21,9 +21,9 @@
   #define DEFAULT_BRIGHTNESS 10
   #define MAX_LED_POWER_MA 200       // FastLED auto-scales to this limit
   #define WIFI_TX_POWER WIFI_POWER_8_5dBm  // Reduced TX - phone is nearby
-  #define FRAME_DELAY_EMOJI_STATIC 100     // 10 FPS - static image
-  #define FRAME_DELAY_EMOJI_FADING 50      // 20 FPS - smooth crossfade
-  #define FRAME_DELAY_AMBIENT_MIN 40       // 25 FPS cap for ambient effects
+  #define FRAME_FPS_EMOJI_STATIC 10        // Static image
+  #define FRAME_FPS_EMOJI_FADING 20        // Smooth crossfade
+  #define FRAME_FPS_AMBIENT_MAX 25         // Cap for ambient effects
   #define INTRO_DURATION_MS 1000
   #define INTRO_FADE_RATE 40
   #define INTRO_SPARKLE_BRIGHTNESS 180
@@ -31,6 +31,9 @@
   #define BOARD_ESP32S3_TOUCH_LCD
   #define DISPLAY_LCD_ONLY
   #define HIRES_ENABLED  // Hi-res ambient effects on LCD
+  #define BOT_MODE_ENABLED  // Bot face as a 4th mode
+  #define BOT_BAND_RENDER   // Bot frames stream from static 20-row bands, so
+                            // bot mode never allocates (see MODE_RAM_BUDGET)
   // Full power profile for USB-powered LCD board
   #define DEFAULT_BRIGHTNESS 15
   #define INTRO_DURATION_MS 2000
@@ -52,12 +55,16 @@
   #define DATA_PIN 14
   #define I2C_SDA 11
   #define I2C_SCL 12
+  #define IMU_INT_PIN 10           // QMI8658 INT1 (FIFO watermark)
+  #define IMU_INT_LINE 1
 
 #elif defined(BOARD_ESP32S3_TOUCH_LCD)
   // ESP32-S3-Touch-LCD-1.69 board pins
   #define DATA_PIN 14              // External LED matrix data pin (if used)
   #define I2C_SDA 11               // IMU/Touch I2C SDA
   #define I2C_SCL 10               // IMU/Touch I2C SCL
+  #define IMU_INT_PIN -1           // QMI8658 INT not routed — FIFO drained on a timer
+  #define IMU_INT_LINE 1
 
   // LCD pins (ST7789V2) - corrected from TFT_eSPI working config
   #define LCD_SCK 6
@@ -69,12 +76,20 @@
 
   // Touch controller (CST816T) - shares I2C bus with IMU
   #define TOUCH_I2C_ADDR 0x15
+  #define TOUCH_INT_PIN 14         // CST816T INT (shared with DATA_PIN, see below)
   #define TOUCH_ENABLED
 
 #else
   #error "Please define a board: BOARD_ESP32S3_MATRIX or BOARD_ESP32S3_TOUCH_LCD"
 #endif
 
+// The touch INT line is also the external LED data pin; with both displays
+// driven, touch is polled instead
+#if defined(DISPLAY_DUAL) && defined(TOUCH_ENABLED)
+  #undef TOUCH_INT_PIN
+  #define TOUCH_INT_PIN -1
+#endif
+
 // ============================================================================
 // Common Configuration
 // ============================================================================
@@ -90,7 +105,22 @@
 #define MODE_MOTION 0
 #define MODE_AMBIENT 1
 #define MODE_EMOJI 2
-#define NUM_MODES 3        // Total number of display modes
+#if defined(BOT_MODE_ENABLED)
+  #define MODE_BOT 3
+  #define NUM_MODES 4      // Total number of display modes
+#else
+  #define NUM_MODES 3      // Total number of display modes
+#endif
+
+// RAM budget for mode state (effect buffers + bot renderer). All of it is
+// static and checked at compile time in vizpow.ino: switching modes never
+// allocates, so cycling in and out of bot mode can't fragment the heap.
+// The size checked against it (modeRamBytes) is summed by the compiler from
+// the per-mode objects, so it is the ESP32's own layout and follows every
+// struct change; with DEBUG_SERIAL each mode switch prints it. The budget
+// itself is a limit, well under the 134KB full-screen canvas bot mode does
+// without.
+#define MODE_RAM_BUDGET (56 * 1024)
 
 // Effect counts
 #define NUM_MOTION_EFFECTS 7
@@ -113,8 +143,8 @@
   #define DBG(...) Serial.print(__VA_ARGS__)
   #define DBGLN(...) Serial.println(__VA_ARGS__)
 #else
-  #define DBG(...)
-  #define DBGLN(...)
+  #define DBG(...) do {} while (0)
+  #define DBGLN(...) do {} while (0)
 #endif
 
 // XY mapping - trying NO serpentine (straight rows)
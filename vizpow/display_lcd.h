@@ -98,6 +98,11 @@ void renderToLCD() {
   if (menuVisible) return;
   #endif
 
+  // Don't render 8x8 grid when Bot Mode is active (it renders directly)
+  #if defined(BOT_MODE_ENABLED)
+  if (currentMode == MODE_BOT) return;
+  #endif
+
   // Don't render 8x8 grid if a hi-res effect already rendered this frame
   if (hiResRenderedThisFrame) {
     hiResRenderedThisFrame = false;  // Reset for next frame
@@ -3,12 +3,16 @@
 
 #include <FastLED.h>
 #include "config.h"
+#include "imu_orientation.h"
 
 // External references to globals defined in main sketch
 extern CRGB leds[];
 extern CRGBPalette16 currentPalette;
 extern float accelX, accelY, accelZ;
-extern float gyroX, gyroY, gyroZ;
+
+// Tilt and rotation come from the shared orientation estimate (imuOrient),
+// so linear acceleration doesn't throw them around; the shake effects read
+// raw accel on purpose.
 
 // Motion sensitivity settings - adjust these to tune responsiveness
 #define ACCEL_SENSITIVITY 2.5    // Multiplier for accelerometer effects (higher = more responsive)
@@ -21,8 +25,8 @@ void tiltBall() {
 
   // More responsive: larger range and faster interpolation
   // Swapped X/Y axes to match device orientation
-  float targetX = 3.5 + accelY * 5.0 * ACCEL_SENSITIVITY;
-  float targetY = 3.5 + accelX * 5.0 * ACCEL_SENSITIVITY;
+  float targetX = 3.5 + imuOrient.upY() * 5.0 * ACCEL_SENSITIVITY;
+  float targetY = 3.5 + imuOrient.upX() * 5.0 * ACCEL_SENSITIVITY;
 
   ballX += (targetX - ballX) * 0.5;  // Faster response (was 0.3)
   ballY += (targetY - ballY) * 0.5;
@@ -50,7 +54,7 @@ void tiltBall() {
 
 void motionPlasma() {
   static uint16_t t = 0;
-  float motion = sqrt(gyroX * gyroX + gyroY * gyroY + gyroZ * gyroZ);
+  float motion = imuOrient.rateDps();
   t += 1 + (motion / 15 * GYRO_SENSITIVITY);  // Much faster response (was /50)
   
   for (uint8_t x = 0; x < MATRIX_WIDTH; x++) {
@@ -79,14 +83,17 @@ void tiltWave() {
   static uint8_t t = 0;
   t++;
   
-  float angle = atan2(accelY, accelX);
-  
+  // Wave runs along the lean direction: one table lookup each for cos/sin
+  // per frame, then integer math per pixel (projection in Q15)
+  int32_t c = cos16(imuOrient.tiltDir);
+  int32_t s = sin16(imuOrient.tiltDir);
+
   FastLED.clear();
   for (uint8_t x = 0; x < MATRIX_WIDTH; x++) {
     for (uint8_t y = 0; y < MATRIX_HEIGHT; y++) {
-      float projected = x * cos(angle) + y * sin(angle);
-      uint8_t bright = sin8(projected * 40 + t * 3);
-      leds[XY(x, y)] = ColorFromPalette(currentPalette, projected * 20 + t, bright);
+      int32_t projected = x * c + y * s;
+      uint8_t bright = sin8(((projected * 40) >> 15) + t * 3);
+      leds[XY(x, y)] = ColorFromPalette(currentPalette, ((projected * 20) >> 15) + t, bright);
     }
   }
 }
@@ -96,8 +103,8 @@ void tiltRipple() {
   t++;
 
   // Larger center movement from tilt (was 2)
-  float cx = 3.5 + accelX * 4.0 * ACCEL_SENSITIVITY;
-  float cy = 3.5 - accelY * 4.0 * ACCEL_SENSITIVITY;
+  float cx = 3.5 + imuOrient.upX() * 4.0 * ACCEL_SENSITIVITY;
+  float cy = 3.5 - imuOrient.upY() * 4.0 * ACCEL_SENSITIVITY;
   
   for (uint8_t x = 0; x < MATRIX_WIDTH; x++) {
     for (uint8_t y = 0; y < MATRIX_HEIGHT; y++) {
@@ -112,7 +119,7 @@ void tiltRipple() {
 
 void gyroSwirl() {
   static uint16_t t = 0;
-  t += 2 + abs(gyroZ) / 30 * GYRO_SENSITIVITY;  // Much faster swirl (was /100)
+  t += 2 + fabsf(imuOrient.rateZdps()) / 30 * GYRO_SENSITIVITY;  // Much faster swirl (was /100)
   
   for (uint8_t x = 0; x < MATRIX_WIDTH; x++) {
     for (uint8_t y = 0; y < MATRIX_HEIGHT; y++) {
@@ -0,0 +1,125 @@
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "i2c_bus.h"
+#include "power_sleep.h"
+
+// ============================================================================
+// Frame Scheduler — absolute frame deadlines with input/network in the slack
+// ============================================================================
+// Each frame is due one period after the previous deadline, not one delay
+// after the previous frame finished, so the frame rate doesn't sag by the
+// render + show time and doesn't drift (vTaskDelayUntil-style). Until the
+// deadline the loop runs the idle work it's given (web calls, IMU,
+// gestures, touch) and sleeps in slices of at most FRAME_SLICE_MS; a touch
+// or web call wakes it early (inputDelay). Idle work can ask for the frame
+// to be drawn right away, e.g. the bot reacting to a tap. Battery builds
+// light-sleep through the wait instead (power_sleep.h).
+//
+// A frame that starts after its deadline is counted as missed and the
+// schedule restarts from now rather than rendering a burst to catch up.
+// waitFor() is a one-off deadline for modes that pace themselves (bot).
+// ============================================================================
+
+#define FRAME_SLICE_MS      30      // Longest sleep between input checks
+#define FRAME_REPORT_MS     5000    // Timing report period (DEBUG_SERIAL)
+
+struct FrameScheduler {
+  uint32_t deadlineUs;     // When the next frame is due
+  uint32_t periodUs;       // 0 = last wait was one-off
+  uint32_t frameStartUs;
+  uint32_t frameEndUs;     // Last frame shown
+
+  // Stats since the last report
+  uint32_t frames;
+  uint32_t missed;
+  uint32_t workUs;         // Frame start to wait (effect + show + input)
+  uint32_t workMaxUs;
+  unsigned long lastReport;
+  uint32_t missedTotal;
+
+  // Sleep until `deadlineUs`, running idle() in between; returns early if
+  // idle() asks for a frame
+  void sleepUntilDeadline(bool (*idle)()) {
+    for (;;) {
+      if (idle && idle()) {
+        deadlineUs = micros();
+        break;
+      }
+      int32_t left = (int32_t)(deadlineUs - micros());
+      if (left <= 0) break;
+      if (left < 1000) {
+        delayMicroseconds(left);  // Sub-tick remainder
+        break;
+      }
+      #if defined(POWER_SAVE_ENABLED)
+        if (powerSleep.sleep(left, frameEndUs)) continue;
+      #endif
+      uint32_t ms = left / 1000;
+      inputDelay(ms < FRAME_SLICE_MS ? ms : FRAME_SLICE_MS);
+    }
+    frameStartUs = micros();
+    #if defined(POWER_SAVE_ENABLED)
+      powerSleep.frameBoundary(frameStartUs);
+    #endif
+  }
+
+  // Close out the frame that just ran
+  void account(uint32_t now) {
+    frameEndUs = now;
+    uint32_t work = now - frameStartUs;
+    workUs += work;
+    if (work > workMaxUs) workMaxUs = work;
+    frames++;
+  }
+
+  // Next frame one period after the last deadline
+  void waitNext(uint32_t periodMs, bool (*idle)()) {
+    uint32_t now = micros();
+    account(now);
+    uint32_t period = periodMs * 1000UL;
+    if (period != periodUs) {
+      // New rate (or coming from a one-off): start the schedule from here
+      periodUs = period;
+      deadlineUs = frameStartUs + period;
+    } else {
+      deadlineUs += period;
+      if ((int32_t)(now - deadlineUs) > 0) {
+        missed++;
+        missedTotal++;
+        deadlineUs = now;
+      }
+    }
+    sleepUntilDeadline(idle);
+  }
+
+  // Next frame `ms` from now (the caller keeps its own schedule)
+  void waitFor(uint32_t ms, bool (*idle)()) {
+    uint32_t now = micros();
+    account(now);
+    periodUs = 0;
+    deadlineUs = now + ms * 1000UL;
+    sleepUntilDeadline(idle);
+  }
+
+  // Print rate, frame cost and misses once per interval
+  void report() {
+    unsigned long now = millis();
+    if (now - lastReport < FRAME_REPORT_MS) return;
+    if (frames > 0) {
+      DBG("frame fps "); DBG(frames * 1000UL / (now - lastReport));
+      DBG(" target "); DBG(periodUs ? 1000000UL / periodUs : 0);
+      DBG(" work avg "); DBG(workUs / frames);
+      DBG("us max "); DBG(workMaxUs);
+      DBG("us missed "); DBGLN(missed);
+    }
+    frames = missed = workUs = workMaxUs = 0;
+    lastReport = now;
+  }
+};
+
+FrameScheduler frameScheduler = {};
+
+#endif // FRAME_SCHEDULER_H
@@ -0,0 +1,176 @@
+#ifndef IMU_ORIENTATION_H
+#define IMU_ORIENTATION_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "imu_fifo.h"
+
+// ============================================================================
+// IMU Orientation — fixed-point complementary filter at sensor rate
+// ============================================================================
+// Every sample drained from the IMU FIFO updates one shared orientation
+// estimate; effects and pupil tracking read it at render time instead of
+// taking raw accel components (which jump on any linear acceleration) and
+// doing their own trig.
+//
+// The state is the gravity ("up") vector in the board frame, unit length in
+// Q14. Per sample:
+//  - with the gyro on, the vector is rotated by the measured angular rate
+//    (small-angle cross product) and pulled toward the accelerometer with
+//    a slow time constant, so shakes and slides barely move it;
+//  - with the gyro off it is a low-pass of the accelerometer;
+//  - either way, samples whose |accel| is far from 1g (linear acceleration)
+//    pull less, or not at all past ORIENT_GATE;
+//  - one Newton step keeps the vector unit length.
+// Roll, pitch and the lean direction are then published as binary angles
+// (65536 = one turn) from an integer atan2, so every sample costs the same
+// handful of integer multiplies, divides and square roots.
+//
+// Motion-to-photon: FIFO watermark (32ms) + filter lag (~0 with the gyro,
+// ~ORIENT_TAU_ACCEL_MS without) + one frame.
+// ============================================================================
+
+#define ORIENT_ONE            16384    // 1g / unit vector in Q14
+#define ORIENT_RATE_ONE       16       // Angular rate units per dps
+#define ORIENT_TAU_GYRO_MS    500      // Accel correction with the gyro on
+#define ORIENT_TAU_ACCEL_MS   50       // Accel low-pass with the gyro off
+#define ORIENT_GATE           7373     // ||a|^2 - 1g^2| beyond which accel is ignored (0.45 g^2, Q14)
+#define ORIENT_MAX_DT_US      20000    // Longer gaps (FIFO restart) count as one period
+
+// Integer sqrt of a 32-bit value (16 fixed iterations)
+static uint16_t orientSqrt(uint32_t v) {
+  uint32_t root = 0, bit = 1UL << 30;
+  while (bit > v) bit >>= 2;
+  while (bit) {
+    if (v >= root + bit) {
+      v -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (uint16_t)root;
+}
+
+// atan2 as a binary angle (65536 = one turn), ~0.25 degree error.
+// atan(z) ~= z * (pi/4 + 0.273 * (1 - z)) on the first octant.
+static int16_t orientAtan2(int32_t y, int32_t x) {
+  if (x == 0 && y == 0) return 0;
+  uint32_t ax = x < 0 ? -x : x, ay = y < 0 ? -y : y;
+  bool swap = ay > ax;
+  uint32_t z = swap ? (ax << 15) / ay : (ay << 15) / ax;   // Q15, 0..1
+  int32_t a = (int32_t)((z * (8192 + ((2847 * (32768 - z)) >> 15))) >> 15);
+  if (swap) a = 16384 - a;
+  if (x < 0) a = 32768 - a;
+  if (y < 0) a = -a;
+  return (int16_t)a;
+}
+
+struct ImuOrientation {
+  // Published state (updated every sample)
+  int16_t gravX, gravY, gravZ;     // Unit up vector in the board frame (Q14)
+  int16_t roll, pitch;             // Binary angles, 0 = flat face up
+  uint16_t tiltDir;                // Direction of the lean in the board's XY plane
+  int16_t rateX, rateY, rateZ;     // Angular rate (dps * ORIENT_RATE_ONE), 0 with the gyro off
+  uint16_t rateMag;                // |rate|, same units
+
+  uint32_t lastUs;
+  bool primed;
+
+  // Diagnostics
+  uint32_t samples;
+  uint32_t gated;                  // Samples ignored as linear acceleration
+
+  static int32_t toQ14(float v) {
+    return (int32_t)constrain(v * ORIENT_ONE, -2.0f * ORIENT_ONE, 2.0f * ORIENT_ONE - 1);
+  }
+
+  static int32_t toRate(float dps) {
+    return (int32_t)constrain(dps * ORIENT_RATE_ONE, -32767.0f, 32767.0f);
+  }
+
+  // Fold in one sample. `gyro` says whether the sample's gyro fields are
+  // live (the gyro may be powered down to save current).
+  void feed(const ImuSample &s, bool gyro) {
+    samples++;
+    int32_t ax = toQ14(s.ax), ay = toQ14(s.ay), az = toQ14(s.az);
+    int32_t gx = gravX, gy = gravY, gz = gravZ;
+
+    // How far |a| is from 1g: linear acceleration on top of gravity
+    uint32_t a2 = ((uint32_t)(ax * ax) + (uint32_t)(ay * ay) + (uint32_t)(az * az)) >> 14;
+    int32_t dev = (int32_t)a2 - ORIENT_ONE;
+    if (dev < 0) dev = -dev;
+
+    if (!primed) {
+      // Seed from the first calm sample's direction, else assume flat
+      if (dev < ORIENT_GATE) {
+        gx = ax; gy = ay; gz = az;
+      } else {
+        gx = 0; gy = 0; gz = ORIENT_ONE;
+      }
+      lastUs = s.us;
+      primed = true;
+    }
+    uint32_t dt = s.us - lastUs;
+    lastUs = s.us;
+    if (dt == 0 || dt > ORIENT_MAX_DT_US) dt = imuFifo.periodUs;
+
+    int32_t rx = 0, ry = 0, rz = 0;
+    if (gyro) {
+      rx = toRate(s.gx); ry = toRate(s.gy); rz = toRate(s.gz);
+      // Rotation this sample in Q14 radians: rate * dt * pi/180, with
+      // 1199 / 2^26 = 1024 * pi/180 / 1e6 folding in the unit scales
+      int32_t f = (int32_t)((dt * 1199UL) >> 10);
+      int32_t tx = (rx * f) >> 16, ty = (ry * f) >> 16, tz = (rz * f) >> 16;
+      // The up vector is fixed in the world, so in the board frame it
+      // turns the other way: g += g x theta
+      int32_t nx = gx + ((gy * tz - gz * ty) >> 14);
+      int32_t ny = gy + ((gz * tx - gx * tz) >> 14);
+      int32_t nz = gz + ((gx * ty - gy * tx) >> 14);
+      gx = nx; gy = ny; gz = nz;
+    }
+
+    // Pull toward the accelerometer, less the further |a| is from 1g
+    if (dev < ORIENT_GATE) {
+      uint32_t tau = (gyro ? ORIENT_TAU_GYRO_MS : ORIENT_TAU_ACCEL_MS) * 1000UL;
+      int32_t k = (int32_t)((dt << 14) / (tau + dt));           // Q14
+      k = (k * (ORIENT_GATE - dev)) / ORIENT_GATE;
+      gx += ((ax - gx) * k) >> 14;
+      gy += ((ay - gy) * k) >> 14;
+      gz += ((az - gz) * k) >> 14;
+    } else {
+      gated++;
+    }
+
+    // Renormalize: g *= (3 - |g|^2) / 2
+    int32_t n2 = ((uint32_t)(gx * gx) + (uint32_t)(gy * gy) + (uint32_t)(gz * gz)) >> 14;
+    if (n2 > 2 * ORIENT_ONE) n2 = 2 * ORIENT_ONE;
+    int32_t scale = (3 * ORIENT_ONE - n2) >> 1;
+    gravX = (int16_t)((gx * scale) >> 14);
+    gravY = (int16_t)((gy * scale) >> 14);
+    gravZ = (int16_t)((gz * scale) >> 14);
+
+    roll = orientAtan2(gravY, gravZ);
+    pitch = orientAtan2(-gravX, orientSqrt((uint32_t)((int32_t)gravY * gravY) +
+                                           (uint32_t)((int32_t)gravZ * gravZ)));
+    tiltDir = (uint16_t)orientAtan2(gravY, gravX);
+
+    rateX += (rx - rateX) >> 2;
+    rateY += (ry - rateY) >> 2;
+    rateZ += (rz - rateZ) >> 2;
+    rateMag = orientSqrt((uint32_t)((int32_t)rateX * rateX) + (uint32_t)((int32_t)rateY * rateY) +
+                         (uint32_t)((int32_t)rateZ * rateZ));
+  }
+
+  // Float views for effects (g / dps)
+  float upX() const { return gravX * (1.0f / ORIENT_ONE); }
+  float upY() const { return gravY * (1.0f / ORIENT_ONE); }
+  float upZ() const { return gravZ * (1.0f / ORIENT_ONE); }
+  float rateZdps() const { return rateZ * (1.0f / ORIENT_RATE_ONE); }
+  float rateDps() const { return rateMag * (1.0f / ORIENT_RATE_ONE); }
+};
+
+ImuOrientation imuOrient = {};
+
+#endif // IMU_ORIENTATION_H
@@ -0,0 +1,325 @@
+#ifndef INPUT_TRACE_H
+#define INPUT_TRACE_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include <LittleFS.h>
+#include "config.h"
+#include "imu_fifo.h"
+#include "imu_orientation.h"
+#include "imu_gestures.h"
+#include "touch_input.h"
+
+// ============================================================================
+// Input Trace — record IMU samples and touch events, replay them frame by frame
+// ============================================================================
+// Recording writes every IMU sample the loop reads, every touch event it
+// handles and one marker per frame to a binary file on LittleFS. Playback
+// feeds the file back through the same seams — readIMU() and handleTouch()
+// take their input from nextSample()/nextTouch() — while the live sensors
+// are read and dropped, so a field report can be reproduced on the bench.
+//
+// Both runs start from the same place: the RNGs (Arduino random() and
+// FastLED random8/16) are seeded from the trace header and the orientation
+// filter and gesture recognizer are reset. Each frame marker carries the
+// mode, effect and palette the frame ran with plus a hash of leds[] (of
+// the panel in bot mode, see botPanelHash()); playback restores the state
+// before the effect runs and counts frames whose hash differs. Effects
+// that read the clock (tiltBall's hue, the bot's timers) can still diverge
+// on the device; the host replayer runs on the recorded frame times.
+//
+// Playback also times each frame (loop start to shown), so CPU cost can
+// be compared between builds on the same trace.
+//
+// File layout (little-endian):
+//   header  magic u32, version u8, 3 reserved, seed u32, reserved u32
+//   IMU     1, t u32, ax ay az gx gy gz i16   (sensor counts, see below)
+//   TOUCH   2, t u32, type u8, x u16, y u16
+//   FRAME   3, t u32, mode u8, effect u8, palette u8, hash u32
+// t is micros() since the start of the recording. scripts/dump-trace.js
+// prints a trace as CSV; test/trace_replay replays one on the host.
+// ============================================================================
+
+#define TRACE_PATH          "/input.trc"
+#define TRACE_MAGIC         0x52545A56   // "VZTR"
+#define TRACE_VERSION       1
+#define TRACE_MAX_BYTES     (256 * 1024) // ~50s at 250Hz + 50fps
+#define TRACE_BUF_SIZE      512          // Written to flash in blocks this size
+#define TRACE_TOUCH_MAX     8            // Touch events held for one replayed frame
+#define TRACE_ACCEL_LSB     8192.0f      // QMI8658 counts per g at +-4g
+#define TRACE_GYRO_LSB      64.0f        // QMI8658 counts per dps at +-512dps
+
+enum TraceRecordType : uint8_t {
+  TRACE_IMU = 1,
+  TRACE_TOUCH,
+  TRACE_FRAME
+};
+
+struct TraceFrame {
+  uint32_t us;
+  uint8_t mode, effect, palette;
+  uint32_t hash;
+};
+
+// FNV-1a over a frame buffer
+static uint32_t traceHash(const uint8_t *data, size_t len) {
+  uint32_t h = 2166136261UL;
+  for (size_t i = 0; i < len; i++) {
+    h ^= data[i];
+    h *= 16777619UL;
+  }
+  return h;
+}
+
+struct InputTrace {
+  bool mounted;
+  bool recording;
+  bool playing;
+  bool fileHeld;           // /trace/file is streaming it: don't start recording
+  File file;
+  uint32_t seed;
+  uint32_t startUs;
+  uint32_t bytes;
+
+  // Write buffer (recording)
+  uint8_t buf[TRACE_BUF_SIZE];
+  uint16_t bufLen;
+
+  // Replay: records up to the next frame marker
+  TraceFrame frame;
+  bool haveFrame;
+  TouchEvent touchQ[TRACE_TOUCH_MAX];
+  uint8_t touchHead, touchCount;
+
+  // Stats (last recording / replay)
+  uint32_t frames;
+  uint32_t samples;
+  uint32_t touches;
+  uint32_t mismatches;     // Replayed frames whose hash differs
+  uint32_t frameStartUs;
+  uint64_t cpuUs;          // Replay: loop start to frame shown, summed
+  uint32_t cpuMaxUs;
+
+  void begin(bool fsMounted) {
+    mounted = fsMounted;
+  }
+
+  // Common start for both directions: same RNG stream, same filter state
+  void restart(uint32_t s) {
+    seed = s;
+    randomSeed(seed);
+    random16_set_seed((uint16_t)seed);
+    imuOrient = {};
+    imuGestures = {};
+    startUs = micros();
+    bytes = 0;
+    bufLen = 0;
+    haveFrame = false;
+    touchHead = touchCount = 0;
+    frames = samples = touches = mismatches = 0;
+    cpuUs = 0;
+    cpuMaxUs = 0;
+  }
+
+  bool startRecording() {
+    if (!mounted || recording || playing || fileHeld) return false;
+    file = LittleFS.open(TRACE_PATH, FILE_WRITE);
+    if (!file) return false;
+    restart(esp_random() | 1);  // randomSeed(0) would leave the hardware RNG on
+    uint32_t magic = TRACE_MAGIC, reserved = 0;
+    uint8_t version[4] = { TRACE_VERSION, 0, 0, 0 };
+    put(&magic, 4); put(version, 4); put(&seed, 4); put(&reserved, 4);
+    recording = true;
+    DBGLN("Trace: recording");
+    return true;
+  }
+
+  bool startPlayback() {
+    if (!mounted || recording || playing) return false;
+    file = LittleFS.open(TRACE_PATH, FILE_READ);
+    if (!file) return false;
+    uint32_t magic = 0, s = 0, reserved;
+    uint8_t version[4] = { 0 };
+    if (file.read((uint8_t *)&magic, 4) != 4 || file.read(version, 4) != 4 ||
+        file.read((uint8_t *)&s, 4) != 4 || file.read((uint8_t *)&reserved, 4) != 4 ||
+        magic != TRACE_MAGIC || version[0] != TRACE_VERSION) {
+      file.close();
+      DBGLN("Trace: no valid trace to play");
+      return false;
+    }
+    restart(s);
+    playing = true;
+    DBGLN("Trace: playing");
+    return true;
+  }
+
+  void stop() {
+    if (recording) {
+      flush();
+      DBG("Trace: recorded "); DBG(frames); DBG(" frames, "); DBG(bytes); DBGLN(" bytes");
+    }
+    if (playing) {
+      DBG("Trace: replayed "); DBG(frames); DBG(" frames, "); DBG(mismatches);
+      DBG(" differ, cpu avg "); DBG(frames ? (uint32_t)(cpuUs / frames) : 0);
+      DBG("us max "); DBG(cpuMaxUs); DBGLN("us");
+    }
+    if (recording || playing) file.close();
+    recording = false;
+    playing = false;
+  }
+
+  // ---- Recording ----
+
+  void put(const void *data, uint16_t len) {
+    if (bufLen + len > TRACE_BUF_SIZE) flush();
+    memcpy(buf + bufLen, data, len);
+    bufLen += len;
+    bytes += len;
+  }
+
+  void flush() {
+    if (bufLen) file.write(buf, bufLen);
+    bufLen = 0;
+  }
+
+  void putHeader(uint8_t type, uint32_t us) {
+    uint32_t t = us - startUs;
+    put(&type, 1);
+    put(&t, 4);
+  }
+
+  static int16_t quantize(float v, float lsb) {
+    return (int16_t)constrain(lroundf(v * lsb), -32768L, 32767L);
+  }
+
+  // The sample is rounded to sensor counts in place, so the live run sees
+  // exactly what a replay will
+  void recordSample(ImuSample &s) {
+    int16_t v[6] = {
+      quantize(s.ax, TRACE_ACCEL_LSB), quantize(s.ay, TRACE_ACCEL_LSB), quantize(s.az, TRACE_ACCEL_LSB),
+      quantize(s.gx, TRACE_GYRO_LSB), quantize(s.gy, TRACE_GYRO_LSB), quantize(s.gz, TRACE_GYRO_LSB)
+    };
+    decode(v, s);
+    putHeader(TRACE_IMU, s.us);
+    put(v, sizeof(v));
+    samples++;
+  }
+
+  void recordTouch(const TouchEvent &ev) {
+    putHeader(TRACE_TOUCH, ev.us);
+    put(&ev.type, 1);
+    put(&ev.x, 2);
+    put(&ev.y, 2);
+    touches++;
+  }
+
+  static void decode(const int16_t *v, ImuSample &s) {
+    s.ax = v[0] / TRACE_ACCEL_LSB; s.ay = v[1] / TRACE_ACCEL_LSB; s.az = v[2] / TRACE_ACCEL_LSB;
+    s.gx = v[3] / TRACE_GYRO_LSB;  s.gy = v[4] / TRACE_GYRO_LSB;  s.gz = v[5] / TRACE_GYRO_LSB;
+  }
+
+  // ---- Replay ----
+
+  // Read records until the next IMU sample; touches are queued for the
+  // frame, a frame marker ends the frame's input
+  bool replaySample(ImuSample &s) {
+    while (playing && !haveFrame) {
+      uint8_t type;
+      uint32_t t;
+      if (file.read(&type, 1) != 1 || file.read((uint8_t *)&t, 4) != 4) {
+        stop();
+        return false;
+      }
+      if (type == TRACE_IMU) {
+        int16_t v[6];
+        if (file.read((uint8_t *)v, sizeof(v)) != sizeof(v)) break;
+        s.us = t;
+        decode(v, s);
+        samples++;
+        return true;
+      } else if (type == TRACE_TOUCH) {
+        TouchEvent ev;
+        ev.us = t;
+        if (file.read(&ev.type, 1) != 1 || file.read((uint8_t *)&ev.x, 2) != 2 ||
+            file.read((uint8_t *)&ev.y, 2) != 2) break;
+        if (touchCount < TRACE_TOUCH_MAX) {
+          touchQ[(touchHead + touchCount++) % TRACE_TOUCH_MAX] = ev;
+          touches++;
+        }
+      } else if (type == TRACE_FRAME) {
+        frame.us = t;
+        if (file.read(&frame.mode, 1) != 1 || file.read(&frame.effect, 1) != 1 ||
+            file.read(&frame.palette, 1) != 1 || file.read((uint8_t *)&frame.hash, 4) != 4) break;
+        haveFrame = true;
+      } else {
+        break;  // Unknown record: the rest can't be parsed
+      }
+    }
+    if (playing && !haveFrame) {
+      DBGLN("Trace: truncated or corrupt");
+      stop();
+    }
+    return false;
+  }
+
+  // ---- Loop seams ----
+
+  // Next IMU sample for the loop: live (and recorded) or replayed
+  bool nextSample(ImuFifo &fifo, uint32_t &cursor, ImuSample &s) {
+    if (playing) {
+      ImuSample live;
+      while (fifo.read(cursor, live)) {}  // Live input is dropped during replay
+      return replaySample(s);
+    }
+    if (!fifo.read(cursor, s)) return false;
+    if (recording) recordSample(s);
+    return true;
+  }
+
+  // Next touch event for the loop: live (and recorded) or replayed
+  bool nextTouch(TouchEvent &ev) {
+    if (playing) {
+      TouchEvent live;
+      while (touchInput.pop(live)) {}
+      if (touchCount == 0) return false;
+      ev = touchQ[touchHead];
+      touchHead = (touchHead + 1) % TRACE_TOUCH_MAX;
+      touchCount--;
+      return true;
+    }
+    if (!touchInput.pop(ev)) return false;
+    if (recording) recordTouch(ev);
+    return true;
+  }
+
+  void beginFrame() {
+    frameStartUs = micros();
+  }
+
+  // Mode/effect/palette the replayed frame ran with; null when not replaying
+  const TraceFrame *replayFrame() const {
+    return (playing && haveFrame) ? &frame : nullptr;
+  }
+
+  // The frame is shown: write its marker, or check it against the recording
+  void endFrame(uint8_t mode, uint8_t effect, uint8_t palette, uint32_t hash) {
+    if (recording) {
+      putHeader(TRACE_FRAME, micros());
+      put(&mode, 1); put(&effect, 1); put(&palette, 1);
+      put(&hash, 4);
+      frames++;
+      if (bytes >= TRACE_MAX_BYTES) stop();
+    } else if (playing && haveFrame) {
+      uint32_t cpu = micros() - frameStartUs;
+      cpuUs += cpu;
+      if (cpu > cpuMaxUs) cpuMaxUs = cpu;
+      if (hash != frame.hash) mismatches++;
+      frames++;
+      haveFrame = false;
+    }
+  }
+};
+
+InputTrace inputTrace = {};
+
+#endif // INPUT_TRACE_H
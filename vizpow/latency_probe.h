@@ -0,0 +1,131 @@
+#ifndef LATENCY_PROBE_H
+#define LATENCY_PROBE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// Latency Probe — motion-to-photon histograms per motion effect
+// ============================================================================
+// Every IMU sample carries its acquisition time (imu_fifo.h). readIMU()
+// hands the newest one to input(); a motion frame then brackets its effect
+// with beginFrame()/evaluated() and calls shown() once showDisplay() has
+// returned, i.e. after FastLED.show() or the LCD flush. The frame's
+// motion-to-photon latency is the age of the newest sample it could have
+// used at that point — what the wearer actually sees, including frames
+// that found no new sample.
+//
+// Latencies go into a 1ms histogram per effect, so p50/p95/p99 come out
+// without keeping samples; the stage sums split the mean into input age
+// (sample to frame start), effect evaluation and show/flush. When a bin
+// would overflow, the effect's bins are halved, keeping the shape.
+//
+// Reported over serial every LATENCY_REPORT_MS while a motion effect runs,
+// and on /latency.
+// ============================================================================
+
+#define LATENCY_BINS        128      // 1ms bins; the last one collects >= 127ms
+#define LATENCY_REPORT_MS   10000
+
+struct LatencyStats {
+  uint16_t bins[LATENCY_BINS];
+  uint32_t frames;
+  uint32_t maxUs;
+  // Stage sums for the mean breakdown
+  uint64_t inputUs;          // Sample acquisition -> frame start
+  uint64_t evalUs;           // Effect evaluation
+  uint64_t showUs;           // showDisplay(): FastLED.show() / LCD flush
+};
+
+struct LatencyProbe {
+  LatencyStats effects[NUM_MOTION_EFFECTS];
+  uint32_t sampleUs;         // Acquisition time of the newest sample read
+  bool haveSample;
+  uint32_t frameUs;          // beginFrame()
+  uint32_t evalDoneUs;       // evaluated()
+  bool inFrame;
+  unsigned long lastReport;
+
+  // Newest IMU sample the loop has read
+  void input(uint32_t us) {
+    sampleUs = us;
+    haveSample = true;
+  }
+
+  void beginFrame() {
+    frameUs = micros();
+    evalDoneUs = frameUs;
+    inFrame = haveSample;
+  }
+
+  void evaluated() {
+    evalDoneUs = micros();
+  }
+
+  // The frame is on the display
+  void shown(uint8_t effect) {
+    if (!inFrame || effect >= NUM_MOTION_EFFECTS) return;
+    inFrame = false;
+    uint32_t now = micros();
+    uint32_t total = now - sampleUs;
+    LatencyStats &st = effects[effect];
+    uint32_t bin = total / 1000;
+    if (bin >= LATENCY_BINS) bin = LATENCY_BINS - 1;
+    if (st.bins[bin] == 0xFFFF) {
+      for (uint16_t i = 0; i < LATENCY_BINS; i++) st.bins[i] >>= 1;
+    }
+    st.bins[bin]++;
+    st.frames++;
+    if (total > st.maxUs) st.maxUs = total;
+    st.inputUs += frameUs - sampleUs;
+    st.evalUs += evalDoneUs - frameUs;
+    st.showUs += now - evalDoneUs;
+  }
+
+  // Latency (ms, rounded up to the bin edge) below which `permille` of the
+  // effect's frames fell; 0 with no frames
+  uint16_t percentile(uint8_t effect, uint16_t permille) const {
+    const LatencyStats &st = effects[effect];
+    uint32_t total = 0;
+    for (uint16_t i = 0; i < LATENCY_BINS; i++) total += st.bins[i];
+    if (total == 0) return 0;
+    uint32_t target = (total * permille + 999) / 1000;
+    uint32_t seen = 0;
+    for (uint16_t i = 0; i < LATENCY_BINS; i++) {
+      seen += st.bins[i];
+      if (seen >= target) return i + 1;
+    }
+    return LATENCY_BINS;
+  }
+
+  // Mean of a stage sum (us)
+  static uint32_t mean(uint64_t sum, uint32_t frames) {
+    return frames ? (uint32_t)(sum / frames) : 0;
+  }
+
+  void reset() {
+    memset(effects, 0, sizeof(effects));
+  }
+
+  // Periodic serial line for the running effect
+  void report(uint8_t effect) {
+    unsigned long now = millis();
+    if (now - lastReport < LATENCY_REPORT_MS) return;
+    lastReport = now;
+    if (effect >= NUM_MOTION_EFFECTS) return;
+    const LatencyStats &st = effects[effect];
+    if (st.frames == 0) return;
+    DBG("m2p fx "); DBG(effect);
+    DBG(" p50 "); DBG(percentile(effect, 500));
+    DBG(" p95 "); DBG(percentile(effect, 950));
+    DBG(" p99 "); DBG(percentile(effect, 990));
+    DBG("ms | input "); DBG(mean(st.inputUs, st.frames));
+    DBG(" eval "); DBG(mean(st.evalUs, st.frames));
+    DBG(" show "); DBG(mean(st.showUs, st.frames));
+    DBG("us | "); DBG(st.frames); DBGLN(" frames");
+  }
+};
+
+LatencyProbe latencyProbe = {};
+
+#endif // LATENCY_PROBE_H
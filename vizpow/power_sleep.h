@@ -0,0 +1,149 @@
+#ifndef POWER_SLEEP_H
+#define POWER_SLEEP_H
+
+#include <Arduino.h>
+#include <esp_sleep.h>
+#include <driver/gpio.h>
+#include "config.h"
+#include "i2c_bus.h"
+#include "imu_fifo.h"
+
+// ============================================================================
+// Power Sleep — light sleep in the slack between frames (battery builds)
+// ============================================================================
+// With POWER_SAVE_ENABLED and WiFi off (running on battery), the frame
+// scheduler hands its wait to sleep() instead of idling at full clock. The
+// chip light-sleeps until the frame deadline (timer wake) or until the IMU
+// FIFO watermark raises INT (GPIO wake). Static emoji frames are the
+// longest waits, so they spend most of their time asleep. An IMU wake
+// re-arms the drain and hands over to the bus task. The loop then runs
+// gesture detection on the new burst before sleeping again, so
+// shake-to-change-mode still sees every sample.
+//
+// The bus lock is held across the sleep so no I2C transaction is cut off.
+// The sleep waits until the LED strip has clocked out the last frame. It
+// is skipped when an IMU burst is waiting or when the wait is too short to
+// pay for the wake-up.
+//
+// Duty cycle (awake time / frame time) is counted per frame and reported
+// with the sleep and IMU-wake counts every POWER_REPORT_MS.
+// ============================================================================
+
+#define POWER_SLEEP_MIN_US      2000    // Shorter waits stay awake
+#define POWER_SLEEP_WAKE_US     500     // Wake this early for the frame deadline
+#define POWER_SLEEP_LATCH_US    3000    // LED data still clocking out after show()
+#define POWER_REPORT_MS         5000
+
+struct PowerSleep {
+  bool enabled;
+  uint32_t lastFrameUs;
+  uint32_t frameSleptUs;   // Asleep so far in the current frame
+  uint16_t dutyPermille;   // Awake share of the last frame
+
+  // Since the last report
+  uint32_t frames;
+  uint64_t frameUs;
+  uint64_t sleptUs;
+  uint32_t sleeps;
+  uint32_t imuWakes;
+  unsigned long lastReport;
+
+  // Call once WiFi is settled: light sleep would drop the AP
+  void begin(bool allowed) {
+    enabled = allowed;
+    if (!enabled) return;
+    #if IMU_INT_PIN >= 0
+      esp_sleep_enable_gpio_wakeup();
+    #endif
+    lastFrameUs = micros();
+    DBGLN("Light sleep between frames");
+  }
+
+  // Sleep up to `leftUs` (until the frame deadline). `shownUs` is when the
+  // last frame went out. False when it didn't sleep.
+  bool sleep(int32_t leftUs, uint32_t shownUs) {
+    if (!enabled || imuFifoPending) return false;
+    uint32_t sinceShow = micros() - shownUs;
+    if (sinceShow < POWER_SLEEP_LATCH_US) {
+      uint32_t latch = POWER_SLEEP_LATCH_US - sinceShow;
+      if ((int32_t)latch >= leftUs) return false;
+      delayMicroseconds(latch);  // Let the strip finish before the clocks stop
+      leftUs -= latch;
+    }
+    int32_t us = leftUs - POWER_SLEEP_WAKE_US;
+    #if IMU_INT_PIN < 0
+      // Timed drain: wake in time for the next one
+      us = min(us, (int32_t)(IMU_FIFO_WATERMARK * imuFifo.periodUs));
+    #endif
+    if (us < POWER_SLEEP_MIN_US) return false;
+
+    esp_sleep_wakeup_cause_t cause;
+    uint32_t t0;
+    {
+      I2cLock bus;
+      #if IMU_INT_PIN >= 0
+        gpio_num_t pin = (gpio_num_t)IMU_INT_PIN;
+        if (digitalRead(IMU_INT_PIN)) return false;  // Burst already waiting
+        // Level wake for the sleep, then back to the edge interrupt
+        gpio_intr_disable(pin);
+        gpio_wakeup_enable(pin, GPIO_INTR_HIGH_LEVEL);
+      #endif
+      esp_sleep_enable_timer_wakeup(us);
+      t0 = micros();
+      esp_light_sleep_start();
+      cause = esp_sleep_get_wakeup_cause();
+      #if IMU_INT_PIN >= 0
+        gpio_wakeup_disable(pin);
+        gpio_set_intr_type(pin, GPIO_INTR_POSEDGE);
+        gpio_intr_enable(pin);
+      #endif
+    }
+    uint32_t slept = micros() - t0;
+    frameSleptUs += slept;
+    sleeps++;
+
+    if (cause == ESP_SLEEP_WAKEUP_GPIO) {
+      // The edge came while asleep, so the ISR never saw it
+      imuFifoPending = true;
+      imuWakes++;
+      if (i2cBus.started) xTaskNotifyGive(i2cBus.task);
+    }
+    return true;
+  }
+
+  // A new frame starts: close out the last one's duty cycle
+  void frameBoundary(uint32_t now) {
+    uint32_t span = now - lastFrameUs;
+    lastFrameUs = now;
+    uint32_t slept = min(frameSleptUs, span);
+    frameSleptUs = 0;
+    if (span == 0) return;
+    dutyPermille = (uint16_t)((uint64_t)(span - slept) * 1000 / span);
+    frames++;
+    frameUs += span;
+    sleptUs += slept;
+  }
+
+  // Average duty cycle since the last report (permille)
+  uint16_t averageDuty() const {
+    return frameUs ? (uint16_t)((frameUs - sleptUs) * 1000 / frameUs) : 1000;
+  }
+
+  void report() {
+    unsigned long now = millis();
+    if (now - lastReport < POWER_REPORT_MS) return;
+    if (enabled && frames > 0) {
+      DBG("power duty avg "); DBG(averageDuty() / 10.0f, 1);
+      DBG("% last "); DBG(dutyPermille / 10.0f, 1);
+      DBG("% | "); DBG(sleeps); DBG(" sleeps, ");
+      DBG(imuWakes); DBGLN(" IMU wakes");
+    }
+    frames = sleeps = imuWakes = 0;
+    frameUs = sleptUs = 0;
+    lastReport = now;
+  }
+};
+
+PowerSleep powerSleep = {};
+
+#endif // POWER_SLEEP_H
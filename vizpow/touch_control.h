@@ -9,6 +9,8 @@
 #if defined(TOUCH_ENABLED)
 
 #include <Arduino_GFX_Library.h>
+#include "touch_input.h"
+#include "input_trace.h"
 
 // LCD dimensions (must match display_lcd.h)
 #ifndef LCD_WIDTH
@@ -20,17 +22,9 @@
 #define TOUCH_I2C_ADDR 0x15
 #define TOUCH_RST_PIN 21
 
-// CST816T Register addresses
-#define TOUCH_REG_GESTURE 0x01
-#define TOUCH_REG_FINGER_NUM 0x02
-#define TOUCH_REG_XPOS_H 0x03
-#define TOUCH_REG_XPOS_L 0x04
-#define TOUCH_REG_YPOS_H 0x05
-#define TOUCH_REG_YPOS_L 0x06
-
 // Touch timing
-#define TOUCH_COOLDOWN_MS 400
 #define MENU_TIMEOUT_MS 8000  // Hide menu after 8 seconds of no touch
+#define TOUCH_BOOT_MS   50    // CST816T ready after reset
 
 // Full screen menu layout
 #define BTN_WIDTH 110        // Button width (2 per row with gap)
@@ -47,10 +41,8 @@ extern bool autoCycle;
 extern unsigned long lastChange;
 extern CRGBPalette16 currentPalette;
 extern CRGB leds[];
-extern void resetEffectShuffle();
 extern CRGBPalette16 palettes[];
-extern uint8_t emojiQueueCount;
-extern uint8_t addRandomEmojis(uint8_t count);
+extern void switchMode(uint8_t nextMode);
 
 // External GFX object from display_lcd.h
 extern Arduino_GFX *gfx;
@@ -65,16 +57,9 @@ extern void toggleHiResMode();
 static bool touchInitialized = false;
 static uint8_t touchI2CAddr = TOUCH_I2C_ADDR;
 static unsigned long lastTouchTime = 0;
-static unsigned long lastActionTime = 0;
-static bool waitingForLift = false;  // Wait for finger to lift before accepting new touch
-static unsigned long touchStartTime = 0;  // When finger first touched
-static bool longPressTriggered = false;   // Whether long press already fired
 bool menuVisible = false;  // Not static - accessed from display_lcd.h
 static uint8_t menuPage = 0;  // 0 = main, 1 = settings
 
-// Long press timing
-#define LONG_PRESS_MS 600  // Hold for 600ms to open menu
-
 // LCD backlight brightness (0-255)
 static uint8_t lcdBrightness = 200;
 
@@ -82,7 +67,7 @@ static uint8_t lcdBrightness = 200;
 extern uint8_t speed;
 
 // Mode names
-const char* modeNames[] = {"Motion", "Ambient", "Emoji"};
+const char* modeNames[] = {"Motion", "Ambient", "Emoji", "Bot"};
 
 // Effect names (abbreviated)
 const char* motionEffectNames[] = {
@@ -103,42 +88,36 @@ const char* paletteNames[] = {
   "Ice", "Blood", "Vaporwave", "DeepForest", "Gold"
 };
 
-// Reset touch controller
+// Reset touch controller and wait for it to boot
 void resetTouch() {
   pinMode(TOUCH_RST_PIN, OUTPUT);
   digitalWrite(TOUCH_RST_PIN, LOW);
   delay(10);
   digitalWrite(TOUCH_RST_PIN, HIGH);
-  delay(50);
+  delay(TOUCH_BOOT_MS);
 }
 
-// Read register from touch controller
-uint8_t touchReadRegister(uint8_t reg) {
-  Wire.beginTransmission(touchI2CAddr);
-  Wire.write(reg);
-  if (Wire.endTransmission(false) != 0) {
-    return 0;
+// Look for the controller at its known addresses (one address-only write each)
+bool probeTouch() {
+  static const uint8_t addresses[] = {0x15, 0x5A, 0x38};
+  for (uint8_t i = 0; i < sizeof(addresses); i++) {
+    if (i2cBus.probe(I2C_DEV_TOUCH, addresses[i])) {
+      touchI2CAddr = addresses[i];
+      return true;
+    }
   }
-  Wire.requestFrom(touchI2CAddr, (uint8_t)1);
-  return Wire.available() ? Wire.read() : 0;
+  return false;
 }
 
 // Initialize touch controller
 bool initTouch() {
   resetTouch();
-  delay(100);
-
-  // Try known addresses
-  uint8_t addresses[] = {0x15, 0x5A, 0x38};
-  for (int i = 0; i < 3; i++) {
-    Wire.beginTransmission(addresses[i]);
-    if (Wire.endTransmission() == 0) {
-      touchI2CAddr = addresses[i];
-      touchInitialized = true;
-      DBG("Touch OK at 0x");
-      DBGLN(touchI2CAddr, HEX);
-      return true;
-    }
+  if (probeTouch()) {
+    touchInitialized = true;
+    touchInput.begin(touchI2CAddr, TOUCH_INT_PIN);
+    DBG("Touch OK at 0x");
+    DBGLN(touchI2CAddr, HEX);
+    return true;
   }
 
   // Try alternate reset pins
@@ -148,20 +127,17 @@ bool initTouch() {
     digitalWrite(rstPins[p], LOW);
     delay(10);
     digitalWrite(rstPins[p], HIGH);
-    delay(100);
-
-    for (int i = 0; i < 3; i++) {
-      Wire.beginTransmission(addresses[i]);
-      if (Wire.endTransmission() == 0) {
-        touchI2CAddr = addresses[i];
-        touchInitialized = true;
-        DBG("Touch OK at 0x");
-        DBG(touchI2CAddr, HEX);
-        DBG(" (RST pin ");
-        DBG(rstPins[p]);
-        DBGLN(")");
-        return true;
-      }
+    delay(TOUCH_BOOT_MS);
+
+    if (probeTouch()) {
+      touchInitialized = true;
+      touchInput.begin(touchI2CAddr, TOUCH_INT_PIN);
+      DBG("Touch OK at 0x");
+      DBG(touchI2CAddr, HEX);
+      DBG(" (RST pin ");
+      DBG(rstPins[p]);
+      DBGLN(")");
+      return true;
     }
   }
 
@@ -169,24 +145,6 @@ bool initTouch() {
   return false;
 }
 
-// Read touch coordinates
-bool readTouch(uint16_t &x, uint16_t &y) {
-  if (!touchInitialized) return false;
-
-  uint8_t fingerNum = touchReadRegister(TOUCH_REG_FINGER_NUM);
-  if (fingerNum == 0) return false;
-
-  uint8_t xh = touchReadRegister(TOUCH_REG_XPOS_H);
-  uint8_t xl = touchReadRegister(TOUCH_REG_XPOS_L);
-  uint8_t yh = touchReadRegister(TOUCH_REG_YPOS_H);
-  uint8_t yl = touchReadRegister(TOUCH_REG_YPOS_L);
-
-  x = ((xh & 0x0F) << 8) | xl;
-  y = ((yh & 0x0F) << 8) | yl;
-
-  return true;
-}
-
 // Draw a solid button with centered text
 void drawButton(int16_t x, int16_t y, int16_t w, int16_t h, const char* label, uint16_t bgColor, bool selected = false) {
   // Solid fill
@@ -223,8 +181,10 @@ void drawMenuHeader() {
     gfx->print(motionEffectNames[effectIndex % NUM_MOTION_EFFECTS]);
   } else if (currentMode == MODE_AMBIENT) {
     gfx->print(ambientEffectNames[effectIndex % NUM_AMBIENT_EFFECTS]);
-  } else {
+  } else if (currentMode == MODE_EMOJI) {
     gfx->print("Emoji");
+  } else {
+    gfx->print("Face");
   }
 
   // Palette name
@@ -252,6 +212,9 @@ void drawMenuHeader() {
 // Draw full-screen menu
 void drawMenu() {
   if (gfx == nullptr) return;
+  #if defined(BOT_MODE_ENABLED)
+  botFlushWait();  // Don't race the bot flush task for the panel
+  #endif
 
   // Fill entire screen black
   gfx->fillScreen(0x0000);
@@ -319,10 +282,16 @@ void hideMenu() {
   DBGLN("Closing menu");
 
   // Clear entire screen - LED display will redraw on next frame
+  #if defined(BOT_MODE_ENABLED)
+  botFlushWait();
+  #endif
   gfx->fillScreen(0x0000);
 
   menuVisible = false;
   menuPage = 0;  // Reset to main page for next open
+  #if defined(BOT_MODE_ENABLED)
+  botInvalidateFrame();
+  #endif
 }
 
 // Action functions
@@ -341,15 +310,7 @@ void touchPrevEffect() {
 }
 
 void touchNextMode() {
-  uint8_t nextMode = (currentMode + 1) % NUM_MODES;
-  if (nextMode == MODE_EMOJI && emojiQueueCount == 0) {
-    addRandomEmojis(RANDOM_EMOJI_COUNT);
-  }
-  currentMode = nextMode;
-  effectIndex = 0;
-  lastChange = millis();
-  resetEffectShuffle();
-  FastLED.clear();
+  switchMode((currentMode + 1) % NUM_MODES);
 }
 
 void touchBrightnessUp() {
@@ -465,77 +426,59 @@ bool processMenuTouch(uint16_t x, uint16_t y) {
   return false;
 }
 
-// Main touch handler - call in loop()
+// Main touch handler - call in loop(). The I2C bus task reads the controller
+// when it signals a report (touch_input.h); this acts on the queued events.
 void handleTouch() {
   if (!touchInitialized) return;
 
   unsigned long now = millis();
-  uint16_t x, y;
-
-  bool touching = readTouch(x, y);
 
-  // If waiting for finger lift, check if lifted
-  if (waitingForLift) {
-    if (!touching) {
-      waitingForLift = false;
-      touchStartTime = 0;
-      longPressTriggered = false;
-    }
-    return;
-  }
-
-  if (touching) {
+  TouchEvent ev;
+  while (inputTrace.nextTouch(ev)) {  // Live, or replayed from a trace
     lastTouchTime = now;
 
-    // Menu not visible - check for long press to open
-    if (!menuVisible) {
-      // Start tracking touch if not already
-      if (touchStartTime == 0) {
-        touchStartTime = now;
-        longPressTriggered = false;
+    // Menu open: each new finger-down presses one button
+    if (menuVisible) {
+      if (ev.type != TOUCH_DOWN) continue;
+      DBG("Touch X=");
+      DBG(ev.x);
+      DBG(" Y=");
+      DBGLN(ev.y);
+      if (processMenuTouch(ev.x, ev.y)) {
+        hideMenu();
+      } else {
+        drawMenu();  // Redraw to update status
       }
+      continue;
+    }
 
-      // Check if long press threshold reached
-      if (!longPressTriggered && (now - touchStartTime >= LONG_PRESS_MS)) {
+    switch (ev.type) {
+      case TOUCH_LONG_PRESS:
         DBGLN("Long press - opening menu");
-        longPressTriggered = true;
-        lastActionTime = now;
         drawMenu();
-        waitingForLift = true;
-      }
-      return;
-    }
-
-    // Menu is visible - handle button presses
-    // Enforce cooldown between button presses
-    if (now - lastActionTime < TOUCH_COOLDOWN_MS) {
-      return;
-    }
-    lastActionTime = now;
-
-    DBG("Touch X=");
-    DBG(x);
-    DBG(" Y=");
-    DBGLN(y);
-
-    // Process menu touch
-    bool shouldClose = processMenuTouch(x, y);
-
-    if (shouldClose) {
-      hideMenu();
-      waitingForLift = true;
-    } else {
-      drawMenu();  // Redraw to update status
-      waitingForLift = true;
+        break;
+      #if defined(BOT_MODE_ENABLED)
+      case TOUCH_TAP:
+        // Short tap pokes the bot
+        if (currentMode != MODE_BOT) break;
+        botMode.onTap();
+        botRequestFrame();  // Show the reaction this pass
+        DBG("Bot tap reaction, latency us: ");
+        DBGLN(micros() - ev.us);
+        break;
+      case TOUCH_DOUBLE_TAP:
+        if (currentMode != MODE_BOT) break;
+        botMode.onDoubleTap();
+        botRequestFrame();
+        break;
+      #endif
+      default:
+        break;
     }
-  } else {
-    // Reset long press tracking
-    touchStartTime = 0;
-    longPressTriggered = false;
   }
 
   // Hide menu after timeout
-  if (menuVisible && !touching && lastTouchTime > 0) {
+  if (menuVisible && !touchInput.down && lastTouchTime > 0) {
     if (now - lastTouchTime > MENU_TIMEOUT_MS) {
       hideMenu();
     }
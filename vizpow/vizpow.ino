@@ -24,16 +24,27 @@
 #include <WiFi.h>
 #include <WebServer.h>
 #include "SensorQMI8658.hpp"
+#include <esp_heap_caps.h>
 
 #include "config.h"
 #if defined(AUTO_WIFI_USB_DETECT)
   #include "hal/usb_serial_jtag_ll.h"
 #endif
 #include "palettes.h"
+#include "imu_fifo.h"
+#include "imu_orientation.h"
+#include "latency_probe.h"
+#include "input_trace.h"
+#include "app_tasks.h"
+#include "frame_scheduler.h"
 #include "effects_motion.h"
 #include "effects_ambient.h"
 #include "effects_emoji.h"
 #include "display_lcd.h"
+#include "imu_gestures.h"
+#if defined(BOT_MODE_ENABLED)
+#include "bot_mode.h"
+#endif
 #include "web_server.h"
 #if defined(TOUCH_ENABLED)
 #include "touch_control.h"
@@ -56,14 +67,16 @@ unsigned long lastChange = 0;
 unsigned long lastPaletteChange = 0;
 
 // IMU data
-float accelX = 0, accelY = 0, accelZ = 0;
+float accelX = 0, accelY = 0, accelZ = 0;   // Newest sample
 float gyroX = 0, gyroY = 0, gyroZ = 0;
+float accelPeak = 0;                        // Largest |accel| (g) in the last burst
+uint32_t imuCursor = 0;                     // Loop's read position in imuFifo
 
-// Shake detection state
-unsigned long shakeTimestamps[SHAKE_COUNT];
-uint8_t shakeIndex = 0;
+// Mode change by shake (gestures come from imuGestures)
+#define MODE_FLASH_MS 100
 unsigned long lastModeChange = 0;
-bool wasShaking = false;  // Track if we were above threshold last frame
+unsigned long modeFlashStart = 0;
+bool modeFlashOn = false;
 
 // Shuffle bags for random-without-repeats cycling
 // Use 16 (NUM_AMBIENT_EFFECTS) as it's the larger of the two
@@ -124,6 +137,73 @@ uint8_t nextShuffledPalette() {
   return paletteShuffleBag[paletteShufflePos++];
 }
 
+// ============================================================================
+// Mode RAM budget
+// ============================================================================
+// Effect state and the bot renderer are all statically allocated, so the
+// budget is checked here at compile time rather than at mode switch. Each
+// mode's share comes from sizeof on the objects themselves.
+#if defined(HIRES_ENABLED)
+constexpr size_t modeRamHiRes = sizeof(hiResBuffer);
+#else
+constexpr size_t modeRamHiRes = 0;
+#endif
+constexpr size_t modeRamEffects = sizeof(leds) + sizeof(emojiQueue) + modeRamHiRes;
+#if defined(BOT_MODE_ENABLED)
+constexpr size_t modeRamBot = sizeof(botDL) + sizeof(botSprites) + sizeof(botBandBuf) +
+                              sizeof(botBackground) + sizeof(botMode) + sizeof(botScheduler) +
+                              sizeof(botSayings) + sizeof(botSayingsCopy);
+#else
+constexpr size_t modeRamBot = 0;
+#endif
+constexpr size_t modeRamBytes = modeRamEffects + modeRamBot;
+static_assert(modeRamBytes <= MODE_RAM_BUDGET, "Mode state exceeds MODE_RAM_BUDGET");
+
+// Log heap after a mode switch: free and largest-block should come back to
+// the same values every time bot mode is left
+void reportModeHeap() {
+  DBG("Mode "); DBG(currentMode);
+  DBG(" static "); DBG((uint32_t)modeRamBytes);
+  DBG(" (bot "); DBG((uint32_t)modeRamBot); DBG(")");
+  DBG(" heap free "); DBG(heap_caps_get_free_size(MALLOC_CAP_8BIT));
+  DBG(" largest "); DBGLN(heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+}
+
+// Switch display mode (shake, touch menu and web all come through here)
+void switchMode(uint8_t nextMode) {
+  #if defined(BOT_MODE_ENABLED)
+  bool leavingBot = currentMode == MODE_BOT && nextMode != MODE_BOT;
+  bool enteringBot = nextMode == MODE_BOT && currentMode != MODE_BOT;
+  if (leavingBot) exitBotMode();
+  #endif
+
+  // Handle mode-specific entry logic
+  if (nextMode == MODE_EMOJI && emojiQueueCount == 0) {
+    addRandomEmojis(RANDOM_EMOJI_COUNT);
+  }
+
+  currentMode = nextMode;
+  effectIndex = 0;
+  lastChange = millis();
+  resetEffectShuffle();  // Reshuffle for the new mode's effect count
+  FastLED.clear();
+
+  #if defined(BOT_MODE_ENABLED)
+  if (enteringBot) enterBotMode();
+  #endif
+  reportModeHeap();
+}
+
+#if defined(BOT_MODE_ENABLED)
+// Any real movement keeps the bot awake (shakes and taps arrive as gestures)
+void runBotMotionWake() {
+  if (!botMode.initialized) return;
+  if (accelPeak > 1.3f) {
+    botMode.registerInteraction();
+  }
+}
+#endif
+
 // Helper function to show output on configured displays
 void showDisplay() {
   #if defined(DISPLAY_LED_ONLY) || defined(DISPLAY_DUAL)
@@ -148,9 +228,35 @@ void introAnimation() {
   showDisplay();
 }
 
+// I2C bus task work (i2c_bus.h): drain the IMU FIFO and read touch reports
+// when their interrupts (or timers) say so. True when touch events were
+// queued, which wakes the loop early.
+bool serviceInputDevices() {
+  bool samples = imuFifo.service(imu) > 0;
+  #if defined(TOUCH_ENABLED)
+    bool touched = touchInput.service();
+  #else
+    bool touched = false;
+  #endif
+  #if defined(POWER_SAVE_ENABLED)
+    // Wake the loop for every burst so it checks for a shake and can go
+    // back to sleep (power_sleep.h)
+    return touched || samples;
+  #else
+    (void)samples;
+    return touched;
+  #endif
+}
+
+// Net task work (app_tasks.h): serve web requests on core 0
+void serviceNetwork() {
+  if (wifiEnabled) server.handleClient();
+}
+
 void setup() {
   Serial.begin(115200);
   delay(100);
+  appTasks.begin();  // setup() and loop() are the render thread
 
   // Determine whether to enable WiFi
   #if defined(AUTO_WIFI_USB_DETECT)
@@ -198,7 +304,7 @@ void setup() {
   introAnimation();
 
   // Initialize IMU
-  Wire.begin(I2C_SDA, I2C_SCL);
+  i2cBus.begin(I2C_SDA, I2C_SCL);
 
   if (imu.begin(Wire, QMI8658_L_SLAVE_ADDRESS, I2C_SDA, I2C_SCL)) {
     imu.configAccelerometer(
@@ -208,11 +314,12 @@ void setup() {
     );
     imu.configGyroscope(
       SensorQMI8658::GYR_RANGE_512DPS,
-      SensorQMI8658::GYR_ODR_896_8Hz,
+      SensorQMI8658::GYR_ODR_224_2Hz,   // 6DOF FIFO runs at the gyro ODR
       SensorQMI8658::LPF_MODE_0
     );
     imu.enableAccelerometer();
     imu.enableGyroscope();
+    imuFifo.begin(imu, IMU_INT_PIN, true);
     DBGLN("IMU initialized");
   } else {
     DBGLN("IMU initialization failed");
@@ -223,17 +330,30 @@ void setup() {
     initTouch();
   #endif
 
+  // Input traces (and the bot expression pack and sayings) live on LittleFS
+  bool fsMounted = LittleFS.begin(true);
+  if (!fsMounted) DBGLN("LittleFS mount failed - no traces, built-in expressions/sayings only");
+  inputTrace.begin(fsMounted);
+  #if defined(BOT_MODE_ENABLED)
+    botPack.begin(fsMounted);
+    botSayings.begin(fsMounted);
+  #endif
+
   // Set initial palette
   currentPalette = palettes[0];
 
-  // Initialize shake detection
-  for (uint8_t i = 0; i < SHAKE_COUNT; i++) {
-    shakeTimestamps[i] = 0;
-  }
-
   // Initialize shuffle bags
   resetEffectShuffle();
   resetPaletteShuffle();
+
+  // IMU and touch are read off the loop from here on, and so is the web
+  // server
+  i2cBus.start(serviceInputDevices);
+  appTasks.start(serviceNetwork);
+
+  #if defined(POWER_SAVE_ENABLED)
+    powerSleep.begin(!wifiEnabled);  // On battery: sleep between frames
+  #endif
 }
 
 // Switch IMU between full (motion mode) and low-power (ambient/emoji)
@@ -242,101 +362,159 @@ void updateIMUForMode() {
   IMUProfile target = (currentMode == MODE_MOTION) ? IMU_FULL : IMU_LOW_POWER;
   if (target == currentIMUProfile) return;
 
+  I2cLock bus;
   if (target == IMU_FULL) {
     imu.enableGyroscope();
   } else {
     imu.disableGyroscope();
   }
+  imuFifo.restart(imu, target == IMU_FULL);
   currentIMUProfile = target;
 }
 #endif
 
+// Walk the IMU samples the bus task drained since the last pass (without
+// the task, drain here — no I2C unless a burst is ready), or the next
+// frame's samples from a trace being replayed: every one feeds the gesture
+// recognizer and the orientation filter, the newest is kept in
+// accel*/gyro* (and its timestamp in the latency probe), the largest
+// |accel| of the burst in accelPeak
 void readIMU() {
-  if (imu.getDataReady()) {
-    imu.getAccelerometer(accelX, accelY, accelZ);
-    #if defined(POWER_SAVE_ENABLED)
-      if (currentIMUProfile == IMU_FULL) {
-        imu.getGyroscope(gyroX, gyroY, gyroZ);
-      } else {
-        gyroX = gyroY = gyroZ = 0;
-      }
-    #else
-      imu.getGyroscope(gyroX, gyroY, gyroZ);
-    #endif
+  i2cBus.poll();
+
+  #if defined(POWER_SAVE_ENABLED)
+    bool gyroLive = currentIMUProfile == IMU_FULL;
+  #else
+    bool gyroLive = true;
+  #endif
+  ImuSample s;
+  bool fresh = false;
+  float peak = 0;
+  while (inputTrace.nextSample(imuFifo, imuCursor, s)) {
+    imuGestures.process(s);
+    accelX = s.ax; accelY = s.ay; accelZ = s.az;
+    gyroX = s.gx; gyroY = s.gy; gyroZ = s.gz;  // 0 while the gyro is off
+    imuOrient.feed(s, gyroLive);
+    peak = max(peak, sqrtf(s.ax * s.ax + s.ay * s.ay + s.az * s.az));
+    fresh = true;
+  }
+  if (fresh) {
+    accelPeak = peak;  // Held until the next burst
+    if (!inputTrace.playing) latencyProbe.input(s.us);
   }
 }
 
-// Check for shake gesture to change mode
-void checkModeShake() {
-  unsigned long now = millis();
-
-  // Skip if in cooldown period
-  if (now - lastModeChange < SHAKE_COOLDOWN_MS) {
-    return;
+// Brief white flash to confirm a mode change. The loop holds it for
+// MODE_FLASH_MS instead of blocking in delay().
+void startModeFlash() {
+  for (int i = 0; i < NUM_LEDS; i++) {
+    leds[i] = CRGB(50, 50, 50);
   }
+  showDisplay();
+  modeFlashStart = millis();
+  modeFlashOn = true;
+}
+
+// True while the flash is showing; clears it once it has run
+bool modeFlashActive() {
+  if (!modeFlashOn) return false;
+  if (millis() - modeFlashStart < MODE_FLASH_MS) return true;
+  modeFlashOn = false;
+  FastLED.clear();
+  return false;
+}
 
-  // Calculate acceleration magnitude (subtract 1g for gravity)
-  float magnitude = sqrt(accelX * accelX + accelY * accelY + accelZ * accelZ);
-  bool isShaking = magnitude > SHAKE_THRESHOLD;
-
-  // Detect shake event (transition from not-shaking to shaking)
-  if (isShaking && !wasShaking) {
-    // Record this shake timestamp
-    shakeTimestamps[shakeIndex] = now;
-    shakeIndex = (shakeIndex + 1) % SHAKE_COUNT;
-
-    // Count shakes within the window
-    uint8_t validShakes = 0;
-    for (uint8_t i = 0; i < SHAKE_COUNT; i++) {
-      if (now - shakeTimestamps[i] < SHAKE_WINDOW_MS) {
-        validShakes++;
-      }
+// Act on gestures recognized in readIMU: SHAKE_COUNT shakes change mode,
+// and in bot mode the bot gets the rest
+void handleGestures() {
+  GestureEvent ev;
+  while (imuGestures.pop(ev)) {
+    switch (ev.type) {
+      case GEST_SHAKE_N:
+        if (millis() - lastModeChange < SHAKE_COOLDOWN_MS) break;
+        // Cycle to next mode: MOTION -> AMBIENT -> EMOJI (-> BOT) -> MOTION
+        switchMode((currentMode + 1) % NUM_MODES);
+        lastModeChange = millis();
+        startModeFlash();
+        break;
+      default:
+        #if defined(BOT_MODE_ENABLED)
+        if (currentMode == MODE_BOT) botHandleGesture(ev);
+        #endif
+        break;
     }
+  }
+}
 
-    // If enough shakes, change mode
-    if (validShakes >= SHAKE_COUNT) {
-      // Cycle to next mode: MOTION -> AMBIENT -> EMOJI -> MOTION
-      uint8_t nextMode = (currentMode + 1) % 3;
-
-      // Handle mode-specific entry logic
-      if (nextMode == MODE_EMOJI && emojiQueueCount == 0) {
-        addRandomEmojis(RANDOM_EMOJI_COUNT);
-      }
-
-      currentMode = nextMode;
-      effectIndex = 0;
-      lastChange = now;
-      lastModeChange = now;
-      resetEffectShuffle();  // Reshuffle for the new mode's effect count
-      FastLED.clear();
+// What a trace frame marker checks: the panel in bot mode, leds[] otherwise
+uint32_t traceFrameHash() {
+  #if defined(BOT_MODE_ENABLED)
+    if (currentMode == MODE_BOT) return botPanelHash();
+  #endif
+  return traceHash((const uint8_t *)leds, sizeof(leds));
+}
 
-      // Clear shake timestamps to prevent immediate re-trigger
-      for (uint8_t i = 0; i < SHAKE_COUNT; i++) {
-        shakeTimestamps[i] = 0;
-      }
-
-      // Brief flash to indicate mode change
-      for (int i = 0; i < NUM_LEDS; i++) {
-        leds[i] = CRGB(50, 50, 50);
-      }
-      showDisplay();
-      delay(100);
-      FastLED.clear();
-    }
+// Replay: put mode, effect and palette where the recorded frame had them
+void applyTraceFrame() {
+  const TraceFrame *f = inputTrace.replayFrame();
+  if (f == nullptr) return;
+  if (f->mode != currentMode && f->mode < NUM_MODES) switchMode(f->mode);
+  effectIndex = f->effect;
+  if (f->palette != paletteIndex && f->palette < NUM_PALETTES) {
+    paletteIndex = f->palette;
+    currentPalette = palettes[paletteIndex];
   }
+}
+
+// Web-side changes queued since the last frame (app_tasks.h); without the
+// net task, serve requests here too
+void serviceWebRequests() {
+  appTasks.poll();
+  appTasks.service();
+}
 
-  wasShaking = isShaking;
+// Frame period for the current mode (ms). Power-save builds hold emoji and
+// ambient to the frame-rate targets in config.h; otherwise the speed
+// setting is the period.
+uint32_t frameTargetMs() {
+  #if defined(POWER_SAVE_ENABLED)
+    switch (currentMode) {
+      case MODE_EMOJI:
+        return 1000 / (emojiFading ? FRAME_FPS_EMOJI_FADING : FRAME_FPS_EMOJI_STATIC);
+      case MODE_AMBIENT:
+        return max((uint32_t)speed, (uint32_t)(1000 / FRAME_FPS_AMBIENT_MAX));
+      default:  // MODE_MOTION
+        return speed;
+    }
+  #else
+    return speed;
+  #endif
+}
+
+// Work fitted into the slack before the next frame (frame_scheduler.h):
+// web changes, IMU, gestures and touch. True to draw the next frame now.
+bool serviceBetweenFrames() {
+  serviceWebRequests();
+  readIMU();
+  handleGestures();
+  #if defined(TOUCH_ENABLED)
+    handleTouch();
+  #endif
+  #if defined(BOT_MODE_ENABLED)
+    return currentMode == MODE_BOT && botFramePending();
+  #else
+    return false;
+  #endif
 }
 
 void loop() {
-  if (wifiEnabled) {
-    server.handleClient();
-  }
+  serviceWebRequests();
+  inputTrace.beginFrame();
   readIMU();
   #if defined(POWER_SAVE_ENABLED)
     updateIMUForMode();
   #endif
-  checkModeShake();  // Check for shake gesture to change mode
+  handleGestures();  // Shake to change mode, tilt, bot reactions
 
   // Handle touch gestures
   #if defined(TOUCH_ENABLED)
@@ -363,47 +541,60 @@ void loop() {
     }
   }
 
-  // Run current effect based on mode
-  switch (currentMode) {
-    case MODE_MOTION:
-      runMotionEffect(effectIndex);
-      break;
-    case MODE_AMBIENT:
-      runAmbientEffect(effectIndex);
-      break;
-    case MODE_EMOJI:
-      runEmojiEffect();
-      break;
-  }
-
-  showDisplay();
+  applyTraceFrame();
+  #if defined(BOT_MODE_ENABLED)
+    // Bot frames are checked by panel hash while a trace runs; start it
+    // from a full frame so every band has been hashed
+    bool hashBot = inputTrace.recording || inputTrace.playing;
+    if (hashBot && !botHashBands) botInvalidateFrame();
+    botHashBands = hashBot;
+  #endif
 
-  // Frame timing: power-save uses adaptive delays with FPS caps,
-  // full-power just uses the speed setting directly
-  #if defined(POWER_SAVE_ENABLED)
-    int frameDelay;
+  // Run current effect based on mode (held off while the mode flash shows)
+  if (!modeFlashActive()) {
     switch (currentMode) {
-      case MODE_EMOJI:
-        frameDelay = emojiFading ? FRAME_DELAY_EMOJI_FADING : FRAME_DELAY_EMOJI_STATIC;
+      case MODE_MOTION:
+        latencyProbe.beginFrame();
+        runMotionEffect(effectIndex);
+        latencyProbe.evaluated();
         break;
       case MODE_AMBIENT:
-        frameDelay = max((int)speed, FRAME_DELAY_AMBIENT_MIN);
+        runAmbientEffect(effectIndex);
         break;
-      default:  // MODE_MOTION
-        frameDelay = speed;
+      case MODE_EMOJI:
+        runEmojiEffect();
         break;
+      #if defined(BOT_MODE_ENABLED)
+      case MODE_BOT:
+        runBotMotionWake();
+        runBotMode();  // Renders straight to the LCD
+        break;
+      #endif
     }
+  }
 
-    // Chunk long delays into 30ms segments so shake detection stays responsive
-    while (frameDelay > 30) {
-      delay(30);
-      frameDelay -= 30;
-      if (wifiEnabled) server.handleClient();
-      readIMU();
-      checkModeShake();
+  showDisplay();
+  if (currentMode == MODE_MOTION) {
+    latencyProbe.shown(effectIndex);
+    latencyProbe.report(effectIndex);
+  }
+  inputTrace.endFrame(currentMode, effectIndex, paletteIndex, traceFrameHash());
+  appTasks.publish({ currentMode, effectIndex, paletteIndex, brightness, speed,
+                     autoCycle, appTasks.published, (uint16_t)frameTargetMs(),
+                     frameScheduler.missedTotal });
+  frameScheduler.report();
+  #if defined(POWER_SAVE_ENABLED)
+    powerSleep.report();
+  #endif
+
+  // Sleep to the next frame deadline, serving input and web calls in the
+  // slack. The bot paces itself: next frame or behavior event, whichever
+  // comes first.
+  #if defined(BOT_MODE_ENABLED)
+    if (currentMode == MODE_BOT) {
+      frameScheduler.waitFor(botFrameDelayMs(), serviceBetweenFrames);
+      return;
     }
-    delay(frameDelay);
-  #else
-    delay(speed);
   #endif
+  frameScheduler.waitNext(frameTargetMs(), serviceBetweenFrames);
 }
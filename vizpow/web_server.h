@@ -5,6 +5,9 @@
 #include <FastLED.h>
 #include "config.h"
 #include "palettes.h"
+#include "latency_probe.h"
+#include "input_trace.h"
+#include "app_tasks.h"
 
 // External references to globals
 extern WebServer server;
@@ -13,8 +16,8 @@ extern uint8_t paletteIndex;
 extern uint8_t brightness;
 extern uint8_t speed;
 extern bool autoCycle;
-extern void resetEffectShuffle();
 extern uint8_t currentMode;
+extern void switchMode(uint8_t nextMode);
 extern CRGBPalette16 currentPalette;
 
 // Emoji-related externs (defined in effects_emoji.h)
@@ -45,6 +48,7 @@ const char webpage[] PROGMEM = R"rawliteral(
       <button class="tab active" id="tabMotion" onclick="setMode(0)">Motion</button>
       <button class="tab" id="tabAmbient" onclick="setMode(1)">Ambient</button>
       <button class="tab" id="tabEmoji" onclick="setMode(2)">Emoji</button>
+      <button class="tab hidden" id="tabBot" onclick="setMode(3)">Bot</button>
     </div>
 
     <div id="effectsPanel">
@@ -72,6 +76,24 @@ const char webpage[] PROGMEM = R"rawliteral(
         <div class="toggle on" id="emojiAutoCycle"></div>
       </div>
     </div>
+
+    <div id="botPanel" class="hidden">
+      <h2>Expressions</h2>
+      <div class="grid" id="botExpressions"></div>
+      <h2 style="margin-top:15px">Expression Pack</h2>
+      <div style="display:flex;gap:8px">
+        <input type="file" id="packFile" accept=".bxp" style="flex:1;color:#fff;font-size:12px">
+        <button onclick="uploadPack()" style="padding:10px 16px">Upload</button>
+      </div>
+      <div class="status" id="packStatus"></div>
+      <h2 style="margin-top:15px">Say Something</h2>
+      <div style="display:flex;gap:8px">
+        <input type="text" id="botSayInput" placeholder="Type a message..."
+          style="flex:1;padding:10px;border-radius:8px;border:none;background:rgba(255,255,255,0.15);color:#fff;font-size:14px" maxlength="30">
+        <button onclick="sendBotSay()" style="padding:10px 16px">Say</button>
+        <button onclick="keepBotSay()" style="padding:10px 16px" title="Add to idle sayings">Keep</button>
+      </div>
+    </div>
   </div>
 
   <div class="card" id="paletteCard">
@@ -113,18 +135,27 @@ const char webpage[] PROGMEM = R"rawliteral(
       "WiFi", "Rainbow", "Mushroom", "Skelly",
       "Chicken", "Invader", "Dragon", "TwinkleHeart", "Popsicle"];
 
+    const botExprNames = ["Neutral", "Happy", "Sad", "Surprised", "Sleepy", "Angry", "Love", "Dizzy", "Thinking", "Excited", "Mischief", "Dead", "Skeptical", "Worried", "Confused", "Proud", "Shy", "Annoyed", "Bliss", "Focused"];
+
     function render() {
       const effects = state.currentMode === 0 ? motionEffects : ambientEffects;
       document.getElementById('tabMotion').className = 'tab ' + (state.currentMode === 0 ? 'active' : '');
       document.getElementById('tabAmbient').className = 'tab ' + (state.currentMode === 1 ? 'active' : '');
       document.getElementById('tabEmoji').className = 'tab ' + (state.currentMode === 2 ? 'active' : '');
+      document.getElementById('tabBot').className = 'tab ' + (state.numModes > 3 ? '' : 'hidden ') + (state.currentMode === 3 ? 'active' : '');
 
       const isEmoji = state.currentMode === 2;
-      document.getElementById('effectsPanel').className = isEmoji ? 'hidden' : '';
+      const isBot = state.currentMode === 3;
+      document.getElementById('effectsPanel').className = (isEmoji || isBot) ? 'hidden' : '';
       document.getElementById('emojiPanel').className = isEmoji ? '' : 'hidden';
-      document.getElementById('paletteCard').className = isEmoji ? 'card hidden' : 'card';
+      document.getElementById('botPanel').className = isBot ? '' : 'hidden';
+      document.getElementById('paletteCard').className = (isEmoji || isBot) ? 'card hidden' : 'card';
 
-      if (!isEmoji) {
+      if (isBot) {
+        document.getElementById('botExpressions').innerHTML = botExprNames.map((name, i) =>
+          `<button onclick="setBotExpr(${i})">${name}</button>`
+        ).join('');
+      } else if (!isEmoji) {
         document.getElementById('effects').innerHTML = effects.map((e, i) =>
           `<button class="${state.effect === i ? 'active' : ''}" onclick="setEffect(${i})">${e}</button>`
         ).join('');
@@ -185,6 +216,44 @@ const char webpage[] PROGMEM = R"rawliteral(
       render();
       api('/mode?v=' + mode);
     }
+    function setBotExpr(i) { api('/bot/expression?v=' + i); }
+    async function loadPack() {
+      try {
+        const info = await (await fetch('/bot/pack')).json();
+        botExprNames.length = info.builtIn;
+        for (let i = 0; i < info.count; i += 32) {
+          const names = await (await fetch('/bot/pack/names?from=' + i)).json();
+          names.forEach(n => botExprNames.push(n));
+        }
+        document.getElementById('packStatus').textContent = info.count ? info.count + ' pack expressions' : '';
+        render();
+      } catch(e) {}
+    }
+    async function uploadPack() {
+      const file = document.getElementById('packFile').files[0];
+      if (!file) return;
+      const body = new FormData();
+      body.append('pack', file, file.name);
+      try {
+        const r = await fetch('/bot/pack', { method: 'POST', body });
+        document.getElementById('packStatus').textContent = r.ok ? 'Pack loaded' : 'Invalid pack';
+      } catch(e) {}
+      loadPack();
+    }
+    function keepBotSay() {
+      const input = document.getElementById('botSayInput');
+      if (input.value.trim()) {
+        api('/bot/sayings/add?cat=idle&text=' + encodeURIComponent(input.value.trim()));
+        input.value = '';
+      }
+    }
+    function sendBotSay() {
+      const input = document.getElementById('botSayInput');
+      if (input.value.trim()) {
+        api('/bot/say?text=' + encodeURIComponent(input.value.trim()));
+        input.value = '';
+      }
+    }
     function setEffect(i) { state.effect = i; render(); api('/effect?v=' + i); }
     function setPalette(i) { state.palette = i; render(); api('/palette?v=' + i); }
 
@@ -249,72 +318,87 @@ const char webpage[] PROGMEM = R"rawliteral(
 
     getState();
     renderEmojiQueue();
+    loadPack();
   </script>
 </body>
 </html>
 )rawliteral";
 
-// Web server handlers
+// Web server handlers. They run on the net task (app_tasks.h): anything
+// touching render state goes through onRenderThread(), reads of the
+// running state come from the published snapshot.
 void handleRoot() {
   server.send(200, "text/html", webpage);
 }
 
 void handleState() {
-  String json = "{\"effect\":" + String(effectIndex) +
-                ",\"palette\":" + String(paletteIndex) +
-                ",\"brightness\":" + String(brightness) +
-                ",\"speed\":" + String(speed) +
-                ",\"autoCycle\":" + (autoCycle ? "true" : "false") +
-                ",\"currentMode\":" + String(currentMode) + "}";
+  AppSnapshot s = appTasks.snapshot();
+  String json = "{\"effect\":" + String(s.effect) +
+                ",\"palette\":" + String(s.palette) +
+                ",\"brightness\":" + String(s.brightness) +
+                ",\"speed\":" + String(s.speed) +
+                ",\"autoCycle\":" + (s.autoCycle ? "true" : "false") +
+                ",\"currentMode\":" + String(s.mode) +
+                ",\"frameMs\":" + String(s.frameMs) +
+                ",\"missedFrames\":" + String(s.missedFrames) +
+                ",\"numModes\":" + String(NUM_MODES) + "}";
   server.send(200, "application/json", json);
 }
 
 void handleMode() {
   if (server.hasArg("v")) {
-    uint8_t newMode = constrain(server.arg("v").toInt(), 0, 2);  // 3 modes: motion, ambient, emoji
-    currentMode = newMode;
-    effectIndex = 0;
-    resetEffectShuffle();
-    FastLED.clear();
+    uint8_t mode = constrain(server.arg("v").toInt(), 0, NUM_MODES - 1);
+    onRenderThread([&] { switchMode(mode); });
   }
   server.send(200, "text/plain", "OK");
 }
 
 void handleEffect() {
   if (server.hasArg("v")) {
-    int maxEffects = (currentMode == MODE_MOTION) ? NUM_MOTION_EFFECTS : NUM_AMBIENT_EFFECTS;
-    effectIndex = server.arg("v").toInt() % maxEffects;
-    FastLED.clear();
+    int v = server.arg("v").toInt();
+    onRenderThread([&] {
+      int maxEffects = (currentMode == MODE_MOTION) ? NUM_MOTION_EFFECTS : NUM_AMBIENT_EFFECTS;
+      effectIndex = v % maxEffects;
+      FastLED.clear();
+    });
   }
   server.send(200, "text/plain", "OK");
 }
 
 void handlePalette() {
   if (server.hasArg("v")) {
-    paletteIndex = server.arg("v").toInt() % NUM_PALETTES;
-    currentPalette = palettes[paletteIndex];
+    uint8_t v = server.arg("v").toInt() % NUM_PALETTES;
+    onRenderThread([&] {
+      paletteIndex = v;
+      currentPalette = palettes[paletteIndex];
+    });
   }
   server.send(200, "text/plain", "OK");
 }
 
 void handleBrightness() {
   if (server.hasArg("v")) {
-    brightness = constrain(server.arg("v").toInt(), 1, 50);
-    FastLED.setBrightness(brightness);
+    uint8_t v = constrain(server.arg("v").toInt(), 1, 50);
+    onRenderThread([&] {
+      brightness = v;
+      FastLED.setBrightness(brightness);
+    });
   }
   server.send(200, "text/plain", "OK");
 }
 
 void handleSpeed() {
   if (server.hasArg("v")) {
-    speed = constrain(server.arg("v").toInt(), 5, 100);
+    uint8_t v = constrain(server.arg("v").toInt(), 5, 100);
+    onRenderThread([&] { speed = v; });
   }
   server.send(200, "text/plain", "OK");
 }
 
 void handleAutoCycle() {
   if (server.hasArg("v")) {
-    autoCycle = server.arg("v").toInt() == 1;
+    bool v = server.arg("v").toInt() == 1;
+    onRenderThread([&] { autoCycle = v; });
   }
   server.send(200, "text/plain", "OK");
 }
@@ -323,35 +407,308 @@ void handleAutoCycle() {
 void handleEmojiAdd() {
   if (server.hasArg("v")) {
     uint8_t spriteIndex = server.arg("v").toInt();
-    addEmojiByIndex(spriteIndex);
+    onRenderThread([&] { addEmojiByIndex(spriteIndex); });
   }
   server.send(200, "text/plain", "OK");
 }
 
 void handleEmojiSettings() {
-  uint16_t cycleTime = emojiCycleTime;
-  uint16_t fadeDuration = emojiFadeDuration;
-  bool autoCycleVal = emojiAutoCycle;
+  bool hasCycle = server.hasArg("cycle"), hasFade = server.hasArg("fade"), hasAuto = server.hasArg("auto");
+  uint16_t cycleArg = hasCycle ? server.arg("cycle").toInt() : 0;
+  uint16_t fadeArg = hasFade ? server.arg("fade").toInt() : 0;
+  bool autoArg = hasAuto && server.arg("auto").toInt() == 1;
+
+  onRenderThread([&] {
+    setEmojiSettings(hasCycle ? cycleArg : emojiCycleTime,
+                     hasFade ? fadeArg : emojiFadeDuration,
+                     hasAuto ? autoArg : emojiAutoCycle);
+  });
+  server.send(200, "text/plain", "OK");
+}
 
-  if (server.hasArg("cycle")) {
-    cycleTime = server.arg("cycle").toInt();
+void handleEmojiClear() {
+  onRenderThread([] { clearEmojiQueue(); });
+  server.send(200, "text/plain", "OK");
+}
+
+// Motion-to-photon latency per motion effect (ms percentiles, us stage
+// means); ?reset=1 clears the histograms. Counters are read as they stand.
+void handleLatency() {
+  if (server.hasArg("reset")) {
+    onRenderThread([] { latencyProbe.reset(); });
+    server.send(200, "text/plain", "OK");
+    return;
   }
-  if (server.hasArg("fade")) {
-    fadeDuration = server.arg("fade").toInt();
+  // The probe is written every motion frame: summarize it on the render
+  // thread, format here
+  struct { uint32_t frames, maxUs, inputUs, evalUs, showUs; uint16_t p50, p95, p99; } fx[NUM_MOTION_EFFECTS];
+  onRenderThread([&] {
+    for (uint8_t i = 0; i < NUM_MOTION_EFFECTS; i++) {
+      const LatencyStats &st = latencyProbe.effects[i];
+      fx[i].frames = st.frames;
+      fx[i].maxUs = st.maxUs;
+      fx[i].inputUs = LatencyProbe::mean(st.inputUs, st.frames);
+      fx[i].evalUs = LatencyProbe::mean(st.evalUs, st.frames);
+      fx[i].showUs = LatencyProbe::mean(st.showUs, st.frames);
+      fx[i].p50 = latencyProbe.percentile(i, 500);
+      fx[i].p95 = latencyProbe.percentile(i, 950);
+      fx[i].p99 = latencyProbe.percentile(i, 990);
+    }
+  });
+  String json = "{\"effects\":[";
+  for (uint8_t i = 0; i < NUM_MOTION_EFFECTS; i++) {
+    if (i > 0) json += ",";
+    json += "{\"frames\":" + String(fx[i].frames) +
+            ",\"p50\":" + String(fx[i].p50) +
+            ",\"p95\":" + String(fx[i].p95) +
+            ",\"p99\":" + String(fx[i].p99) +
+            ",\"maxUs\":" + String(fx[i].maxUs) +
+            ",\"inputUs\":" + String(fx[i].inputUs) +
+            ",\"evalUs\":" + String(fx[i].evalUs) +
+            ",\"showUs\":" + String(fx[i].showUs) + "}";
   }
-  if (server.hasArg("auto")) {
-    autoCycleVal = server.arg("auto").toInt() == 1;
+  json += "]}";
+  server.send(200, "application/json", json);
+}
+
+// Input trace: ?rec=1 records, ?play=1 replays, ?stop=1 ends either;
+// status (JSON) otherwise
+void handleTrace() {
+  bool ok = true;
+  bool recording, playing, mounted;
+  uint32_t bytes, frames, samples, touches, mismatches, cpuAvgUs, cpuMaxUs;
+  bool rec = server.hasArg("rec"), play = server.hasArg("play"), stop = server.hasArg("stop");
+  onRenderThread([&] {
+    if (rec) ok = inputTrace.startRecording();
+    else if (play) ok = inputTrace.startPlayback();
+    else if (stop) inputTrace.stop();
+    mounted = inputTrace.mounted;
+    recording = inputTrace.recording;
+    playing = inputTrace.playing;
+    bytes = inputTrace.bytes;
+    frames = inputTrace.frames;
+    samples = inputTrace.samples;
+    touches = inputTrace.touches;
+    mismatches = inputTrace.mismatches;
+    cpuAvgUs = frames ? (uint32_t)(inputTrace.cpuUs / frames) : 0;
+    cpuMaxUs = inputTrace.cpuMaxUs;
+  });
+  if (!ok) {
+    server.send(409, "text/plain", mounted ? "Busy or no trace" : "No filesystem");
+    return;
   }
+  String json = "{\"recording\":" + String(recording ? "true" : "false") +
+                ",\"playing\":" + String(playing ? "true" : "false") +
+                ",\"bytes\":" + String(bytes) +
+                ",\"frames\":" + String(frames) +
+                ",\"samples\":" + String(samples) +
+                ",\"touches\":" + String(touches) +
+                ",\"mismatches\":" + String(mismatches) +
+                ",\"cpuAvgUs\":" + String(cpuAvgUs) +
+                ",\"cpuMaxUs\":" + String(cpuMaxUs) + "}";
+  server.send(200, "application/json", json);
+}
 
-  setEmojiSettings(cycleTime, fadeDuration, autoCycleVal);
+// Download the recorded trace. Refused while a recording is open; the
+// file is held so no recording can start while it streams.
+void handleTraceFile() {
+  bool mounted = false, recording = false;
+  onRenderThread([&] {
+    mounted = inputTrace.mounted;
+    recording = inputTrace.recording;
+    if (mounted && !recording) inputTrace.fileHeld = true;
+  });
+  if (recording) {
+    server.send(409, "text/plain", "Recording in progress");
+    return;
+  }
+  if (!mounted || !LittleFS.exists(TRACE_PATH)) {
+    onRenderThread([] { inputTrace.fileHeld = false; });
+    server.send(404, "text/plain", "No trace");
+    return;
+  }
+  File f = LittleFS.open(TRACE_PATH, FILE_READ);
+  server.streamFile(f, "application/octet-stream");
+  f.close();
+  onRenderThread([] { inputTrace.fileHeld = false; });
+}
+
+#if defined(BOT_MODE_ENABLED)
+// Bot mode handlers
+void handleBotExpression() {
+  if (server.hasArg("v")) {
+    int v = server.arg("v").toInt();
+    onRenderThread([&] { setBotExpression(constrain(v, 0, botExpressionCount() - 1)); });
+  }
   server.send(200, "text/plain", "OK");
 }
 
-void handleEmojiClear() {
-  clearEmojiQueue();
+void handleBotSay() {
+  if (server.hasArg("text")) {
+    String text = server.arg("text");
+    uint16_t dur = 4000;
+    if (server.hasArg("dur")) {
+      dur = constrain(server.arg("dur").toInt(), 1000, 10000);
+    }
+    onRenderThread([&] { showBotSaying(text.c_str(), dur); });
+  }
+  server.send(200, "text/plain", "OK");
+}
+// Append a quoted JSON string (quotes, backslashes and control chars dropped)
+void appendJsonString(String &json, const char* text) {
+  json += "\"";
+  for (const char* c = text; *c; c++) {
+    if (*c != '"' && *c != '\\' && *c >= ' ') json += *c;
+  }
+  json += "\"";
+}
+
+// Expression pack: GET = info (?clear=1 removes it), POST = upload
+void handleBotPack() {
+  bool clear = server.hasArg("clear");
+  uint16_t count = 0;
+  uint32_t reads = 0;
+  onRenderThread([&] {
+    if (clear) botPack.clear();
+    count = botPack.count;
+    reads = botPack.reads;
+  });
+  String json = "{\"builtIn\":" + String(BOT_NUM_EXPRESSIONS) +
+                ",\"count\":" + String(count) +
+                ",\"reads\":" + String(reads) + "}";
+  server.send(200, "application/json", json);
+}
+
+// Streamed to flash chunk by chunk — the pack never sits in RAM. Chunks
+// only touch the temp file, so they're written here; swapping the pack in
+// happens on the render thread, which reads it.
+void handleBotPackUpload() {
+  HTTPUpload &up = server.upload();
+  if (up.status == UPLOAD_FILE_START) {
+    botPack.uploadStart();
+  } else if (up.status == UPLOAD_FILE_WRITE) {
+    botPack.uploadWrite(up.buf, up.currentSize);
+  } else if (up.status == UPLOAD_FILE_END) {
+    onRenderThread([] { botPack.uploadEnd(); });
+  } else if (up.status == UPLOAD_FILE_ABORTED) {
+    botPack.uploadAbort();
+  }
+}
+
+void handleBotPackDone() {
+  if (botPack.uploadFailed) {
+    server.send(400, "text/plain", "Invalid pack");
+  } else {
+    server.send(200, "text/plain", "OK");
+  }
+}
+
+// The renderer picks phrases from botSayings, so the net task never reads
+// it directly: the store (~2.4KB) is copied on the render thread and the
+// copy is listed or written to flash here, off the frame
+BotSayingsStore botSayingsCopy = {};  // Net task only; too big for its stack
+
+const BotSayingsStore &copyBotSayings() {
+  onRenderThread([] { botSayingsCopy = botSayings; });
+  return botSayingsCopy;
+}
+
+// Sayings store: counts per category, or ?cat=name lists that category
+void handleBotSayings() {
+  const BotSayingsStore &store = copyBotSayings();
+  String json;
+  if (server.hasArg("cat")) {
+    String name = server.arg("cat");
+    int8_t cat = BotSayingsStore::categoryByName(name.c_str(), name.length());
+    json = "[";
+    for (uint16_t i = 0; cat >= 0 && i < store.categoryCount(cat); i++) {
+      if (i > 0) json += ",";
+      appendJsonString(json, store.get(cat, i));
+    }
+    json += "]";
+  } else {
+    json = "{\"count\":" + String(store.count()) +
+           ",\"poolUsed\":" + String(store.poolUsed) +
+           ",\"poolBytes\":" + String(BOT_SAY_POOL_BYTES) + ",\"categories\":{";
+    for (uint8_t c = 0; c < SAY_CATEGORY_COUNT; c++) {
+      if (c > 0) json += ",";
+      json += "\"" + String(sayCategoryNames[c]) + "\":" + String(store.categoryCount(c));
+    }
+    json += "}}";
+  }
+  server.send(200, "application/json", json);
+}
+
+// POST a phrase set in the "[category]" text format; appends, or with
+// ?replace=1 replaces the categories it names. Persisted to flash from
+// here, from a copy of the updated store.
+void handleBotSayingsLoad() {
+  bool replace = server.hasArg("replace") && server.arg("replace").toInt() == 1;
+  String text = server.arg("plain");
+  uint16_t added = 0;
+  onRenderThread([&] {
+    added = botSayings.loadText(text.c_str(), replace);
+    botSayingsCopy = botSayings;
+  });
+  bool saved = botSayingsCopy.save();
+  server.send(200, "application/json", "{\"added\":" + String(added) +
+              ",\"count\":" + String(botSayingsCopy.count()) +
+              ",\"saved\":" + (saved ? "true" : "false") + "}");
+}
+
+// Add one phrase: ?cat=name&text=...
+void handleBotSayingsAdd() {
+  String name = server.arg("cat");
+  String text = server.arg("text");
+  int8_t cat = BotSayingsStore::categoryByName(name.c_str(), name.length());
+  uint8_t len = text.length() > BOT_SAY_MAX_LEN ? BOT_SAY_MAX_LEN : text.length();
+  bool ok = false;
+  if (cat >= 0) {
+    onRenderThread([&] {
+      ok = botSayings.add(cat, text.c_str(), len);
+      if (ok) botSayingsCopy = botSayings;
+    });
+  }
+  if (!ok) {
+    server.send(400, "text/plain", "Unknown category, empty text or store full");
+    return;
+  }
+  botSayingsCopy.save();
   server.send(200, "text/plain", "OK");
 }
 
+// Back to the built-in phrases
+void handleBotSayingsReset() {
+  onRenderThread([] {
+    botSayings.resetDefaults();
+    botSayingsCopy = botSayings;
+  });
+  botSayingsCopy.save();
+  server.send(200, "text/plain", "OK");
+}
+
+// One page of pack expression names (JSON array), ?from=N. The pack file
+// is shared with the renderer, so the names are read on its thread.
+void handleBotPackNames() {
+  uint16_t from = server.hasArg("from") ? server.arg("from").toInt() : 0;
+  char names[BOT_PACK_NAMES_PAGE][BOT_PACK_NAME_LEN + 1];
+  uint16_t n = 0;
+  onRenderThread([&] {
+    for (uint16_t i = from; i < botPack.count && n < BOT_PACK_NAMES_PAGE; i++, n++) {
+      if (!botPack.name(i, names[n], sizeof(names[n]))) break;
+    }
+  });
+  String json = "[";
+  for (uint16_t i = 0; i < n; i++) {
+    if (i > 0) json += ",";
+    appendJsonString(json, names[i]);
+  }
+  json += "]";
+  server.send(200, "application/json", json);
+}
+
+#endif
+
 void setupWebServer() {
   server.on("/", handleRoot);
   server.on("/state", handleState);
@@ -367,6 +724,26 @@ void setupWebServer() {
   server.on("/emoji/settings", handleEmojiSettings);
   server.on("/emoji/clear", handleEmojiClear);
 
+  // Motion-to-photon latency
+  server.on("/latency", handleLatency);
+
+  // Input trace record/replay
+  server.on("/trace", handleTrace);
+  server.on("/trace/file", handleTraceFile);
+
+  #if defined(BOT_MODE_ENABLED)
+  // Bot endpoints
+  server.on("/bot/expression", handleBotExpression);
+  server.on("/bot/say", handleBotSay);
+  server.on("/bot/pack", HTTP_GET, handleBotPack);
+  server.on("/bot/pack", HTTP_POST, handleBotPackDone, handleBotPackUpload);
+  server.on("/bot/pack/names", handleBotPackNames);
+  server.on("/bot/sayings", HTTP_GET, handleBotSayings);
+  server.on("/bot/sayings", HTTP_POST, handleBotSayingsLoad);
+  server.on("/bot/sayings/add", handleBotSayingsAdd);
+  server.on("/bot/sayings/reset", handleBotSayingsReset);
+  #endif
+
   server.begin();
 }
 